@@ -0,0 +1,118 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 1M-row int32 column filtered at ~10% selectivity: a scalar bit-packing
+    // loop against select_bitmap, then popcount and index extraction over the
+    // bitmap (scalar, portable, dispatched).
+    std::mt19937 gen(44);
+    const std::size_t n = std::size_t{1} << 20;
+    std::vector<std::int32_t> col(n);
+    for (auto& x : col) x = static_cast<std::int32_t>(gen() % 1000);
+    const std::size_t words = simdtl::bitmap_words(n);
+    std::vector<std::uint64_t> bits(words), other(words), out(words);
+    std::vector<std::uint32_t> idx(n);
+    const auto pred = [](auto x) { return x < decltype(x)(100); };
+
+    ankerl::nanobench::Bench b;
+    b.title("select_bitmap 1M int32, x < 100").relative(true).minEpochIterations(100);
+    b.run("scalar bit loop", [&] {
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            std::uint64_t m = 0;
+            for (std::size_t j = 0; j < 64; ++j) m |= std::uint64_t{col[w * 64 + j] < 100} << j;
+            bits[w] = m;
+        }
+        ankerl::nanobench::doNotOptimizeAway(bits.data());
+    });
+    b.run("simdtl::select_bitmap", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::select_bitmap(col.data(), n, pred, bits.data()));
+    });
+    simdtl::select_bitmap(col.data(), n, [](auto x) { return x >= decltype(x)(500); }, other.data());
+    b.run("simdtl::bitmap_and", [&] {
+        simdtl::bitmap_and(bits.data(), other.data(), n, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+
+    simdtl::select_bitmap(col.data(), n, pred, bits.data());
+    ankerl::nanobench::Bench p;
+    p.title("bitmap_popcount 1M bits").relative(true).minEpochIterations(1000);
+    p.run("scalar shift-and-add", [&] {
+        std::size_t c = 0;
+        for (std::uint64_t w : bits)
+            for (; w != 0; w >>= 1) c += w & 1u;
+        ankerl::nanobench::doNotOptimizeAway(c);
+    });
+    p.run("simdtl::detail::bitmap_popcount_portable", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::detail::bitmap_popcount_portable(bits.data(), words));
+    });
+    p.run("simdtl::bitmap_popcount", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::bitmap_popcount(bits.data(), n));
+    });
+
+    ankerl::nanobench::Bench t;
+    t.title("bitmap_to_indices 1M bits, ~10% set").relative(true).minEpochIterations(100);
+    t.run("scalar bit test", [&] {
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            if (bits[i / 64] >> (i % 64) & 1u) idx[k++] = static_cast<std::uint32_t>(i);
+        ankerl::nanobench::doNotOptimizeAway(k);
+    });
+    t.run("simdtl::detail::bitmap_to_indices_portable", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::detail::bitmap_to_indices_portable(bits.data(), words, 0, idx.data()));
+    });
+    t.run("simdtl::bitmap_to_indices", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::bitmap_to_indices(bits.data(), n, idx.data()));
+    });
+
+    // a > 5 && b < 3 && c == 7 over int8 / float / int64 columns: a scalar row
+    // loop, one select_bitmap per column plus bitmap_and, and the fused pass.
+    std::vector<std::int8_t> ca(n);
+    std::vector<float> cb(n);
+    std::vector<std::int64_t> cc(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ca[i] = static_cast<std::int8_t>(gen() % 16);
+        cb[i] = static_cast<float>(gen() % 8);
+        cc[i] = static_cast<std::int64_t>(gen() % 10);
+    }
+    std::vector<std::uint64_t> third(words);
+    const auto fused = [](auto a, auto b, auto c) {
+        using A = decltype(a);
+        using B = decltype(b);
+        using C = decltype(c);
+        return simdtl::mask_and(a > A(5), b < B(3), c == C(7));
+    };
+    ankerl::nanobench::Bench f;
+    f.title("count a > 5 && b < 3 && c == 7, 1M rows int8/float/int64").relative(true).minEpochIterations(50);
+    f.run("scalar row loop", [&] {
+        std::size_t c = 0;
+        for (std::size_t i = 0; i < ca.size(); ++i) c += (ca[i] > 5 && cb[i] < 3 && cc[i] == 7) ? 1u : 0u;
+        ankerl::nanobench::doNotOptimizeAway(c);
+    });
+    f.run("select_bitmap per column + bitmap_and", [&] {
+        simdtl::select_bitmap(ca.data(), ca.size(), [](auto x) { return x > decltype(x)(5); }, bits.data());
+        simdtl::select_bitmap(cb.data(), cb.size(), [](auto x) { return x < decltype(x)(3); }, other.data());
+        simdtl::select_bitmap(cc.data(), cc.size(), [](auto x) { return x == decltype(x)(7); }, third.data());
+        simdtl::bitmap_and(bits.data(), other.data(), n, out.data());
+        simdtl::bitmap_and(out.data(), third.data(), n, out.data());
+        ankerl::nanobench::doNotOptimizeAway(simdtl::bitmap_popcount(out.data(), n));
+    });
+    f.run("simdtl::count_if(columns(a, b, c))", [&] {
+        ankerl::nanobench::doNotOptimizeAway(
+            simdtl::count_if(simdtl::columns(ca.data(), cb.data(), cc.data()), ca.size(), fused));
+    });
+    f.run("simdtl::copy_if_indices(columns(a, b, c))", [&] {
+        ankerl::nanobench::doNotOptimizeAway(
+            simdtl::copy_if_indices(simdtl::columns(ca.data(), cb.data(), cc.data()), ca.size(), idx.data(), fused));
+    });
+}
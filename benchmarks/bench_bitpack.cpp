@@ -0,0 +1,60 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 1M values of a 12-bit frame-of-reference column: a scalar bit-stream
+    // unpacker (what a straightforward codec does), the portable vertical
+    // layout, the dispatched kernels, and the fused scans against
+    // unpack-then-count_if.
+    std::mt19937 gen(41);
+    const std::size_t n = std::size_t{1} << 20;
+    const unsigned bits = 12;
+    std::vector<std::uint32_t> v(n), u(n);
+    for (auto& x : v) x = gen() & 0xFFFu;
+    std::vector<std::uint32_t> packed(simdtl::bitpack_words(n, bits)), stream(n * bits / 32 + 1);
+    simdtl::bitpack(v.data(), n, bits, packed.data());
+    simdtl::detail::pack_tail(v.data(), n, bits, stream.data());
+    const auto pred = [](auto x) { return x < decltype(x)(100); };
+
+    ankerl::nanobench::Bench b;
+    b.title("1M x 12-bit values").relative(true).minEpochIterations(10);
+    b.run("scalar bit-stream unpack", [&] {
+        simdtl::detail::unpack_tail(stream.data(), n, bits, u.data());
+        ankerl::nanobench::doNotOptimizeAway(u.data());
+    });
+    b.run("simdtl::detail::bitunpack_blocks_portable", [&] {
+        simdtl::detail::bitunpack_blocks_portable(packed.data(), n / simdtl::bitpack_block, bits, u.data());
+        ankerl::nanobench::doNotOptimizeAway(u.data());
+    });
+    b.run("simdtl::bitunpack", [&] {
+        simdtl::bitunpack(packed.data(), n, bits, u.data());
+        ankerl::nanobench::doNotOptimizeAway(u.data());
+    });
+    b.run("simdtl::detail::bitpack_blocks_portable", [&] {
+        simdtl::detail::bitpack_blocks_portable(v.data(), n / simdtl::bitpack_block, bits, packed.data());
+        ankerl::nanobench::doNotOptimizeAway(packed.data());
+    });
+    b.run("simdtl::bitpack", [&] {
+        simdtl::bitpack(v.data(), n, bits, packed.data());
+        ankerl::nanobench::doNotOptimizeAway(packed.data());
+    });
+    b.run("simdtl::bitunpack + simdtl::count_if", [&] {
+        simdtl::bitunpack(packed.data(), n, bits, u.data());
+        ankerl::nanobench::doNotOptimizeAway(simdtl::count_if(u, pred));
+    });
+    b.run("simdtl::bitunpack_count_if", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::bitunpack_count_if(packed.data(), n, bits, pred));
+    });
+    b.run("simdtl::bitunpack_sum", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::bitunpack_sum(packed.data(), n, bits));
+    });
+    return 0;
+}
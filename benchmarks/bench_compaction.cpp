@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <cstring>
 #include <random>
+#include <string>
 #include <vector>
 
 int main()
@@ -55,5 +56,132 @@ int main()
             ankerl::nanobench::doNotOptimizeAway(work[0]);
         });
     }
+    // unique over a sorted column with ~3 copies per value (dedup of a sort key).
+    {
+        std::vector<std::int32_t> sorted(base.size());
+        for (std::size_t i = 0; i < sorted.size(); ++i) sorted[i] = static_cast<std::int32_t>(i / 3);
+        ankerl::nanobench::Bench b;
+        b.title("unique, 8192 sorted int32 (~3 dups/value, incl. memcpy restore)").relative(true).minEpochIterations(20);
+        b.run("std::unique", [&] {
+            std::memcpy(work.data(), sorted.data(), bytes);
+            auto e = std::unique(work.begin(), work.end());
+            ankerl::nanobench::doNotOptimizeAway(e);
+        });
+        b.run("simdtl::unique (dispatched)", [&] {
+            std::memcpy(work.data(), sorted.data(), bytes);
+            auto k = simdtl::unique(work.data(), work.size());
+            ankerl::nanobench::doNotOptimizeAway(k);
+        });
+    }
+    // expand: scatter a filtered column back to its rows (~50% selected).
+    {
+        std::vector<std::uint64_t> bits((base.size() + 63) / 64);
+        std::mt19937_64 g64(7);
+        for (auto& w : bits) w = g64();
+        std::vector<std::int32_t> dense(base.size()), out(base.size());
+        ankerl::nanobench::Bench b;
+        b.title("expand, 8192 int32 rows, ~50% selected").relative(true).minEpochIterations(20);
+        b.run("scalar loop", [&] {
+            std::size_t k = 0;
+            for (std::size_t i = 0; i < base.size(); ++i)
+                out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : base[i];
+            ankerl::nanobench::doNotOptimizeAway(k);
+        });
+        b.run("simdtl::expand (dispatched)", [&] {
+            auto k = simdtl::expand(base.data(), base.size(), bits.data(), dense.data(), out.data());
+            ankerl::nanobench::doNotOptimizeAway(k);
+        });
+    }
+    // copy_if_indices: selection vector of ~30% of the rows, then a refinement
+    // keeping ~1/3 of those.
+    {
+        std::vector<std::uint32_t> idx(base.size()), sel(base.size());
+        const std::size_t m = simdtl::copy_if_indices(base.data(), base.size(), sel.data(),
+                                                      [](auto x) { using X = decltype(x); return x < X(3); });
+        ankerl::nanobench::Bench b;
+        b.title("copy_if_indices, 8192 int32 rows, ~30% selected").relative(true).minEpochIterations(50);
+        b.run("scalar loop", [&] {
+            std::size_t k = 0;
+            for (std::size_t i = 0; i < base.size(); ++i)
+                if (base[i] < 3) idx[k++] = static_cast<std::uint32_t>(i);
+            ankerl::nanobench::doNotOptimizeAway(k);
+        });
+        b.run("simdtl::copy_if_indices", [&] {
+            auto k = simdtl::copy_if_indices(base.data(), base.size(), idx.data(),
+                                             [](auto x) { using X = decltype(x); return x < X(3); });
+            ankerl::nanobench::doNotOptimizeAway(k);
+        });
+        b.run("scalar refine", [&] {
+            std::size_t k = 0;
+            for (std::size_t j = 0; j < m; ++j)
+                if (base[sel[j]] == 1) idx[k++] = sel[j];
+            ankerl::nanobench::doNotOptimizeAway(k);
+        });
+        b.run("simdtl::copy_if_indices (refine)", [&] {
+            auto k = simdtl::copy_if_indices(base.data(), sel.data(), m, idx.data(),
+                                             [](auto x) { using X = decltype(x); return x == X(1); });
+            ankerl::nanobench::doNotOptimizeAway(k);
+        });
+    }
+    // copy_if_zip: an int32 key column with two int32, two float, two int64 and
+    // two double payloads, ~30% and ~70% of rows kept. The baseline is the usual
+    // selection vector plus a gather loop per payload column.
+    {
+        const std::size_t n = base.size();
+        std::vector<std::int32_t> a(n), b2(n), ko(n), oa(n), ob(n);
+        std::vector<float> c(n), d(n), oc(n), od(n);
+        std::vector<std::int64_t> e(n), f(n), oe(n), of(n);
+        std::vector<double> g(n), h(n), og(n), oh(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a[i] = b2[i] = static_cast<std::int32_t>(i);
+            c[i] = d[i] = static_cast<float>(i);
+            e[i] = f[i] = static_cast<std::int64_t>(i);
+            g[i] = h[i] = static_cast<double>(i);
+        }
+        std::vector<std::uint32_t> sel(n);
+        for (int cut : {3, 7})
+        {
+            const auto pred = [cut](auto x) { using X = decltype(x); return x < X(cut); };
+            ankerl::nanobench::Bench b;
+            b.title("copy_if_zip, 8192 int32 keys + 8 payloads (4- and 8-byte), ~" + std::to_string(cut * 10) + "% kept")
+                .relative(true).minEpochIterations(200);
+            b.run("copy_if_indices + scalar gather per column", [&] {
+                const std::size_t k = simdtl::copy_if_indices(base.data(), n, sel.data(), pred);
+                for (std::size_t j = 0; j < k; ++j)
+                {
+                    const std::uint32_t r = sel[j];
+                    ko[j] = base[r]; oa[j] = a[r]; ob[j] = b2[r]; oc[j] = c[r]; od[j] = d[r];
+                    oe[j] = e[r]; of[j] = f[r]; og[j] = g[r]; oh[j] = h[r];
+                }
+                ankerl::nanobench::doNotOptimizeAway(k);
+            });
+            b.run("copy_if_indices + simdtl::take per column", [&] {
+                const std::size_t k = simdtl::copy_if_indices(base.data(), n, sel.data(), pred);
+                simdtl::take(base.data(), sel.data(), k, ko.data());
+                simdtl::take(a.data(), sel.data(), k, oa.data());
+                simdtl::take(b2.data(), sel.data(), k, ob.data());
+                simdtl::take(c.data(), sel.data(), k, oc.data());
+                simdtl::take(d.data(), sel.data(), k, od.data());
+                simdtl::take(e.data(), sel.data(), k, oe.data());
+                simdtl::take(f.data(), sel.data(), k, of.data());
+                simdtl::take(g.data(), sel.data(), k, og.data());
+                simdtl::take(h.data(), sel.data(), k, oh.data());
+                ankerl::nanobench::doNotOptimizeAway(k);
+            });
+            b.run("simdtl::copy_if_zip", [&] {
+                const std::size_t k = simdtl::copy_if_zip(base.data(), n, ko.data(), pred,
+                                                          simdtl::payload(a.data(), oa.data()),
+                                                          simdtl::payload(b2.data(), ob.data()),
+                                                          simdtl::payload(c.data(), oc.data()),
+                                                          simdtl::payload(d.data(), od.data()),
+                                                          simdtl::payload(e.data(), oe.data()),
+                                                          simdtl::payload(f.data(), of.data()),
+                                                          simdtl::payload(g.data(), og.data()),
+                                                          simdtl::payload(h.data(), oh.data()));
+                ankerl::nanobench::doNotOptimizeAway(k);
+            });
+        }
+    }
     return 0;
 }
@@ -0,0 +1,76 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 256K elements (L2-resident): the scalar clamp / lrint loops callers wrote,
+    // the portable fixed_size path, and the dispatched pack / unpack kernels.
+    std::mt19937 gen(38);
+    const std::size_t n = std::size_t{1} << 18;
+    std::vector<std::int32_t> i32(n), r32(n);
+    std::vector<std::int16_t> i16(n);
+    std::vector<std::uint8_t> u8(n);
+    std::vector<float> f(n), fo(n);
+    std::uniform_int_distribution<std::int32_t> d(-70000, 70000);
+    std::uniform_real_distribution<float> uf(-20.0f, 300.0f);
+    for (auto& x : i32) x = d(gen);
+    for (auto& x : u8) x = static_cast<std::uint8_t>(gen());
+    for (auto& x : f) x = uf(gen);
+
+    ankerl::nanobench::Bench b;
+    b.title("256K conversions").relative(true).minEpochIterations(20);
+    b.run("scalar std::clamp loop (int32 -> int16)", [&] {
+        for (std::size_t i = 0; i < n; ++i) i16[i] = static_cast<std::int16_t>(std::clamp(i32[i], -32768, 32767));
+        ankerl::nanobench::doNotOptimizeAway(i16.data());
+    });
+    b.run("simdtl::detail::convert_saturate_portable (int32 -> int16)", [&] {
+        simdtl::detail::convert_saturate_portable(i32.data(), n, i16.data());
+        ankerl::nanobench::doNotOptimizeAway(i16.data());
+    });
+    b.run("simdtl::convert_saturate (int32 -> int16)", [&] {
+        simdtl::convert_saturate(i32.data(), n, i16.data());
+        ankerl::nanobench::doNotOptimizeAway(i16.data());
+    });
+    b.run("scalar loop (uint8 -> float)", [&] {
+        for (std::size_t i = 0; i < n; ++i) fo[i] = static_cast<float>(u8[i]);
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::detail::convert_portable (uint8 -> float)", [&] {
+        simdtl::detail::convert_portable(u8.data(), n, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::convert (uint8 -> float)", [&] {
+        simdtl::convert(u8.data(), n, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("scalar std::lrint loop (float -> int32)", [&] {
+        for (std::size_t i = 0; i < n; ++i) r32[i] = static_cast<std::int32_t>(std::lrint(f[i]));
+        ankerl::nanobench::doNotOptimizeAway(r32.data());
+    });
+    b.run("simdtl::detail::convert_round_portable (float -> int32)", [&] {
+        simdtl::detail::convert_round_portable(f.data(), n, r32.data());
+        ankerl::nanobench::doNotOptimizeAway(r32.data());
+    });
+    b.run("simdtl::convert_round (float -> int32)", [&] {
+        simdtl::convert_round(f.data(), n, r32.data());
+        ankerl::nanobench::doNotOptimizeAway(r32.data());
+    });
+    b.run("scalar clamp + lrint loop (float -> uint8)", [&] {
+        for (std::size_t i = 0; i < n; ++i) u8[i] = static_cast<std::uint8_t>(std::lrint(std::clamp(f[i], 0.0f, 255.0f)));
+        ankerl::nanobench::doNotOptimizeAway(u8.data());
+    });
+    b.run("simdtl::convert_round (float -> uint8)", [&] {
+        simdtl::convert_round(f.data(), n, u8.data());
+        ankerl::nanobench::doNotOptimizeAway(u8.data());
+    });
+    return 0;
+}
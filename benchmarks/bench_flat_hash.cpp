@@ -0,0 +1,77 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+int main()
+{
+    // 2^21 uint64 keys -> uint64 payloads: ~64 MB of slots, far beyond L2, so
+    // each lookup is a cache miss unless several are in flight. Probes hit half
+    // the time (a hash-join probe side).
+    std::mt19937_64 gen(2050);
+    const std::size_t n = std::size_t{1} << 21;
+    std::vector<std::uint64_t> keys(n), vals(n);
+    for (std::size_t i = 0; i < n; ++i) { keys[i] = gen(); vals[i] = i; }
+    std::vector<std::uint64_t> probes(std::size_t{1} << 16);
+    for (auto& p : probes) p = (gen() & 1) ? keys[gen() % n] : gen();
+    std::vector<std::uint64_t> out(probes.size());
+
+    std::unordered_map<std::uint64_t, std::uint64_t> std_map;
+    std_map.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) std_map.emplace(keys[i], vals[i]);
+    simdtl::flat_hash_map<std::uint64_t, std::uint64_t> map(n);
+    map.insert_many(keys.data(), vals.data(), n);
+
+    ankerl::nanobench::Bench b;
+    b.title("lookup of 65536 uint64 keys (50% hits) in a 2^21-entry map").relative(true).batch(probes.size()).unit("key").minEpochIterations(10);
+    b.run("std::unordered_map::find", [&] {
+        for (std::size_t j = 0; j < probes.size(); ++j)
+        {
+            const auto it = std_map.find(probes[j]);
+            out[j] = it == std_map.end() ? 0 : it->second;
+        }
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+    b.run("simdtl::flat_hash_map::find (one at a time)", [&] {
+        for (std::size_t j = 0; j < probes.size(); ++j)
+        {
+            const std::uint64_t* v = map.find(probes[j]);
+            out[j] = v ? *v : 0;
+        }
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+    b.run("simdtl::flat_hash_map::find_many (prefetched)", [&] {
+        map.find_many(probes.data(), probes.size(), out.data());
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+
+    // Building a set from 2^20 keys drawn from 2^20 values (~37% repeats), room
+    // reserved up front so the probes, not rehashing, are measured.
+    std::vector<std::uint64_t> stream(std::size_t{1} << 20);
+    for (auto& s : stream) s = keys[gen() % stream.size()];
+    ankerl::nanobench::Bench c;
+    c.title("insert 2^20 uint64 keys (~37% repeats) into a reserved set").relative(true).batch(stream.size()).unit("key").minEpochIterations(4);
+    c.run("std::unordered_set::insert", [&] {
+        std::unordered_set<std::uint64_t> set(stream.size());
+        for (std::uint64_t k : stream) set.insert(k);
+        ankerl::nanobench::doNotOptimizeAway(set.size());
+    });
+    c.run("simdtl::flat_hash_set::insert (one at a time)", [&] {
+        simdtl::flat_hash_set<std::uint64_t> set(stream.size());
+        for (std::uint64_t k : stream) set.insert(k);
+        ankerl::nanobench::doNotOptimizeAway(set.size());
+    });
+    c.run("simdtl::flat_hash_set::insert_many (prefetched)", [&] {
+        simdtl::flat_hash_set<std::uint64_t> set(stream.size());
+        set.insert_many(stream.data(), stream.size());
+        ankerl::nanobench::doNotOptimizeAway(set.size());
+    });
+    return 0;
+}
@@ -0,0 +1,58 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 2^18 int32 (1 MB, L2-resident) table, 2^16 random row ids: late
+    // materialization of a filtered column. Cache-resident so the gather
+    // instruction itself is measured, not DRAM latency.
+    std::mt19937 gen(31);
+    std::vector<std::int32_t> table(std::size_t{1} << 18);
+    for (auto& x : table) x = static_cast<std::int32_t>(gen());
+    std::vector<std::int32_t> idx(std::size_t{1} << 16);
+    for (auto& i : idx) i = static_cast<std::int32_t>(gen() % table.size());
+    std::vector<std::int32_t> out(idx.size());
+    std::vector<std::int64_t> table64(table.begin(), table.end()), out64(idx.size());
+
+    {
+        ankerl::nanobench::Bench b;
+        b.title("take, 65536 random rows of a 2^18 table").relative(true).batch(idx.size()).unit("row").minEpochIterations(20);
+        b.run("int32 scalar loads (portable)", [&] {
+            simdtl::detail::take_portable(table.data(), idx.data(), idx.size(), out.data());
+            ankerl::nanobench::doNotOptimizeAway(out[0]);
+        });
+        b.run("int32 simdtl::take (dispatched)", [&] {
+            simdtl::take(table.data(), idx.data(), idx.size(), out.data());
+            ankerl::nanobench::doNotOptimizeAway(out[0]);
+        });
+        b.run("int64 scalar loads (portable)", [&] {
+            simdtl::detail::take_portable(table64.data(), idx.data(), idx.size(), out64.data());
+            ankerl::nanobench::doNotOptimizeAway(out64[0]);
+        });
+        b.run("int64 simdtl::take (dispatched)", [&] {
+            simdtl::take(table64.data(), idx.data(), idx.size(), out64.data());
+            ankerl::nanobench::doNotOptimizeAway(out64[0]);
+        });
+    }
+    {
+        std::vector<float> dense(table.size()), vals(idx.size());
+        for (auto& x : dense) x = static_cast<float>(gen() % 1000) * 0.001f;
+        for (auto& x : vals) x = static_cast<float>(gen() % 1000) * 0.001f;
+        ankerl::nanobench::Bench b;
+        b.title("sparse_dot, 65536 nonzeros against a 2^18 dense float vector").relative(true).batch(idx.size()).unit("nnz").minEpochIterations(20);
+        b.run("scalar (portable, 4 partial sums)", [&] {
+            ankerl::nanobench::doNotOptimizeAway(simdtl::detail::sparse_dot_portable(dense.data(), idx.data(), vals.data(), vals.size()));
+        });
+        b.run("simdtl::sparse_dot (dispatched)", [&] {
+            ankerl::nanobench::doNotOptimizeAway(simdtl::sparse_dot(dense.data(), idx.data(), vals.data(), vals.size()));
+        });
+    }
+    return 0;
+}
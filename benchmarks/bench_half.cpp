@@ -0,0 +1,58 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 256K elements (L2-resident): the portable per-element bit manipulation
+    // (what a scalar loop compiles to) against the F16C / AVX-512 BF16 kernels.
+    std::mt19937 gen(39);
+    const std::size_t n = std::size_t{1} << 18;
+    std::vector<float> f(n), fo(n);
+    std::vector<std::uint16_t> h(n);
+    std::uniform_real_distribution<float> uf(-1000.0f, 1000.0f);
+    for (auto& x : f) x = uf(gen);
+    simdtl::detail::f32_to_f16_portable(f.data(), n, h.data());
+
+    ankerl::nanobench::Bench b;
+    b.title("256K half conversions").relative(true).minEpochIterations(20);
+    b.run("simdtl::detail::f32_to_f16_portable", [&] {
+        simdtl::detail::f32_to_f16_portable(f.data(), n, h.data());
+        ankerl::nanobench::doNotOptimizeAway(h.data());
+    });
+    b.run("simdtl::convert_f32_to_f16", [&] {
+        simdtl::convert_f32_to_f16(f.data(), n, h.data());
+        ankerl::nanobench::doNotOptimizeAway(h.data());
+    });
+    b.run("simdtl::detail::f16_to_f32_portable", [&] {
+        simdtl::detail::f16_to_f32_portable(h.data(), n, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::convert_f16_to_f32", [&] {
+        simdtl::convert_f16_to_f32(h.data(), n, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::detail::f32_to_bf16_portable", [&] {
+        simdtl::detail::f32_to_bf16_portable(f.data(), n, h.data());
+        ankerl::nanobench::doNotOptimizeAway(h.data());
+    });
+    b.run("simdtl::convert_f32_to_bf16", [&] {
+        simdtl::convert_f32_to_bf16(f.data(), n, h.data());
+        ankerl::nanobench::doNotOptimizeAway(h.data());
+    });
+    b.run("simdtl::detail::bf16_to_f32_portable", [&] {
+        simdtl::detail::bf16_to_f32_portable(h.data(), n, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::convert_bf16_to_f32", [&] {
+        simdtl::convert_bf16_to_f32(h.data(), n, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    return 0;
+}
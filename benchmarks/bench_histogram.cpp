@@ -0,0 +1,90 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 1 MB of bytes, two distributions: uniform (bins rarely repeat back to
+    // back) and constant (every increment hits the same bin — the worst case
+    // for a naive loop's store-to-load forwarding).
+    std::mt19937 gen(31);
+    const std::size_t n = std::size_t{1} << 20;
+    std::vector<std::uint8_t> uni(n), same(n, 7);
+    for (auto& x : uni) x = static_cast<std::uint8_t>(gen());
+    std::vector<std::uint32_t> hist(65536);
+
+    auto naive8 = [&](const std::vector<std::uint8_t>& v) {
+        std::uint32_t h[256] = {};
+        for (std::uint8_t x : v) ++h[x];
+        ankerl::nanobench::doNotOptimizeAway(h);
+    };
+
+    ankerl::nanobench::Bench b;
+    b.title("histogram_u8, 1 MB").relative(true).minEpochIterations(5);
+    b.run("naive ++hist[x], uniform", [&] { naive8(uni); });
+    b.run("simdtl::histogram_u8, uniform", [&] {
+        simdtl::histogram_u8(uni.data(), n, hist.data());
+        ankerl::nanobench::doNotOptimizeAway(hist[0]);
+    });
+    b.run("naive ++hist[x], constant", [&] { naive8(same); });
+    b.run("simdtl::histogram_u8, constant", [&] {
+        simdtl::histogram_u8(same.data(), n, hist.data());
+        ankerl::nanobench::doNotOptimizeAway(hist[0]);
+    });
+
+    // 2^20 uint16: Zipf-ish skew (half the mass on 16 values).
+    std::vector<std::uint16_t> u16(n), c16(n, 300);
+    for (auto& x : u16) x = static_cast<std::uint16_t>(gen() & 1u ? gen() & 15u : gen());
+    ankerl::nanobench::Bench w;
+    w.title("histogram_u16, 2^20").relative(true).minEpochIterations(5);
+    w.run("naive ++hist[x]", [&] {
+        std::vector<std::uint32_t> h(65536);
+        for (std::uint16_t x : u16) ++h[x];
+        ankerl::nanobench::doNotOptimizeAway(h[0]);
+    });
+    w.run("simdtl::histogram_u16", [&] {
+        simdtl::histogram_u16(u16.data(), n, hist.data());
+        ankerl::nanobench::doNotOptimizeAway(hist[0]);
+    });
+    w.run("simdtl::detail::histogram_u16_portable", [&] {
+        simdtl::detail::histogram_u16_portable(u16.data(), n, hist.data());
+        ankerl::nanobench::doNotOptimizeAway(hist[0]);
+    });
+    w.run("naive ++hist[x], constant", [&] {
+        std::vector<std::uint32_t> h(65536);
+        for (std::uint16_t x : c16) ++h[x];
+        ankerl::nanobench::doNotOptimizeAway(h[0]);
+    });
+    w.run("simdtl::histogram_u16, constant", [&] {
+        simdtl::histogram_u16(c16.data(), n, hist.data());
+        ankerl::nanobench::doNotOptimizeAway(hist[0]);
+    });
+    w.run("simdtl::detail::histogram_u16_portable, constant", [&] {
+        simdtl::detail::histogram_u16_portable(c16.data(), n, hist.data());
+        ankerl::nanobench::doNotOptimizeAway(hist[0]);
+    });
+
+    // Five-value status column, 1M int8: one branchy pass vs five count kernels.
+    std::vector<std::int8_t> status(n);
+    for (auto& x : status) x = static_cast<std::int8_t>(gen() % 5);
+    const std::int8_t domain[5] = {0, 1, 2, 3, 4};
+    std::size_t counts[5];
+    ankerl::nanobench::Bench c;
+    c.title("count 5 values, 1M int8").relative(true).minEpochIterations(5);
+    c.run("scalar switch loop", [&] {
+        std::size_t h[5] = {};
+        for (std::int8_t x : status) ++h[static_cast<std::size_t>(x)];
+        ankerl::nanobench::doNotOptimizeAway(h);
+    });
+    c.run("simdtl::count_values_in_small_domain", [&] {
+        simdtl::count_values_in_small_domain(status.data(), n, domain, 5, counts);
+        ankerl::nanobench::doNotOptimizeAway(counts);
+    });
+    return 0;
+}
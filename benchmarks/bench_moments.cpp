@@ -0,0 +1,67 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 1M floats / doubles (L2/L3-resident): the two-pass mean-then-deviations
+    // loop (what callers wrote for a stable variance), a scalar Welford loop
+    // (the one-pass stable alternative), and the lane-parallel moments.
+    std::mt19937 gen(37);
+    const std::size_t n = std::size_t{1} << 20;
+    std::vector<float> f(n);
+    std::vector<double> d(n);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    for (auto& x : f) x = 100.0f + u(gen);
+    for (auto& x : d) x = 100.0 + u(gen);
+
+    ankerl::nanobench::Bench b;
+    b.title("variance of 1M").relative(true).minEpochIterations(10);
+    b.run("two-pass loop (float)", [&] {
+        float s = 0;
+        for (float x : f) s += x;
+        const float mean = s / n;
+        float m2 = 0;
+        for (float x : f) m2 += (x - mean) * (x - mean);
+        ankerl::nanobench::doNotOptimizeAway(m2);
+    });
+    b.run("scalar Welford (moment_state::push, float)", [&] {
+        simdtl::moment_state<float> s;
+        for (float x : f) s.push(x);
+        ankerl::nanobench::doNotOptimizeAway(s.m2);
+    });
+    b.run("simdtl::detail::moments_portable (float)", [&] {
+        const auto s = simdtl::detail::moments_portable<float, 2>(f.data(), n);
+        ankerl::nanobench::doNotOptimizeAway(s.m2);
+    });
+    b.run("simdtl::moments (float)", [&] {
+        const auto s = simdtl::moments(f.data(), n);
+        ankerl::nanobench::doNotOptimizeAway(s.m2);
+    });
+    b.run("simdtl::moments<4> (float)", [&] {
+        const auto s = simdtl::moments<4>(f.data(), n);
+        ankerl::nanobench::doNotOptimizeAway(s.m4);
+    });
+    b.run("two-pass loop (double)", [&] {
+        double s = 0;
+        for (double x : d) s += x;
+        const double mean = s / n;
+        double m2 = 0;
+        for (double x : d) m2 += (x - mean) * (x - mean);
+        ankerl::nanobench::doNotOptimizeAway(m2);
+    });
+    b.run("simdtl::moments (double)", [&] {
+        const auto s = simdtl::moments(d.data(), n);
+        ankerl::nanobench::doNotOptimizeAway(s.m2);
+    });
+    b.run("simdtl::moments<4> (double)", [&] {
+        const auto s = simdtl::moments<4>(d.data(), n);
+        ankerl::nanobench::doNotOptimizeAway(s.m4);
+    });
+    return 0;
+}
@@ -0,0 +1,80 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 8192-row cache-resident columns, ~30% selected: the same filter as a
+    // lambda (portable compress_store path) and as a vocabulary predicate
+    // (dispatched compare + compress kernel).
+    std::mt19937 gen(46);
+    const std::size_t n = 8192;
+    std::vector<std::int32_t> col(n);
+    std::vector<std::int8_t> bytes(n);
+    std::vector<float> reals(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        col[i] = static_cast<std::int32_t>(gen() % 1000);
+        bytes[i] = static_cast<std::int8_t>(gen() % 100);
+        reals[i] = static_cast<float>(gen() % 1000) * 0.5f;
+    }
+    std::vector<std::int32_t> out(n);
+    std::vector<std::int8_t> bout(n);
+    std::vector<float> rout(n);
+
+    ankerl::nanobench::Bench b;
+    b.title("copy_if 8192 int32, 200 <= x <= 499").relative(true).minEpochIterations(200);
+    b.run("scalar loop", [&] {
+        std::size_t k = 0;
+        for (std::int32_t x : col)
+            if (x >= 200 && x <= 499) out[k++] = x;
+        ankerl::nanobench::doNotOptimizeAway(k);
+    });
+    b.run("simdtl::copy_if (lambda)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::copy_if(col.data(), col.size(), out.data(), [](auto x) {
+            using X = decltype(x);
+            return x >= X(200) && x <= X(499);
+        }));
+    });
+    b.run("simdtl::copy_if (between)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::copy_if(col.data(), col.size(), out.data(), simdtl::between(200, 499)));
+    });
+    b.run("simdtl::count_if (lambda)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::count_if(col.data(), col.size(), [](auto x) {
+            using X = decltype(x);
+            return x >= X(200) && x <= X(499);
+        }));
+    });
+    b.run("simdtl::count_if (between)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::count_if(col.data(), col.size(), simdtl::between(200, 499)));
+    });
+
+    ankerl::nanobench::Bench s;
+    s.title("copy_if 8192 int8 / float, x < 30 / x < 150").relative(true).minEpochIterations(200);
+    s.run("int8 scalar loop", [&] {
+        std::size_t k = 0;
+        for (std::int8_t x : bytes)
+            if (x < 30) bout[k++] = x;
+        ankerl::nanobench::doNotOptimizeAway(k);
+    });
+    s.run("int8 simdtl::copy_if (lambda)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::copy_if(bytes.data(), bytes.size(), bout.data(),
+                                                             [](auto x) { return x < decltype(x)(30); }));
+    });
+    s.run("int8 simdtl::copy_if (lt)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::copy_if(bytes.data(), bytes.size(), bout.data(), simdtl::lt(30)));
+    });
+    s.run("float simdtl::copy_if (lambda)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::copy_if(reals.data(), reals.size(), rout.data(),
+                                                             [](auto x) { return x < decltype(x)(150); }));
+    });
+    s.run("float simdtl::copy_if (lt)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::copy_if(reals.data(), reals.size(), rout.data(), simdtl::lt(150.0f)));
+    });
+}
@@ -0,0 +1,58 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 256K elements (L2-resident): the scalar loops a preprocessing step would
+    // write (std::nearbyint + clamp, and back), the portable transform, and the
+    // dispatched kernels.
+    std::mt19937 gen(40);
+    const std::size_t n = std::size_t{1} << 18;
+    std::vector<float> f(n), fo(n);
+    std::vector<std::int8_t> q(n);
+    std::normal_distribution<float> d(0.0f, 2.0f);
+    for (auto& x : f) x = d(gen);
+    const auto p = simdtl::calibrate_symmetric(f);
+    const float inv = 1.0f / p.scale;
+
+    ankerl::nanobench::Bench b;
+    b.title("256K float <-> int8").relative(true).minEpochIterations(20);
+    b.run("scalar nearbyint + clamp loop (quantize)", [&] {
+        for (std::size_t i = 0; i < n; ++i)
+            q[i] = static_cast<std::int8_t>(std::clamp(std::nearbyint(f[i] * inv), -128.0f, 127.0f));
+        ankerl::nanobench::doNotOptimizeAway(q.data());
+    });
+    b.run("simdtl::detail::quantize_portable", [&] {
+        simdtl::detail::quantize_portable(f.data(), n, inv, 0, q.data());
+        ankerl::nanobench::doNotOptimizeAway(q.data());
+    });
+    b.run("simdtl::quantize", [&] {
+        simdtl::quantize(f.data(), n, p, q.data());
+        ankerl::nanobench::doNotOptimizeAway(q.data());
+    });
+    b.run("scalar loop (dequantize)", [&] {
+        for (std::size_t i = 0; i < n; ++i) fo[i] = static_cast<float>(q[i]) * p.scale;
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::detail::dequantize_portable", [&] {
+        simdtl::detail::dequantize_portable(q.data(), n, p.scale, 0, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::dequantize", [&] {
+        simdtl::dequantize(q.data(), n, p, fo.data());
+        ankerl::nanobench::doNotOptimizeAway(fo.data());
+    });
+    b.run("simdtl::calibrate_symmetric", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::calibrate_symmetric(f));
+    });
+    return 0;
+}
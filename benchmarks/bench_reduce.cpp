@@ -0,0 +1,98 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 64K elements (cache-resident): a plain widened scalar loop (what callers
+    // wrote before) vs the dispatched widening kernels.
+    std::mt19937 gen(32);
+    const std::size_t n = std::size_t{1} << 16;
+    std::vector<std::int8_t> i8(n);
+    std::vector<std::uint8_t> u8(n);
+    std::vector<std::int16_t> i16(n);
+    std::vector<float> f32(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        i8[i]  = static_cast<std::int8_t>(gen());
+        u8[i]  = static_cast<std::uint8_t>(gen());
+        i16[i] = static_cast<std::int16_t>(gen());
+        f32[i] = static_cast<float>(gen() % 1000) * 0.25f;
+    }
+
+    ankerl::nanobench::Bench b;
+    b.title("reduce_wide, 64K elements").relative(true).minEpochIterations(100);
+    b.run("scalar int64 += int8", [&] {
+        std::int64_t s = 0;
+        for (std::int8_t x : i8) s += x;
+        ankerl::nanobench::doNotOptimizeAway(s);
+    });
+    b.run("simdtl::reduce_wide<int64>(int8)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::reduce_wide<std::int64_t>(i8.data(), n));
+    });
+    b.run("scalar uint64 += uint8", [&] {
+        std::uint64_t s = 0;
+        for (std::uint8_t x : u8) s += x;
+        ankerl::nanobench::doNotOptimizeAway(s);
+    });
+    b.run("simdtl::reduce_wide<uint64>(uint8)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::reduce_wide<std::uint64_t>(u8.data(), n));
+    });
+    b.run("scalar int64 += int16", [&] {
+        std::int64_t s = 0;
+        for (std::int16_t x : i16) s += x;
+        ankerl::nanobench::doNotOptimizeAway(s);
+    });
+    b.run("simdtl::reduce_wide<int64>(int16)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::reduce_wide<std::int64_t>(i16.data(), n));
+    });
+    b.run("scalar double += float", [&] {
+        double s = 0;
+        for (float x : f32) s += x;
+        ankerl::nanobench::doNotOptimizeAway(s);
+    });
+    b.run("simdtl::reduce_wide<double>(float)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::reduce_wide<double>(f32.data(), n));
+    });
+
+    // Cost of the floating-point modes against plain `reduce` (same 64K floats).
+    ankerl::nanobench::Bench m;
+    m.title("float sum modes, 64K elements").relative(true).minEpochIterations(100);
+    m.run("std::accumulate (sequential)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(std::accumulate(f32.begin(), f32.end(), 0.0f));
+    });
+    m.run("simdtl::reduce", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::reduce(f32.data(), n));
+    });
+    m.run("simdtl::reduce_kahan (Neumaier)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::reduce_kahan(f32.data(), n));
+    });
+    m.run("simdtl::reduce_deterministic", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::reduce_deterministic(f32.data(), n));
+    });
+
+    // Dot product, 64K floats: the loop callers wrote by hand vs the FMA kernels.
+    std::vector<float> g(n);
+    for (auto& x : g) x = static_cast<float>(gen() % 1000) * 0.5f;
+    ankerl::nanobench::Bench d;
+    d.title("dot, 64K floats").relative(true).minEpochIterations(100);
+    d.run("scalar loop", [&] {
+        float s = 0;
+        for (std::size_t i = 0; i < n; ++i) s += f32[i] * g[i];
+        ankerl::nanobench::doNotOptimizeAway(s);
+    });
+    d.run("simdtl::detail::dot_portable", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::detail::dot_portable(f32.data(), g.data(), n));
+    });
+    d.run("simdtl::dot (dispatched)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::dot(f32.data(), g.data(), n));
+    });
+    return 0;
+}
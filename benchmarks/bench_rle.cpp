@@ -0,0 +1,103 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 1M-row low-cardinality int32 column (runs of 1..64, mean ~32) and an
+    // int8 column of short runs (1..4): scalar run loops against the portable
+    // paths and the dispatched kernels.
+    std::mt19937 gen(43);
+    const std::size_t n = std::size_t{1} << 20;
+    auto column = [&](auto zero, std::size_t max_run) {
+        std::vector<decltype(zero)> v;
+        v.reserve(n);
+        while (v.size() < n)
+        {
+            const auto x = static_cast<decltype(zero)>(gen() % 16);
+            for (std::size_t len = 1 + gen() % max_run; len != 0 && v.size() < n; --len) v.push_back(x);
+        }
+        return v;
+    };
+    const auto col = column(std::int32_t{0}, 64);
+    const auto bytes = column(std::int8_t{0}, 4);
+    std::vector<std::int32_t> values(n), out(n);
+    std::vector<std::int8_t> bvalues(n), bout(n);
+    std::vector<std::uint32_t> lengths(n), blengths(n);
+
+    ankerl::nanobench::Bench b;
+    b.title("rle_encode 1M int32, runs of 1..64").relative(true).minEpochIterations(100);
+    b.run("scalar run loop", [&] {
+        std::size_t k = 0;
+        std::int32_t cur = col[0];
+        std::uint32_t len = 0;
+        for (std::int32_t x : col)
+        {
+            if (x != cur) { values[k] = cur; lengths[k++] = len; cur = x; len = 0; }
+            ++len;
+        }
+        values[k] = cur;
+        lengths[k++] = len;
+        ankerl::nanobench::doNotOptimizeAway(k);
+    });
+    b.run("simdtl::detail::rle_ends_portable", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::detail::rle_ends_portable(col.data(), n, values.data(), lengths.data()));
+    });
+    b.run("simdtl::rle_encode", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::rle_encode(col.data(), n, values.data(), lengths.data()));
+    });
+
+    const std::size_t runs = simdtl::rle_encode(col.data(), n, values.data(), lengths.data());
+    ankerl::nanobench::Bench d;
+    d.title("rle_decode 1M int32, runs of 1..64").relative(true).minEpochIterations(100);
+    d.run("scalar fill loop", [&] {
+        std::size_t p = 0;
+        for (std::size_t r = 0; r < runs; ++r)
+            for (std::uint32_t j = 0; j < lengths[r]; ++j) out[p++] = values[r];
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    d.run("simdtl::detail::rle_decode_portable", [&] {
+        simdtl::detail::rle_decode_portable(values.data(), lengths.data(), runs, n, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    d.run("simdtl::rle_decode", [&] {
+        simdtl::rle_decode(values.data(), lengths.data(), runs, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+
+    ankerl::nanobench::Bench s;
+    s.title("1M int8, runs of 1..4").relative(true).minEpochIterations(100);
+    s.run("scalar run loop (encode)", [&] {
+        std::size_t k = 0;
+        std::int8_t cur = bytes[0];
+        std::uint32_t len = 0;
+        for (std::int8_t x : bytes)
+        {
+            if (x != cur) { bvalues[k] = cur; blengths[k++] = len; cur = x; len = 0; }
+            ++len;
+        }
+        bvalues[k] = cur;
+        blengths[k++] = len;
+        ankerl::nanobench::doNotOptimizeAway(k);
+    });
+    s.run("simdtl::rle_encode", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::rle_encode(bytes.data(), n, bvalues.data(), blengths.data()));
+    });
+    const std::size_t bruns = simdtl::rle_encode(bytes.data(), n, bvalues.data(), blengths.data());
+    s.run("scalar fill loop (decode)", [&] {
+        std::size_t p = 0;
+        for (std::size_t r = 0; r < bruns; ++r)
+            for (std::uint32_t j = 0; j < blengths[r]; ++j) bout[p++] = bvalues[r];
+        ankerl::nanobench::doNotOptimizeAway(bout.data());
+    });
+    s.run("simdtl::rle_decode", [&] {
+        simdtl::rle_decode(bvalues.data(), blengths.data(), bruns, bout.data());
+        ankerl::nanobench::doNotOptimizeAway(bout.data());
+    });
+}
@@ -0,0 +1,55 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 8192 elements (32-64 KB, cache-resident): the serial carry chain, not
+    // bandwidth, is what a scan kernel has to beat.
+    std::mt19937 gen(77);
+    std::vector<std::int32_t> i32(8192);
+    for (auto& x : i32) x = static_cast<std::int32_t>(gen() % 100);
+    std::vector<float> f32(i32.begin(), i32.end());
+    std::vector<std::int32_t> oi(i32.size());
+    std::vector<float> of(f32.size());
+
+    ankerl::nanobench::Bench b;
+    b.title("inclusive_scan, 8192 elements").relative(true).minEpochIterations(50);
+    b.run("std::inclusive_scan<int32>", [&] {
+        std::inclusive_scan(i32.begin(), i32.end(), oi.begin());
+        ankerl::nanobench::doNotOptimizeAway(oi.back());
+    });
+    b.run("simdtl::inclusive_scan<int32> (dispatched)", [&] {
+        simdtl::inclusive_scan(i32.data(), i32.size(), oi.data());
+        ankerl::nanobench::doNotOptimizeAway(oi.back());
+    });
+    b.run("std::inclusive_scan<float>", [&] {
+        std::inclusive_scan(f32.begin(), f32.end(), of.begin());
+        ankerl::nanobench::doNotOptimizeAway(of.back());
+    });
+    b.run("simdtl::inclusive_scan<float> (dispatched)", [&] {
+        simdtl::inclusive_scan(f32.data(), f32.size(), of.data());
+        ankerl::nanobench::doNotOptimizeAway(of.back());
+    });
+
+    // 2^24 int32 (64 MB): the two-pass parallel scan vs the serial kernel.
+    std::vector<std::int32_t> big(std::size_t{1} << 24, 1), bout(big.size());
+    ankerl::nanobench::Bench p;
+    p.title("inclusive_scan, 2^24 int32").relative(true).minEpochIterations(3);
+    p.run("simdtl::inclusive_scan (serial)", [&] {
+        simdtl::inclusive_scan(big.data(), big.size(), bout.data());
+        ankerl::nanobench::doNotOptimizeAway(bout.back());
+    });
+    p.run("simdtl::parallel_inclusive_scan (all hardware threads)", [&] {
+        simdtl::parallel_inclusive_scan(big.data(), big.size(), bout.data());
+        ankerl::nanobench::doNotOptimizeAway(bout.back());
+    });
+    return 0;
+}
@@ -0,0 +1,51 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 2^22 int32 (16 MB) sorted array: larger than L2, so every probe of a lone
+    // binary search is a dependent miss — the case batching is meant to hide.
+    std::mt19937 gen(2024);
+    std::uniform_int_distribution<std::int32_t> dist(0, 1 << 30);
+    std::vector<std::int32_t> sorted(std::size_t{1} << 22);
+    for (auto& x : sorted) x = dist(gen);
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::int32_t> keys(std::size_t{1} << 16);
+    for (auto& x : keys) x = dist(gen);
+    std::vector<std::size_t> out(keys.size());
+    const simdtl::btree_index<std::int32_t> index(sorted);
+
+    ankerl::nanobench::Bench b;
+    b.title("lower_bound of 65536 keys in 2^22 sorted int32").relative(true).batch(keys.size()).unit("key").minEpochIterations(10);
+    b.run("std::lower_bound (one at a time)", [&] {
+        for (std::size_t j = 0; j < keys.size(); ++j)
+            out[j] = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), keys[j]) - sorted.begin());
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+    b.run("simdtl::lower_bound (branchless, one at a time)", [&] {
+        for (std::size_t j = 0; j < keys.size(); ++j)
+            out[j] = simdtl::lower_bound(sorted.data(), sorted.size(), keys[j]);
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+    b.run("simdtl::lower_bound_many (dispatched)", [&] {
+        simdtl::lower_bound_many(sorted.data(), sorted.size(), keys.data(), keys.size(), out.data());
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+    b.run("simdtl::lower_bound_many (portable interleaved)", [&] {
+        simdtl::detail::lower_bound_many_portable(sorted.data(), sorted.size(), keys.data(), keys.size(), out.data());
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+    b.run("simdtl::btree_index::lower_bound_many", [&] {
+        index.lower_bound_many(keys.data(), keys.size(), out.data());
+        ankerl::nanobench::doNotOptimizeAway(out[0]);
+    });
+    return 0;
+}
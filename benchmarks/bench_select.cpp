@@ -0,0 +1,80 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 1M uniformly random floats (4 MB). top 100: std::partial_sort on a copy
+    // (what callers did before) vs the threshold-filtered top_k.
+    std::mt19937 gen(36);
+    const std::size_t n = std::size_t{1} << 20, k = 100;
+    std::vector<float> f(n);
+    std::vector<std::int32_t> i32(n);
+    std::uniform_real_distribution<float> u(-1000.0f, 1000.0f);
+    for (auto& x : f) x = u(gen);
+    for (auto& x : i32) x = static_cast<std::int32_t>(gen());
+    std::vector<float> work(n), out(k);
+    std::vector<std::int32_t> work32(n), out32(k);
+    std::vector<std::size_t> idx(k), perm(n);
+
+    ankerl::nanobench::Bench b;
+    b.title("top 100 of 1M").relative(true).minEpochIterations(5);
+    b.run("std::partial_sort on a copy (float)", [&] {
+        std::copy(f.begin(), f.end(), work.begin());
+        std::partial_sort(work.begin(), work.begin() + k, work.end(), std::greater<float>());
+        ankerl::nanobench::doNotOptimizeAway(work.data());
+    });
+    b.run("simdtl::top_k (float)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::top_k(f.data(), n, k, out.data()));
+    });
+    b.run("std::partial_sort over an index permutation (float)", [&] {
+        std::iota(perm.begin(), perm.end(), std::size_t{0});
+        std::partial_sort(perm.begin(), perm.begin() + k, perm.end(),
+                          [&](std::size_t a, std::size_t c) { return f[a] > f[c]; });
+        ankerl::nanobench::doNotOptimizeAway(perm.data());
+    });
+    b.run("simdtl::top_k with indices (float)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::top_k(f.data(), n, k, out.data(), idx.data()));
+    });
+    b.run("std::partial_sort on a copy (int32)", [&] {
+        std::copy(i32.begin(), i32.end(), work32.begin());
+        std::partial_sort(work32.begin(), work32.begin() + k, work32.end());
+        ankerl::nanobench::doNotOptimizeAway(work32.data());
+    });
+    b.run("simdtl::bottom_k (int32)", [&] {
+        ankerl::nanobench::doNotOptimizeAway(simdtl::bottom_k(i32.data(), n, k, out32.data()));
+    });
+
+    // Median of 1M: both sides copy the input first, since both reorder it.
+    ankerl::nanobench::Bench m;
+    m.title("nth_element (median) of 1M").relative(true).minEpochIterations(5);
+    m.run("std::nth_element (float)", [&] {
+        std::copy(f.begin(), f.end(), work.begin());
+        std::nth_element(work.begin(), work.begin() + n / 2, work.end());
+        ankerl::nanobench::doNotOptimizeAway(work[n / 2]);
+    });
+    m.run("simdtl::nth_element (float)", [&] {
+        std::copy(f.begin(), f.end(), work.begin());
+        simdtl::nth_element(work.data(), n, n / 2);
+        ankerl::nanobench::doNotOptimizeAway(work[n / 2]);
+    });
+    m.run("std::nth_element (int32)", [&] {
+        std::copy(i32.begin(), i32.end(), work32.begin());
+        std::nth_element(work32.begin(), work32.begin() + n / 2, work32.end());
+        ankerl::nanobench::doNotOptimizeAway(work32[n / 2]);
+    });
+    m.run("simdtl::nth_element (int32)", [&] {
+        std::copy(i32.begin(), i32.end(), work32.begin());
+        simdtl::nth_element(work32.data(), n, n / 2);
+        ankerl::nanobench::doNotOptimizeAway(work32[n / 2]);
+    });
+    return 0;
+}
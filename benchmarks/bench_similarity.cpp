@@ -0,0 +1,87 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // One 128-dim query against 2K stored rows (1 MB of float, L2-resident):
+    // a per-row scalar loop (what callers wrote before), the portable row-by-row
+    // path, and the dispatched register-blocked kernels.
+    std::mt19937 gen(35);
+    const std::size_t rows = 2048, dim = 128;
+    std::vector<float> q(dim), base(rows * dim), out(rows);
+    std::vector<std::int8_t> q8(dim), base8(rows * dim);
+    std::vector<std::int64_t> out8(rows);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    for (auto& x : q) x = u(gen);
+    for (auto& x : base) x = u(gen);
+    for (auto& x : q8) x = static_cast<std::int8_t>(gen());
+    for (auto& x : base8) x = static_cast<std::int8_t>(gen());
+
+    ankerl::nanobench::Bench b;
+    b.title("2K rows x 128 dims").relative(true).minEpochIterations(20);
+    b.run("scalar dot loop per row (float)", [&] {
+        for (std::size_t r = 0; r < rows; ++r)
+        {
+            float s = 0;
+            for (std::size_t i = 0; i < dim; ++i) s += q[i] * base[r * dim + i];
+            out[r] = s;
+        }
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    b.run("simdtl::detail::score_many_portable<dot> (float)", [&] {
+        simdtl::detail::score_many_portable<simdtl::metric::dot>(q.data(), base.data(), rows, dim, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    b.run("simdtl::dot_many (float)", [&] {
+        simdtl::dot_many(q.data(), base.data(), rows, dim, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    b.run("simdtl::l2sq_many (float)", [&] {
+        simdtl::l2sq_many(q.data(), base.data(), rows, dim, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    b.run("simdtl::cosine_many (float)", [&] {
+        simdtl::cosine_many(q.data(), base.data(), rows, dim, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    b.run("scalar dot loop per row (int8)", [&] {
+        for (std::size_t r = 0; r < rows; ++r)
+        {
+            std::int64_t s = 0;
+            for (std::size_t i = 0; i < dim; ++i) s += q8[i] * base8[r * dim + i];
+            out8[r] = s;
+        }
+        ankerl::nanobench::doNotOptimizeAway(out8.data());
+    });
+    b.run("simdtl::dot_many (int8)", [&] {
+        simdtl::dot_many(q8.data(), base8.data(), rows, dim, out8.data());
+        ankerl::nanobench::doNotOptimizeAway(out8.data());
+    });
+
+    // Top 10 by cosine: score everything then partial_sort, vs the fused heap.
+    const std::size_t k = 10;
+    std::vector<std::size_t> idx(rows);
+    std::vector<float> scores(k);
+    ankerl::nanobench::Bench t;
+    t.title("top 10 of 2K rows by cosine").relative(true).minEpochIterations(20);
+    t.run("cosine_many + std::partial_sort", [&] {
+        simdtl::cosine_many(q.data(), base.data(), rows, dim, out.data());
+        for (std::size_t r = 0; r < rows; ++r) idx[r] = r;
+        std::partial_sort(idx.begin(), idx.begin() + k, idx.end(),
+                          [&](std::size_t a, std::size_t c) { return out[a] > out[c]; });
+        ankerl::nanobench::doNotOptimizeAway(idx.data());
+    });
+    t.run("simdtl::nearest_k<cosine>", [&] {
+        simdtl::nearest_k<simdtl::metric::cosine>(q.data(), base.data(), rows, dim, k, idx.data(), scores.data());
+        ankerl::nanobench::doNotOptimizeAway(idx.data());
+    });
+    return 0;
+}
@@ -0,0 +1,79 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main()
+{
+    // 1M sorted ids with gaps of up to 2^17 (deltas of 1..3 bytes): a scalar
+    // LEB128 varint decoder plus running sum (the usual storage codec), the
+    // portable StreamVByte byte loop, the dispatched decode, and the fused
+    // decode + prefix sum.
+    std::mt19937 gen(42);
+    const std::size_t n = std::size_t{1} << 20;
+    std::vector<std::uint32_t> ids(n), d(n), u(n);
+    std::uint32_t x = 0;
+    for (auto& id : ids) id = x += gen() % (gen() % 8 == 0 ? 1u << 17 : 1u << 9);
+    simdtl::delta_encode(ids.data(), n, d.data());
+
+    std::vector<std::uint8_t> leb;
+    for (std::uint32_t v : d)
+    {
+        for (; v >= 0x80u; v >>= 7) leb.push_back(static_cast<std::uint8_t>(v | 0x80u));
+        leb.push_back(static_cast<std::uint8_t>(v));
+    }
+    std::vector<std::uint8_t> svb(simdtl::streamvbyte_max_bytes(n)), out(svb.size());
+    simdtl::streamvbyte_encode(d.data(), n, svb.data());
+    const std::size_t head = (n + 3) / 4;
+
+    ankerl::nanobench::Bench b;
+    b.title("decode 1M delta-coded ids").relative(true).minEpochIterations(30);
+    b.run("scalar LEB128 + running sum", [&] {
+        const std::uint8_t* p = leb.data();
+        std::uint32_t acc = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::uint32_t v = 0;
+            for (unsigned s = 0;; s += 7)
+            {
+                const std::uint8_t c = *p++;
+                v |= std::uint32_t{c & 0x7Fu} << s;
+                if (c < 0x80u) break;
+            }
+            u[i] = acc += v;
+        }
+        ankerl::nanobench::doNotOptimizeAway(u.data());
+    });
+    b.run("simdtl::detail::svb_decode_portable", [&] {
+        simdtl::detail::svb_decode_portable(svb.data(), svb.data() + head, n, u.data());
+        ankerl::nanobench::doNotOptimizeAway(u.data());
+    });
+    b.run("simdtl::streamvbyte_decode", [&] {
+        simdtl::streamvbyte_decode(svb.data(), n, u.data());
+        ankerl::nanobench::doNotOptimizeAway(u.data());
+    });
+    b.run("simdtl::streamvbyte_decode_delta", [&] {
+        simdtl::streamvbyte_decode_delta(svb.data(), n, u.data());
+        ankerl::nanobench::doNotOptimizeAway(u.data());
+    });
+
+    ankerl::nanobench::Bench e;
+    e.title("encode 1M delta-coded ids").relative(true).minEpochIterations(10);
+    e.run("simdtl::detail::svb_encode_portable", [&] {
+        simdtl::detail::svb_encode_portable(d.data(), n, out.data(), out.data() + head);
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    e.run("simdtl::streamvbyte_encode", [&] {
+        simdtl::streamvbyte_encode(d.data(), n, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    e.run("simdtl::streamvbyte_encode_delta", [&] {
+        simdtl::streamvbyte_encode_delta(ids.data(), n, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+}
@@ -0,0 +1,61 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench/nanobench.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+int main()
+{
+    // 1 MiB of random bytes through a random 256-entry table, then 1M byte
+    // codes decoded against 4-byte and 8-byte dictionaries of 16 and 256
+    // entries: a scalar lookup loop against the dispatched kernels.
+    std::mt19937 gen(49);
+    const std::size_t n = std::size_t{1} << 20;
+    std::vector<std::uint8_t> in(n), out(n), table(256);
+    for (auto& x : in) x = static_cast<std::uint8_t>(gen());
+    for (auto& t : table) t = static_cast<std::uint8_t>(gen());
+
+    ankerl::nanobench::Bench t;
+    t.title("translate_bytes 1 MiB, random 256-entry table").relative(true).minEpochIterations(50);
+    t.run("scalar table[x]", [&] {
+        for (std::size_t i = 0; i < in.size(); ++i) out[i] = table[in[i]];
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+    t.run("simdtl::translate_bytes", [&] {
+        simdtl::translate_bytes(in.data(), in.size(), table.data(), out.data());
+        ankerl::nanobench::doNotOptimizeAway(out.data());
+    });
+
+    std::vector<std::uint32_t> d32(256), o32(n);
+    std::vector<std::uint64_t> d64(256), o64(n);
+    for (auto& d : d32) d = static_cast<std::uint32_t>(gen());
+    for (auto& d : d64) d = (std::uint64_t{gen()} << 32) | gen();
+    for (std::size_t dict_n : {std::size_t{16}, std::size_t{256}})
+    {
+        std::vector<std::uint8_t> codes(n);
+        for (auto& c : codes) c = static_cast<std::uint8_t>(gen() % dict_n);
+        ankerl::nanobench::Bench d;
+        d.title("dict_decode 1M byte codes, " + std::to_string(dict_n) + " entries").relative(true).minEpochIterations(50);
+        d.run("scalar uint32 dict[c]", [&] {
+            for (std::size_t i = 0; i < codes.size(); ++i) o32[i] = d32[codes[i]];
+            ankerl::nanobench::doNotOptimizeAway(o32.data());
+        });
+        d.run("simdtl::dict_decode uint32", [&] {
+            simdtl::dict_decode(codes.data(), codes.size(), d32.data(), dict_n, o32.data());
+            ankerl::nanobench::doNotOptimizeAway(o32.data());
+        });
+        d.run("scalar uint64 dict[c]", [&] {
+            for (std::size_t i = 0; i < codes.size(); ++i) o64[i] = d64[codes[i]];
+            ankerl::nanobench::doNotOptimizeAway(o64.data());
+        });
+        d.run("simdtl::dict_decode uint64", [&] {
+            simdtl::dict_decode(codes.data(), codes.size(), d64.data(), dict_n, o64.data());
+            ankerl::nanobench::doNotOptimizeAway(o64.data());
+        });
+    }
+}
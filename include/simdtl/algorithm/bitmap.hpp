@@ -0,0 +1,144 @@
+#pragma once
+// ── L4: selection bitmaps (1 bit per row, LSB-first 64-bit words) ─────────────
+// The format expand() consumes: row i is bit i % 64 of word i / 64. Bits past
+// n in the last word are written as zero and assumed zero on input.
+//   select_bitmap(first, n, pred, bits)   bit i = pred(first[i]); returns the count
+//   bitmap_and / _or / _andnot(a, b, n, out)   a & b, a | b, a & ~b (may alias)
+//   bitmap_not(a, n, out)                 ~a, tail bits kept zero
+//   bitmap_popcount(bits, n)              selected rows
+//   bitmap_to_indices(bits, n, out)       selected rows' indices, ascending; returns the count
+// so a multi-column filter is one select_bitmap per column and word-wide ANDs.
+// select_bitmap evaluates `pred` (elemental, as for count_if) one native
+// register at a time and moves each mask out with mask_bits (vpmovmskb /
+// vmovmskps, a kmov on AVX-512), 64 / W registers per word, so it stays
+// header-only for any predicate. bitmap_to_indices' `out` needs room for n
+// indices: the kernels store whole registers below that bound.
+// Dispatch: bitmap_popcount at AVX2 (pshufb nibble counts + vpsadbw) and
+// AVX-512 (vpopcntq with VPOPCNTDQ, else the nibble counts on zmm);
+// bitmap_to_indices at AVX2 (256-entry table of set positions + base, 8 per
+// store) and AVX-512 (vpcompressd of iota + base, 16 per store). Portable:
+// std::popcount and a countr_zero loop.
+#include "../backend/names.hpp"
+#include "../platform/dispatch.hpp"
+#include "transform.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdtl
+{
+    constexpr std::size_t bitmap_words(std::size_t n) noexcept { return (n + 63) / 64; }
+
+    namespace detail
+    {
+        // Valid bits of the last word (all ones if n is a multiple of 64).
+        constexpr std::uint64_t bitmap_tail_mask(std::size_t n) noexcept
+        {
+            return n % 64 == 0 ? ~std::uint64_t{0} : (std::uint64_t{1} << (n % 64)) - 1u;
+        }
+
+        inline std::size_t bitmap_popcount_portable(const std::uint64_t* bits, std::size_t words) noexcept
+        {
+            std::size_t total = 0;
+            for (std::size_t w = 0; w < words; ++w) total += static_cast<std::size_t>(std::popcount(bits[w]));
+            return total;
+        }
+
+        inline std::size_t bitmap_to_indices_portable(const std::uint64_t* bits, std::size_t words, std::uint32_t base,
+                                                      std::uint32_t* out) noexcept
+        {
+            std::size_t k = 0;
+            for (std::size_t w = 0; w < words; ++w)
+                for (std::uint64_t x = bits[w]; x != 0; x &= x - 1)
+                    out[k++] = base + static_cast<std::uint32_t>(w * 64 + static_cast<std::size_t>(std::countr_zero(x)));
+            return k;
+        }
+
+        // bitmap_to_indices with row 0 of `bits` numbered `base` (copy_if_indices
+        // feeds it one block of rows at a time).
+        inline std::size_t bitmap_to_indices_at(const std::uint64_t* bits, std::size_t n, std::uint32_t base,
+                                                std::uint32_t* out) noexcept
+        {
+            const std::size_t full = n / 64;
+            std::size_t k = 0;
+            if (auto fn = platform::bitmap_to_indices_slot()) k = fn(bits, full, base, out);
+            else k = bitmap_to_indices_portable(bits, full, base, out);
+            if (n % 64)
+                for (std::uint64_t x = bits[full] & bitmap_tail_mask(n); x != 0; x &= x - 1)
+                    out[k++] = base + static_cast<std::uint32_t>(full * 64 + static_cast<std::size_t>(std::countr_zero(x)));
+            return k;
+        }
+    } // namespace detail
+
+    template <class T, class Pred>
+    std::size_t select_bitmap(const T* first, std::size_t n, Pred pred, std::uint64_t* bits) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        static_assert(64 % W == 0, "select_bitmap: native width must divide 64");
+        std::size_t i = 0, count = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            std::uint64_t w = 0;
+            for (std::size_t j = 0; j < 64; j += W)
+                w |= mask_bits(pred(V(first + i + j, elem_aligned))) << j;
+            bits[i / 64] = w;
+            count += static_cast<std::size_t>(std::popcount(w));
+        }
+        if (i < n)
+        {
+            std::uint64_t w = 0;
+            std::size_t j = 0;
+            for (; i + j + W <= n; j += W)
+                w |= mask_bits(pred(V(first + i + j, elem_aligned))) << j;
+            for (; i + j < n; ++j)
+                w |= std::uint64_t{pred(first[i + j]) ? 1u : 0u} << j;
+            bits[i / 64] = w;
+            count += static_cast<std::size_t>(std::popcount(w));
+        }
+        return count;
+    }
+
+    template <class C, class Pred>
+    std::size_t select_bitmap(const C& c, Pred pred, std::uint64_t* bits)
+    {
+        return select_bitmap(c.data(), c.size(), pred, bits);
+    }
+
+    inline void bitmap_and(const std::uint64_t* a, const std::uint64_t* b, std::size_t n, std::uint64_t* out) noexcept
+    {
+        transform(a, b, bitmap_words(n), out, [](auto x, auto y) { return x & y; });
+    }
+
+    inline void bitmap_or(const std::uint64_t* a, const std::uint64_t* b, std::size_t n, std::uint64_t* out) noexcept
+    {
+        transform(a, b, bitmap_words(n), out, [](auto x, auto y) { return x | y; });
+    }
+
+    inline void bitmap_andnot(const std::uint64_t* a, const std::uint64_t* b, std::size_t n, std::uint64_t* out) noexcept
+    {
+        transform(a, b, bitmap_words(n), out, [](auto x, auto y) { return x & ~y; });
+    }
+
+    inline void bitmap_not(const std::uint64_t* a, std::size_t n, std::uint64_t* out) noexcept
+    {
+        const std::size_t words = bitmap_words(n);
+        transform(a, words, out, [](auto x) { return ~x; });
+        if (words != 0) out[words - 1] &= detail::bitmap_tail_mask(n);
+    }
+
+    inline std::size_t bitmap_popcount(const std::uint64_t* bits, std::size_t n) noexcept
+    {
+        const std::size_t full = n / 64;
+        std::size_t total = 0;
+        if (auto fn = platform::bitmap_popcount_slot()) total = fn(bits, full);
+        else total = detail::bitmap_popcount_portable(bits, full);
+        if (n % 64) total += static_cast<std::size_t>(std::popcount(bits[full] & detail::bitmap_tail_mask(n)));
+        return total;
+    }
+
+    inline std::size_t bitmap_to_indices(const std::uint64_t* bits, std::size_t n, std::uint32_t* out) noexcept
+    {
+        return detail::bitmap_to_indices_at(bits, n, 0, out);
+    }
+} // namespace simdtl
@@ -0,0 +1,270 @@
+#pragma once
+// ── L4: bitpack / bitunpack (fixed-width integer packing, vertical layout) ────
+// bitpack(first, n, bits, out): the low `bits` (0..32) of each uint32 value,
+// packed into uint32 words; returns the words written (= bitpack_words(n, bits)).
+// bitunpack reverses it and returns the words read. Frame-of-reference columns
+// pack x - min; higher bits of the input are ignored.
+//
+// Layout (the same on every machine, so data written by one tier reads on any
+// other): blocks of bitpack_block = 512 values laid across 16 lanes. Value j of
+// a block belongs to lane j % 16 as that lane's (j / 16)-th value; each lane
+// fills its own words LSB-first, and the block stores word k of every lane
+// together (lane l's word k at 16 k + l), so a block is 16 * bits words and
+// the k-th group of 16 consecutive values is one shift-and-mask of 16
+// consecutive words: no cross-lane movement in either direction. The last
+// n % 512 values follow as one plain LSB-first bit stream.
+//
+// Every width has its own fully unrolled code (the 32 steps of a lane are a
+// fold over compile-time shifts), chosen once per call. The fused
+// bitunpack_count_if / bitunpack_reduce / bitunpack_sum decode a block straight
+// into registers and consume it there, so a compressed column is filtered or
+// summed without materialising it.
+// Dispatch: pack / unpack blocks at AVX2 (8 lanes, two groups) and AVX-512
+// (16 lanes); the portable code runs native<uint32_t> groups.
+#include "../backend/names.hpp"
+#include "../platform/dispatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace simdtl
+{
+    inline constexpr std::size_t bitpack_block = 512;
+
+    constexpr std::size_t bitpack_words(std::size_t n, unsigned bits) noexcept
+    {
+        return n / bitpack_block * (bitpack_block / 32) * bits + ((n % bitpack_block) * bits + 31) / 32;
+    }
+
+    namespace detail
+    {
+        inline constexpr std::size_t bitpack_lanes = 16;
+
+        constexpr std::uint32_t bit_mask(unsigned bits) noexcept
+        {
+            return bits >= 32 ? 0xFFFFFFFFu : (std::uint32_t{1} << bits) - 1u;
+        }
+
+        // Calls f(std::integral_constant<unsigned, bits>{}) for a runtime bits.
+        template <class F, unsigned... B>
+        void with_bit_width(unsigned bits, F&& f, std::integer_sequence<unsigned, B...>) noexcept
+        {
+            (void)((bits == B && (f(std::integral_constant<unsigned, B>{}), true)) || ...);
+        }
+        template <class F>
+        void with_bit_width(unsigned bits, F&& f) noexcept
+        {
+            with_bit_width(bits, f, std::make_integer_sequence<unsigned, 33>{});
+        }
+
+        // Step K of one lane group: value K of each lane goes to bit K * B.
+        template <unsigned B, std::size_t K, class V>
+        SIMDTL_FORCE_INLINE void pack_step(const std::uint32_t* in, std::uint32_t* out, V& acc) noexcept
+        {
+            constexpr unsigned s = K * B % 32, w = K * B / 32;
+            V v(in + K * bitpack_lanes, elem_aligned);
+            if constexpr (B < 32) v &= V(bit_mask(B));
+            if constexpr (s == 0) acc = v;
+            else acc |= v << s;
+            if constexpr (s + B >= 32)
+            {
+                acc.copy_to(out + w * bitpack_lanes, elem_aligned);
+                if constexpr (s + B > 32) acc = v >> (32 - s);
+            }
+        }
+
+        template <unsigned B, class V, std::size_t... K>
+        void pack_lanes(const std::uint32_t* in, std::uint32_t* out, std::index_sequence<K...>) noexcept
+        {
+            V acc(0u);
+            (pack_step<B, K>(in, out, acc), ...);
+        }
+
+        // `cur` holds the lane word that value K starts in.
+        template <unsigned B, std::size_t K, class V, class Sink>
+        SIMDTL_FORCE_INLINE void unpack_step(const std::uint32_t* in, V& cur, Sink& sink) noexcept
+        {
+            constexpr unsigned s = K * B % 32, w = K * B / 32;
+            V v = cur;
+            if constexpr (s != 0) v = v >> s;
+            if constexpr (s + B >= 32 && w + 1 < B)
+            {
+                cur = V(in + (w + 1) * bitpack_lanes, elem_aligned);
+                if constexpr (s + B > 32) v |= cur << (32 - s);
+            }
+            if constexpr (B < 32) v &= V(bit_mask(B));
+            sink(K, v);
+        }
+
+        template <unsigned B, class V, class Sink, std::size_t... K>
+        void unpack_lanes(const std::uint32_t* in, Sink& sink, std::index_sequence<K...>) noexcept
+        {
+            V cur(in, elem_aligned);
+            (unpack_step<B, K>(in, cur, sink), ...);
+        }
+
+        template <unsigned B, class V>
+        void pack_blocks(const std::uint32_t* first, std::size_t blocks, std::uint32_t* out) noexcept
+        {
+            if constexpr (B > 0)
+                for (std::size_t b = 0; b < blocks; ++b)
+                    for (std::size_t g = 0; g < bitpack_lanes; g += V::size())
+                        pack_lanes<B, V>(first + b * bitpack_block + g, out + b * bitpack_lanes * B + g,
+                                         std::make_index_sequence<32>{});
+        }
+
+        // sink(i, v): v holds values i .. i + V::size() - 1 of the column.
+        template <unsigned B, class V, class Sink>
+        void unpack_blocks(const std::uint32_t* in, std::size_t blocks, Sink&& sink) noexcept
+        {
+            for (std::size_t b = 0; b < blocks; ++b)
+                for (std::size_t g = 0; g < bitpack_lanes; g += V::size())
+                {
+                    auto at = [&](std::size_t k, const V& v) { sink(b * bitpack_block + k * bitpack_lanes + g, v); };
+                    if constexpr (B == 0)
+                        for (std::size_t k = 0; k < 32; ++k) at(k, V(0u));
+                    else
+                        unpack_lanes<B, V>(in + b * bitpack_lanes * B + g, at, std::make_index_sequence<32>{});
+                }
+        }
+
+        inline void bitpack_blocks_portable(const std::uint32_t* first, std::size_t blocks, unsigned bits,
+                                            std::uint32_t* out) noexcept
+        {
+            with_bit_width(bits, [&](auto b) { pack_blocks<decltype(b)::value, native<std::uint32_t>>(first, blocks, out); });
+        }
+
+        inline void bitunpack_blocks_portable(const std::uint32_t* in, std::size_t blocks, unsigned bits,
+                                              std::uint32_t* out) noexcept
+        {
+            using V = native<std::uint32_t>;
+            with_bit_width(bits, [&](auto b) {
+                unpack_blocks<decltype(b)::value, V>(in, blocks, [&](std::size_t i, const V& v) { v.copy_to(out + i, elem_aligned); });
+            });
+        }
+
+        // The sub-block tail: one LSB-first bit stream.
+        inline std::size_t pack_tail(const std::uint32_t* first, std::size_t n, unsigned bits, std::uint32_t* out) noexcept
+        {
+            if (bits == 0) return 0;
+            const std::uint32_t mask = bit_mask(bits);
+            std::uint64_t buf = 0;
+            unsigned fill = 0;
+            std::size_t w = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                buf |= static_cast<std::uint64_t>(first[i] & mask) << fill;
+                fill += bits;
+                if (fill >= 32) { out[w++] = static_cast<std::uint32_t>(buf); buf >>= 32; fill -= 32; }
+            }
+            if (fill > 0) out[w++] = static_cast<std::uint32_t>(buf);
+            return w;
+        }
+
+        inline std::size_t unpack_tail(const std::uint32_t* in, std::size_t n, unsigned bits, std::uint32_t* out) noexcept
+        {
+            const std::uint32_t mask = bit_mask(bits);
+            std::uint64_t buf = 0;
+            unsigned have = 0;
+            std::size_t w = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (have < bits) { buf |= static_cast<std::uint64_t>(in[w++]) << have; have += 32; }
+                out[i] = static_cast<std::uint32_t>(buf) & mask;
+                buf >>= bits;
+                have -= bits;
+            }
+            return w;
+        }
+    } // namespace detail
+
+    // Precondition: bits <= 32; out has room for bitpack_words(n, bits) words.
+    inline std::size_t bitpack(const std::uint32_t* first, std::size_t n, unsigned bits, std::uint32_t* out) noexcept
+    {
+        const std::size_t blocks = n / bitpack_block, head = blocks * (bitpack_block / 32) * bits;
+        if (auto fn = platform::bitpack_slot()) fn(first, blocks, bits, out);
+        else detail::bitpack_blocks_portable(first, blocks, bits, out);
+        return head + detail::pack_tail(first + blocks * bitpack_block, n % bitpack_block, bits, out + head);
+    }
+
+    inline std::size_t bitunpack(const std::uint32_t* in, std::size_t n, unsigned bits, std::uint32_t* out) noexcept
+    {
+        const std::size_t blocks = n / bitpack_block, head = blocks * (bitpack_block / 32) * bits;
+        if (auto fn = platform::bitunpack_slot()) fn(in, blocks, bits, out);
+        else detail::bitunpack_blocks_portable(in, blocks, bits, out);
+        return head + detail::unpack_tail(in + head, n % bitpack_block, bits, out + blocks * bitpack_block);
+    }
+
+    // count_if over the n packed values; `pred` is ELEMENTAL on uint32_t.
+    template <class Pred>
+    std::size_t bitunpack_count_if(const std::uint32_t* in, std::size_t n, unsigned bits, Pred pred) noexcept
+    {
+        using V = native<std::uint32_t>;
+        const std::size_t blocks = n / bitpack_block, head = blocks * (bitpack_block / 32) * bits;
+        std::size_t total = 0;
+        detail::with_bit_width(bits, [&](auto b) {
+            detail::unpack_blocks<decltype(b)::value, V>(in, blocks, [&](std::size_t, const V& v) {
+                total += static_cast<std::size_t>(lane_count(pred(v)));
+            });
+        });
+        std::uint32_t tail[bitpack_block];
+        const std::size_t r = n % bitpack_block;
+        detail::unpack_tail(in + head, r, bits, tail);
+        for (std::size_t i = 0; i < r; ++i) total += pred(tail[i]) ? std::size_t{1} : std::size_t{0};
+        return total;
+    }
+
+    // reduce over the n packed values with an ELEMENTAL, associative and
+    // commutative op (as reduce(first, n, init, op)).
+    template <class Op>
+    std::uint32_t bitunpack_reduce(const std::uint32_t* in, std::size_t n, unsigned bits, std::uint32_t init, Op op) noexcept
+    {
+        using V = native<std::uint32_t>;
+        const std::size_t blocks = n / bitpack_block, head = blocks * (bitpack_block / 32) * bits;
+        std::uint32_t result = init;
+        if (blocks > 0)
+        {
+            V acc(0u);
+            bool started = false;
+            detail::with_bit_width(bits, [&](auto b) {
+                detail::unpack_blocks<decltype(b)::value, V>(in, blocks, [&](std::size_t, const V& v) {
+                    if (started) acc = op(acc, v);
+                    else { acc = v; started = true; }
+                });
+            });
+            for (std::size_t j = 0; j < V::size(); ++j) result = op(result, static_cast<std::uint32_t>(acc[j]));
+        }
+        std::uint32_t tail[bitpack_block];
+        const std::size_t r = n % bitpack_block;
+        detail::unpack_tail(in + head, r, bits, tail);
+        for (std::size_t i = 0; i < r; ++i) result = op(result, tail[i]);
+        return result;
+    }
+
+    // The 64-bit sum of the n packed values (never overflows): per block, the
+    // low and high halves of the values are summed in separate 32-bit lanes.
+    inline std::uint64_t bitunpack_sum(const std::uint32_t* in, std::size_t n, unsigned bits) noexcept
+    {
+        using V = native<std::uint32_t>;
+        const std::size_t blocks = n / bitpack_block, head = blocks * (bitpack_block / 32) * bits;
+        std::uint64_t total = 0;
+        detail::with_bit_width(bits, [&](auto b) {
+            for (std::size_t k = 0; k < blocks; ++k)
+            {
+                V lo(0u), hi(0u);
+                detail::unpack_blocks<decltype(b)::value, V>(in + k * (bitpack_block / 32) * bits, 1,
+                                                             [&](std::size_t, const V& v) {
+                                                                 lo += v & V(0xFFFFu);
+                                                                 hi += v >> 16;
+                                                             });
+                total += hsum(lo) + (static_cast<std::uint64_t>(hsum(hi)) << 16);
+            }
+        });
+        std::uint32_t tail[bitpack_block];
+        const std::size_t r = n % bitpack_block;
+        detail::unpack_tail(in + head, r, bits, tail);
+        for (std::size_t i = 0; i < r; ++i) total += tail[i];
+        return total;
+    }
+} // namespace simdtl
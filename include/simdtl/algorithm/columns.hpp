@@ -0,0 +1,146 @@
+#pragma once
+// ── L4: fused multi-column filters (several columns, one predicate, one pass) ─
+//   columns(a, b, c)                               a row view over parallel arrays
+//   count_if(columns(a, b, c), n, pred)            rows with pred(a[i], b[i], c[i])
+//   select_bitmap(columns(a, b, c), n, pred, bits) bit i = pred(a[i], b[i], c[i])
+//   copy_if_indices(columns(a, b, c), n, out_idx, pred)   their uint32 row ids
+// so `a > 5 && b < 3 && c == 7` is one pass over three columns instead of a
+// select_bitmap per column plus word ANDs. The columns may have different
+// element types: each step loads the same W rows of every column as vec<T, W>
+// (W = the widest native lane count among them, as in transform<In, Out>) and
+// calls pred on the vectors, then on scalars for the tail. Each column's
+// compares yield a mask of that column's type, so combine them with
+// mask_and / mask_or, which convert to one mask type first (masks of equal
+// element type also combine with && / || directly):
+//   [](auto a, auto b, auto c) {
+//       using A = decltype(a); using B = decltype(b); using C = decltype(c);
+//       return simdtl::mask_and(a > A(5), b < B(3), c == C(7));
+//   }
+// The result leaves the registers with mask_bits, 64 rows per word; the id form
+// runs in 1024-row blocks through the dispatched bitmap_to_indices, so
+// `out_idx` needs room for n ids and n must fit in uint32.
+#include "../backend/names.hpp"
+#include "bitmap.hpp"
+#include "copy_if.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace simdtl
+{
+    template <class... Ts>
+    struct column_set
+    {
+        std::tuple<const Ts*...> cols;
+    };
+
+    template <class... Ts>
+    constexpr column_set<Ts...> columns(const Ts*... cols) noexcept
+    {
+        static_assert(sizeof...(Ts) > 0, "columns: needs at least one column");
+        return column_set<Ts...>{{cols...}};
+    }
+
+    // Lane-wise AND / OR of masks that may differ in element type (equal lane
+    // count). The result is the common type when all match, else a fixed_size
+    // mask; on bools (the scalar tail) they are && / ||.
+    template <class M, class... Ms>
+    auto mask_and(const M& m, const Ms&... ms) noexcept
+    {
+        if constexpr (std::is_same_v<M, bool> || (std::is_same_v<M, Ms> && ...)) return (m && ... && ms);
+        else
+        {
+            using R = typename fixed<std::uint8_t, M::size()>::mask_type;
+            return (mask_cast<R>(m) && ... && mask_cast<R>(ms));
+        }
+    }
+
+    template <class M, class... Ms>
+    auto mask_or(const M& m, const Ms&... ms) noexcept
+    {
+        if constexpr (std::is_same_v<M, bool> || (std::is_same_v<M, Ms> && ...)) return (m || ... || ms);
+        else
+        {
+            using R = typename fixed<std::uint8_t, M::size()>::mask_type;
+            return (mask_cast<R>(m) || ... || mask_cast<R>(ms));
+        }
+    }
+
+    namespace detail
+    {
+        // Lanes per step across the columns: the widest native vector count.
+        template <class... Ts>
+        inline constexpr std::size_t columns_width = std::max({native<Ts>::size()...});
+
+        // Bits [0, rows) of the word for rows [i, i + rows): a whole word of
+        // vectors when Full, else the last word (rows < 64, scalar tail).
+        template <bool Full, class Pred, class... Ts, std::size_t... I>
+        std::uint64_t columns_word(const column_set<Ts...>& cs, std::size_t i, std::size_t rows, Pred& pred,
+                                   std::index_sequence<I...>) noexcept
+        {
+            constexpr std::size_t W = columns_width<Ts...>;
+            std::uint64_t w = 0;
+            std::size_t j = 0;
+            for (; j + W <= rows; j += W)
+                w |= mask_bits(pred(vec<Ts, W>(std::get<I>(cs.cols) + i + j, elem_aligned)...)) << j;
+            if constexpr (!Full)
+                for (; j < rows; ++j)
+                    w |= std::uint64_t{pred(std::get<I>(cs.cols)[i + j]...) ? 1u : 0u} << j;
+            return w;
+        }
+    } // namespace detail
+
+    template <class... Ts, class Pred>
+    std::size_t select_bitmap(const column_set<Ts...>& cs, std::size_t n, Pred pred, std::uint64_t* bits) noexcept
+    {
+        static_assert(64 % detail::columns_width<Ts...> == 0, "select_bitmap: native width must divide 64");
+        constexpr auto I = std::index_sequence_for<Ts...>{};
+        std::size_t i = 0, count = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            const std::uint64_t w = detail::columns_word<true>(cs, i, 64, pred, I);
+            bits[i / 64] = w;
+            count += static_cast<std::size_t>(std::popcount(w));
+        }
+        if (i < n)
+        {
+            const std::uint64_t w = detail::columns_word<false>(cs, i, n - i, pred, I);
+            bits[i / 64] = w;
+            count += static_cast<std::size_t>(std::popcount(w));
+        }
+        return count;
+    }
+
+    template <class... Ts, class Pred>
+    std::size_t count_if(const column_set<Ts...>& cs, std::size_t n, Pred pred) noexcept
+    {
+        static_assert(64 % detail::columns_width<Ts...> == 0, "count_if: native width must divide 64");
+        constexpr auto I = std::index_sequence_for<Ts...>{};
+        std::size_t i = 0, count = 0;
+        for (; i + 64 <= n; i += 64)
+            count += static_cast<std::size_t>(std::popcount(detail::columns_word<true>(cs, i, 64, pred, I)));
+        if (i < n)
+            count += static_cast<std::size_t>(std::popcount(detail::columns_word<false>(cs, i, n - i, pred, I)));
+        return count;
+    }
+
+    template <class... Ts, class Pred>
+    std::size_t copy_if_indices(const column_set<Ts...>& cs, std::size_t n, std::uint32_t* out_idx, Pred pred) noexcept
+    {
+        std::uint64_t bits[detail::select_block / 64];
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < n; i += detail::select_block)
+        {
+            const std::size_t c = n - i < detail::select_block ? n - i : detail::select_block;
+            const column_set<Ts...> block{std::apply([i](auto... p) { return std::tuple<const Ts*...>{p + i...}; },
+                                                     cs.cols)};
+            select_bitmap(block, c, pred, bits);
+            k += detail::bitmap_to_indices_at(bits, c, static_cast<std::uint32_t>(i), out_idx + k);
+        }
+        return k;
+    }
+} // namespace simdtl
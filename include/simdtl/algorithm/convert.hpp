@@ -0,0 +1,231 @@
+#pragma once
+// ── L4: convert / convert_saturate / convert_round (element type conversion) ──
+// convert(first, n, out): out[i] = static_cast<Out>(first[i]) — integer
+//   narrowing wraps, float -> int truncates (and must be in range, as for the
+//   cast).
+// convert_saturate: values outside Out's range clamp to its min / max instead;
+//   float -> int truncates toward zero and NaN becomes 0, double -> float clamps
+//   to +-FLT_MAX (NaN stays NaN).
+// convert_round: float -> int rounding to nearest (ties to even, the default
+//   FP rounding mode), saturating like convert_saturate.
+// All three run through the type-converting transform (vec<T, W> at the wider
+// lane count), so any arithmetic pair works. The hot pairs have
+// dispatched pack / unpack kernels:
+//   saturate int32 -> int16 / uint8, int16 -> int8 / uint8   (vpackss / vpackus;
+//                                                              AVX-512 vpmovs*)
+//   convert  uint8 -> float                                   (vpmovzxbd + vcvtdq2ps)
+//   round    float -> int32 / uint8                           (vcvtps2dq + fix-ups)
+#include "../backend/names.hpp"
+#include "../platform/dispatch.hpp"
+#include "transform.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // Out's range as In values, for integral In / Out: clamping to these in
+        // In before the cast is exact.
+        template <class In, class Out>
+        constexpr In saturate_lo() noexcept
+        {
+            return std::cmp_less(std::numeric_limits<Out>::min(), std::numeric_limits<In>::min())
+                       ? std::numeric_limits<In>::min() : static_cast<In>(std::numeric_limits<Out>::min());
+        }
+        template <class In, class Out>
+        constexpr In saturate_hi() noexcept
+        {
+            return std::cmp_greater(std::numeric_limits<Out>::max(), std::numeric_limits<In>::max())
+                       ? std::numeric_limits<In>::max() : static_cast<In>(std::numeric_limits<Out>::max());
+        }
+
+        // Float In -> integral Out: the first value too large for Out, 2^digits
+        // (exact in any float type, unlike Out's max itself).
+        template <class In, class Out>
+        In saturate_limit() noexcept
+        {
+            return std::ldexp(In(1), std::numeric_limits<Out>::digits);
+        }
+
+        template <class Out, class In>
+        Out saturate_one(In x) noexcept
+        {
+            if constexpr (std::is_floating_point_v<In> && std::is_integral_v<Out>)
+            {
+                if (!(x == x)) return Out(0);
+                if (x >= saturate_limit<In, Out>()) return std::numeric_limits<Out>::max();
+                if (x < static_cast<In>(std::numeric_limits<Out>::min())) return std::numeric_limits<Out>::min();
+                return static_cast<Out>(x);
+            }
+            else if constexpr (std::is_integral_v<In> && std::is_integral_v<Out>)
+            {
+                constexpr In lo = saturate_lo<In, Out>(), hi = saturate_hi<In, Out>();
+                return static_cast<Out>(x < lo ? lo : hi < x ? hi : x);
+            }
+            else if constexpr (std::is_floating_point_v<In> && std::is_floating_point_v<Out> && (sizeof(Out) < sizeof(In)))
+            {
+                constexpr In hi = static_cast<In>(std::numeric_limits<Out>::max());
+                return static_cast<Out>(x < -hi ? -hi : hi < x ? hi : x);
+            }
+            else
+            {
+                return static_cast<Out>(x);   // every In value fits (int -> float rounds)
+            }
+        }
+
+        // The lane-wise form of saturate_one: W lanes of In -> W lanes of Out.
+        template <class Out, class V>
+        auto saturate_lanes(V v) noexcept
+        {
+            using In = typename V::value_type;
+            using R = decltype(lane_cast<Out>(v));
+            if constexpr (std::is_floating_point_v<In> && std::is_integral_v<Out>)
+            {
+                // Zero the out-of-range / NaN lanes so the cast is defined, then
+                // patch them from flags carried across as values.
+                const auto nan = !(v == v);
+                const auto hi = v >= V(saturate_limit<In, Out>());
+                const auto lo = v < V(static_cast<In>(std::numeric_limits<Out>::min()));
+                where(nan || hi || lo, v) = In(0);
+                R r = lane_cast<Out>(v);
+                V flag(In(0));
+                where(hi, flag) = In(1);
+                if constexpr (std::is_signed_v<Out>) where(lo, flag) = In(-1);   // unsigned: 0 already
+                const R f = lane_cast<Out>(flag);
+                where(f == R(Out(1)), r) = std::numeric_limits<Out>::max();
+                if constexpr (std::is_signed_v<Out>) where(f == R(Out(-1)), r) = std::numeric_limits<Out>::min();
+                return r;
+            }
+            else if constexpr (std::is_integral_v<In> && std::is_integral_v<Out>)
+            {
+                constexpr In lo = saturate_lo<In, Out>(), hi = saturate_hi<In, Out>();
+                if constexpr (lo != std::numeric_limits<In>::min()) v = elem_max(v, V(lo));
+                if constexpr (hi != std::numeric_limits<In>::max()) v = elem_min(v, V(hi));
+                return lane_cast<Out>(v);
+            }
+            else if constexpr (std::is_floating_point_v<In> && std::is_floating_point_v<Out> && (sizeof(Out) < sizeof(In)))
+            {
+                const In hi = static_cast<In>(std::numeric_limits<Out>::max());
+                where(v > V(hi), v) = hi;
+                where(v < V(-hi), v) = -hi;
+                return lane_cast<Out>(v);
+            }
+            else
+            {
+                return lane_cast<Out>(v);
+            }
+        }
+
+        // Elemental: saturate_lanes on vectors, saturate_one on scalars.
+        template <class Out>
+        struct saturate_op
+        {
+            template <class X>
+            auto operator()(const X& x) const noexcept
+            {
+                if constexpr (std::is_arithmetic_v<X>) return saturate_one<Out>(x);
+                else return saturate_lanes<Out>(x);
+            }
+        };
+
+        // Round half to even, lane-wise, without a rounding instruction (the
+        // baseline has none): below 2^(digits-1), |x| + 2^(digits-1) has no
+        // fraction bits left, so the add rounds |x| in the FP unit's default
+        // mode and subtracting the constant back is exact. Larger values (and
+        // NaN) are already integral and pass through.
+        template <class V>
+        V round_even_lanes(const V& x) noexcept
+        {
+            using T = typename V::value_type;
+            const V big(std::ldexp(T(1), std::numeric_limits<T>::digits - 1));
+            const auto neg = x < V(T(0));
+            V a = x;
+            where(neg, a) = -x;
+            V r = (a + big) - big;
+            where(!(a < big), r) = a;
+            where(neg, r) = -r;
+            return r;
+        }
+
+        template <class Out>
+        struct round_op
+        {
+            template <class X>
+            auto operator()(const X& x) const noexcept
+            {
+                if constexpr (std::is_arithmetic_v<X>) return saturate_one<Out>(std::rint(x));
+                else return saturate_lanes<Out>(round_even_lanes(x));
+            }
+        };
+
+        template <class In, class Out>
+        void convert_portable(const In* first, std::size_t n, Out* out) noexcept
+        {
+            transform(first, n, out, [](auto x) { return x; });
+        }
+
+        template <class In, class Out>
+        void convert_saturate_portable(const In* first, std::size_t n, Out* out) noexcept
+        {
+            transform(first, n, out, saturate_op<Out>{});
+        }
+
+        template <class In, class Out>
+        void convert_round_portable(const In* first, std::size_t n, Out* out) noexcept
+        {
+            transform(first, n, out, round_op<Out>{});
+        }
+    } // namespace detail
+
+    template <class In, class Out>
+    void convert(const In* first, std::size_t n, Out* out) noexcept
+    {
+        if constexpr (std::is_same_v<In, std::uint8_t> && std::is_same_v<Out, float>)
+        {
+            if (auto fn = platform::convert_u8_f32_slot()) return fn(first, n, out);
+        }
+        detail::convert_portable(first, n, out);
+    }
+
+    template <class In, class Out>
+    void convert_saturate(const In* first, std::size_t n, Out* out) noexcept
+    {
+        if constexpr (std::is_same_v<In, std::int32_t> && std::is_same_v<Out, std::int16_t>)
+        {
+            if (auto fn = platform::convert_sat_i32_i16_slot()) return fn(first, n, out);
+        }
+        else if constexpr (std::is_same_v<In, std::int32_t> && std::is_same_v<Out, std::uint8_t>)
+        {
+            if (auto fn = platform::convert_sat_i32_u8_slot()) return fn(first, n, out);
+        }
+        else if constexpr (std::is_same_v<In, std::int16_t> && std::is_same_v<Out, std::int8_t>)
+        {
+            if (auto fn = platform::convert_sat_i16_i8_slot()) return fn(first, n, out);
+        }
+        else if constexpr (std::is_same_v<In, std::int16_t> && std::is_same_v<Out, std::uint8_t>)
+        {
+            if (auto fn = platform::convert_sat_i16_u8_slot()) return fn(first, n, out);
+        }
+        detail::convert_saturate_portable(first, n, out);
+    }
+
+    template <class In, class Out>
+    void convert_round(const In* first, std::size_t n, Out* out) noexcept
+    {
+        static_assert(std::is_floating_point_v<In> && std::is_integral_v<Out>, "convert_round is float -> integer");
+        if constexpr (std::is_same_v<In, float> && std::is_same_v<Out, std::int32_t>)
+        {
+            if (auto fn = platform::convert_round_f32_i32_slot()) return fn(first, n, out);
+        }
+        else if constexpr (std::is_same_v<In, float> && std::is_same_v<Out, std::uint8_t>)
+        {
+            if (auto fn = platform::convert_round_f32_u8_slot()) return fn(first, n, out);
+        }
+        detail::convert_round_portable(first, n, out);
+    }
+} // namespace simdtl
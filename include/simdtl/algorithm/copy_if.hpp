@@ -1,12 +1,28 @@
 #pragma once
-// ── L4: copy_if / remove_if / remove (built on stream compaction) ─────────────
+// ── L4: copy_if / remove_if / remove / unique (built on stream compaction) ─────
 // The generic predicate forms are portable (std::simd mask + compress_store). The
-// concrete remove(value) routes through a dispatched AVX2 compaction kernel for
-// int32 (LUT + vpermd), falling back to the portable path everywhere else. This is
-// the algorithm family std::simd cannot express on its own.
+// concrete remove(value) and unique() route through dispatched compaction kernels
+// for integers (AVX2 LUT + vpermd/pshufb, AVX-512 vpcompress), falling back to the
+// portable path everywhere else. This is the algorithm family std::simd cannot
+// express on its own.
+// copy_if_indices is the selection-vector form for late materialisation: it
+// emits the uint32 row ids of the kept elements (or refines an existing id list)
+// instead of their values. Each block of 1024 rows becomes a row bitmap
+// (select_bitmap) that the dispatched kernels unpack — iota + base through the
+// LUT / vpcompressd of bitmap_to_indices, the refined ids through the
+// compress_bits_i32 left-pack (remove_i32's LUT + vpermd, vpcompressd).
+// copy_if / remove_if given a predicate from predicates.hpp (eq, lt, between,
+// in_set, ...) route through the dispatched compare + compress filter kernels.
+// copy_if_zip / remove_if_zip filter a key column and drop the same rows from
+// parallel payload columns: one row bitmap per block of keys, applied to every
+// column by the compress_bits kernels (4- and 8-byte rows; others portable).
 #include "../backend/names.hpp"
 #include "../crosslane/compress.hpp"
 #include "../platform/dispatch.hpp"
+#include "bitmap.hpp"
+#include "gather.hpp"
+#include "predicates.hpp"
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -18,6 +34,10 @@ namespace simdtl
     template <class T, class Pred>
     std::size_t copy_if(const T* first, std::size_t n, T* out, Pred pred) noexcept
     {
+        if constexpr (detail::filter_routable_v<T, Pred>)
+        {
+            if (detail::filter_slot<detail::filter_key_t<T>>()) return detail::run_filter(first, n, pred, false, out);
+        }
         using V = native<T>;
         constexpr std::size_t W = V::size();
         std::size_t i = 0, k = 0;
@@ -31,10 +51,148 @@ namespace simdtl
         return k;
     }
 
+    namespace detail
+    {
+        inline constexpr std::size_t select_block = 1024;   // rows per bitmap block (16 words)
+
+        template <class T>
+        std::size_t compress_bits_portable(const T* src, std::size_t n, const std::uint64_t* bits, T* out) noexcept
+        {
+            std::size_t k = 0;
+            for (std::size_t w = 0; w * 64 < n; ++w)
+            {
+                std::uint64_t x = n - w * 64 < 64 ? bits[w] & bitmap_tail_mask(n) : bits[w];
+                for (; x != 0; x &= x - 1) out[k++] = src[w * 64 + static_cast<std::size_t>(std::countr_zero(x))];
+            }
+            return k;
+        }
+
+        // out[k++] = src[i] for every set bit i < n; out may alias src (or sit
+        // below it). 4- and 8-byte T go through the dispatched kernels, which
+        // store whole registers below out + n.
+        template <class T>
+        std::size_t compress_bits(const T* src, std::size_t n, const std::uint64_t* bits, T* out) noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "compress_bits: T must be trivially copyable");
+            const std::size_t full = n / 64;
+            std::size_t k = 0;
+            if constexpr (sizeof(T) == 4)
+            {
+                if (auto fn = platform::compress_bits_i32_slot())
+                    k = fn(reinterpret_cast<const std::int32_t*>(src), full, bits, reinterpret_cast<std::int32_t*>(out));
+                else
+                    k = compress_bits_portable(src, full * 64, bits, out);
+            }
+            else if constexpr (sizeof(T) == 8)
+            {
+                if (auto fn = platform::compress_bits_i64_slot())
+                    k = fn(reinterpret_cast<const std::int64_t*>(src), full, bits, reinterpret_cast<std::int64_t*>(out));
+                else
+                    k = compress_bits_portable(src, full * 64, bits, out);
+            }
+            else
+                k = compress_bits_portable(src, full * 64, bits, out);
+            return k + compress_bits_portable(src + full * 64, n % 64, bits + full, out + k);
+        }
+    } // namespace detail
+
+    // copy_if_indices: out_idx[k++] = i for every i with pred(first[i]); returns k.
+    // `out_idx` needs room for n ids (the kernels store whole registers below
+    // that bound); n must fit in uint32.
+    template <class T, class Pred>
+    std::size_t copy_if_indices(const T* first, std::size_t n, std::uint32_t* out_idx, Pred pred) noexcept
+    {
+        std::uint64_t bits[detail::select_block / 64];
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < n; i += detail::select_block)
+        {
+            const std::size_t c = n - i < detail::select_block ? n - i : detail::select_block;
+            select_bitmap(first + i, c, pred, bits);
+            k += detail::bitmap_to_indices_at(bits, c, static_cast<std::uint32_t>(i), out_idx + k);
+        }
+        return k;
+    }
+
+    // Refining form: keep the ids sel[j] (j < m) with pred(first[sel[j]]), in
+    // order; returns the count. `out_idx` may alias `sel` (needs room for m).
+    // The values are fetched by take's gather kernels, so ids must be below 2^31.
+    template <class T, class Pred>
+    std::size_t copy_if_indices(const T* first, const std::uint32_t* sel, std::size_t m, std::uint32_t* out_idx,
+                                Pred pred) noexcept
+    {
+        T vals[detail::select_block];
+        std::uint64_t bits[detail::select_block / 64];
+        std::size_t k = 0;
+        for (std::size_t j = 0; j < m; j += detail::select_block)
+        {
+            const std::size_t c = m - j < detail::select_block ? m - j : detail::select_block;
+            take(first, sel + j, c, vals);
+            select_bitmap(vals, c, pred, bits);
+            k += detail::compress_bits(sel + j, c, bits, out_idx + k);
+        }
+        return k;
+    }
+
+    // A payload column for copy_if_zip: rows of `src` kept alongside the keys
+    // are written to `dst`.
+    template <class T>
+    struct payload_column
+    {
+        const T* src;
+        T* dst;
+    };
+
+    template <class T>
+    constexpr payload_column<T> payload(const T* src, T* dst) noexcept { return {src, dst}; }
+
+    // copy_if_zip: copy the rows with pred(keys[i]) from the key column and from
+    // every payload column, in order; returns the count. The mask is evaluated
+    // once per 1024-row block of keys and the same row bitmap compacts each
+    // column while the block is in cache. keys_out and each payload dst need
+    // room for n rows (the kernels store whole registers below that bound).
+    // Compaction reads every row, so for sparse selections (under ~30% kept)
+    // copy_if_indices + take per column touches less.
+    template <class K, class Pred, class... Ts>
+    std::size_t copy_if_zip(const K* keys, std::size_t n, K* keys_out, Pred pred, payload_column<Ts>... payloads) noexcept
+    {
+        std::uint64_t bits[detail::select_block / 64];
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < n; i += detail::select_block)
+        {
+            const std::size_t c = n - i < detail::select_block ? n - i : detail::select_block;
+            select_bitmap(keys + i, c, pred, bits);
+            (detail::compress_bits(payloads.src + i, c, bits, payloads.dst + k), ...);
+            k += detail::compress_bits(keys + i, c, bits, keys_out + k);
+        }
+        return k;
+    }
+
+    // remove_if_zip: drop the rows with pred(keys[i]) from the key column and
+    // from every payload column, in place; returns the new length.
+    template <class K, class Pred, class... Ts>
+    std::size_t remove_if_zip(K* keys, std::size_t n, Pred pred, Ts*... payloads) noexcept
+    {
+        const auto keep = [&pred](const auto& x) { return !pred(x); };
+        std::uint64_t bits[detail::select_block / 64];
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < n; i += detail::select_block)
+        {
+            const std::size_t c = n - i < detail::select_block ? n - i : detail::select_block;
+            select_bitmap(keys + i, c, keep, bits);
+            (detail::compress_bits(payloads + i, c, bits, payloads + k), ...);   // k <= i: stores stay behind reads
+            k += detail::compress_bits(keys + i, c, bits, keys + k);
+        }
+        return k;
+    }
+
     // remove_if: in-place compaction keeping !pred; returns the new logical length.
     template <class T, class Pred>
     std::size_t remove_if(T* first, std::size_t n, Pred pred) noexcept
     {
+        if constexpr (detail::filter_routable_v<T, Pred>)
+        {
+            if (detail::filter_slot<detail::filter_key_t<T>>()) return detail::run_filter(first, n, pred, true, first);
+        }
         using V = native<T>;
         constexpr std::size_t W = V::size();
         std::size_t i = 0, k = 0;
@@ -78,22 +236,103 @@ namespace simdtl
         return k;
     }
 
+    namespace detail
+    {
+        // Equality-only kernels are sign-agnostic: any integral T of the kernel's
+        // width may route through it (bool excluded — not layout-compatible).
+        template <class T, class K>
+        inline constexpr bool same_width_int_v =
+            std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) == sizeof(K);
+
+        // Portable unique: keep lane j iff it differs from the element before it,
+        // fetched by an unaligned load one element back. In place this is safe
+        // because compress_store writes exactly the kept lanes: the slot at i-1 is
+        // only ever rewritten with its own value (k == i) or not at all (k < i).
+        template <class T>
+        std::size_t unique_portable(T* first, std::size_t n) noexcept
+        {
+            if (n == 0) return 0;
+            using V = native<T>;
+            constexpr std::size_t W = V::size();
+            std::size_t i = 1, k = 1;
+            for (; i + W <= n; i += W)
+            {
+                const V cur(first + i, elem_aligned);
+                k += compress_store(first + k, cur, cur != V(first + i - 1, elem_aligned));
+            }
+            for (; i < n; ++i)
+                if (!(first[i] == first[i - 1])) first[k++] = first[i];
+            return k;
+        }
+    } // namespace detail
+
     // unique: drop consecutive duplicates in place; return the new logical length
-    // (std::unique semantics). Sequential by nature; compares each element to the
-    // ORIGINAL predecessor (kept in `prev`) so in-place writes don't corrupt it.
+    // (std::unique semantics). Each vector is compared with its one-lane-shifted
+    // predecessor and the survivors are compacted — dispatched AVX2/AVX-512 kernels
+    // for 1/2/4/8-byte integers, the portable compress_store path otherwise.
     template <class T>
     std::size_t unique(T* first, std::size_t n) noexcept
     {
-        if (n == 0) return 0;
-        std::size_t k = 1;
-        T prev = first[0];
-        for (std::size_t i = 1; i < n; ++i)
+        if constexpr (detail::same_width_int_v<T, std::int64_t>)
         {
-            const T cur = first[i];
-            if (!(cur == prev)) first[k++] = cur;
-            prev = cur;
+            if (auto fn = platform::unique_i64_slot()) return fn(reinterpret_cast<std::int64_t*>(first), n);
         }
-        return k;
+        else if constexpr (detail::same_width_int_v<T, std::int32_t>)
+        {
+            if (auto fn = platform::unique_i32_slot()) return fn(reinterpret_cast<std::int32_t*>(first), n);
+        }
+        else if constexpr (detail::same_width_int_v<T, std::int16_t>)
+        {
+            if (auto fn = platform::unique_i16_slot()) return fn(reinterpret_cast<std::int16_t*>(first), n);
+        }
+        else if constexpr (detail::same_width_int_v<T, std::int8_t>)
+        {
+            if (auto fn = platform::unique_i8_slot()) return fn(reinterpret_cast<std::int8_t*>(first), n);
+        }
+        return detail::unique_portable(first, n);
+    }
+
+    // adjacent_find: first i with first[i] == first[i+1] (or pred(first[i],
+    // first[i+1]) for the elemental binary-predicate form); first+n if none.
+    template <class T, class Pred>
+    const T* adjacent_find(const T* first, std::size_t n, Pred pred) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        if (n < 2) return first + n;
+        std::size_t i = 0;
+        for (; i + 1 + W <= n; i += W)
+        {
+            const auto m = pred(V(first + i, elem_aligned), V(first + i + 1, elem_aligned));
+            if (any_of(m))
+                return first + i + static_cast<std::size_t>(find_first(m));
+        }
+        for (; i + 1 < n; ++i)
+            if (pred(first[i], first[i + 1]))
+                return first + i;
+        return first + n;
+    }
+
+    template <class T>
+    const T* adjacent_find(const T* first, std::size_t n) noexcept
+    {
+        return adjacent_find(first, n, [](auto a, auto b) { return a == b; });
+    }
+
+    // count_runs: number of maximal runs of equal elements (== unique's result
+    // length, without writing anything).
+    template <class T>
+    std::size_t count_runs(const T* first, std::size_t n) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        if (n == 0) return 0;
+        std::size_t i = 1, runs = 1;
+        for (; i + W <= n; i += W)
+            runs += static_cast<std::size_t>(lane_count(V(first + i, elem_aligned) != V(first + i - 1, elem_aligned)));
+        for (; i < n; ++i)
+            runs += (first[i] == first[i - 1]) ? std::size_t{0} : std::size_t{1};
+        return runs;
     }
 
     // partition: rearrange so all pred-true elements come first; return the
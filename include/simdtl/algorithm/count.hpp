@@ -4,10 +4,13 @@
 // (Note: lane_count == popcount(mask) returns the LANE count directly — the old
 // library's movemask+popcnt-then-divide-by-sizeof correction is gone.)
 // Fast path: for std::int32_t, route through the runtime dispatch slot if a kernel
-// is installed; otherwise the portable path runs everywhere.
+// is installed; otherwise the portable path runs everywhere. count_if given a
+// predicate from predicates.hpp (eq, lt, between, in_set, ...) runs the
+// dispatched filter kernel in count-only mode.
 #include "../backend/names.hpp"
 #include "../detail/driver.hpp"
 #include "../platform/dispatch.hpp"
+#include "predicates.hpp"
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -60,6 +63,10 @@ namespace simdtl
     template <class T, class Pred>
     std::size_t count_if(const T* first, std::size_t n, Pred pred) noexcept
     {
+        if constexpr (detail::filter_routable_v<T, Pred>)
+        {
+            if (detail::filter_slot<detail::filter_key_t<T>>()) return detail::run_filter(first, n, pred, false, static_cast<T*>(nullptr));
+        }
         using V = native<T>;
         std::size_t total = 0;
         detail::for_each_chunk<T>(
@@ -0,0 +1,87 @@
+#pragma once
+// ── L4: delta_encode / delta_decode, zigzag_encode / zigzag_decode ────────────
+//   delta_encode: out[i] = first[i] - first[i-1]     (first[-1] = init)
+//   delta_decode: out[i] = init + first[0] + ... + first[i]   (= inclusive_scan)
+// so delta_decode(delta_encode(x, init), init) == x. Integral T; differences
+// wrap as two's complement. delta_encode subtracts two overlapping loads
+// (x[i..i+W) - x[i-1..i+W-1)) walking from the END, so `out` may alias `first`
+// (every load lies below the stores already made); delta_decode is the
+// dispatched prefix sum of scan.hpp and may alias too.
+//
+// zigzag maps signed to unsigned so small magnitudes stay small
+// (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...): u = (x << 1) ^ (x >> (bits - 1)),
+// x = (u >> 1) ^ -(u & 1). Use it between delta_encode and a varint coder when
+// the sequence is not monotone (see streamvbyte.hpp).
+#include "../backend/names.hpp"
+#include "scan.hpp"
+#include "transform.hpp"
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        template <class T>
+        struct zigzag_encode_op
+        {
+            template <class X>
+            auto operator()(const X& x) const noexcept
+            {
+                using U = std::make_unsigned_t<T>;
+                constexpr int top = std::numeric_limits<U>::digits - 1;
+                return (lane_cast<U>(x) << 1) ^ lane_cast<U>(x >> top);
+            }
+        };
+
+        template <class U>
+        struct zigzag_decode_op
+        {
+            template <class X>
+            auto operator()(const X& u) const noexcept
+            {
+                return (u >> 1) ^ (U{0} - (u & U{1}));
+            }
+        };
+    } // namespace detail
+
+    template <class T>
+    void delta_encode(const T* first, std::size_t n, T* out, T init = T{}) noexcept
+    {
+        static_assert(std::is_integral_v<T>, "delta_encode: integral element type");
+        using U = std::make_unsigned_t<T>;
+        auto sub = [](T a, T b) { return static_cast<T>(static_cast<U>(a) - static_cast<U>(b)); };
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        std::size_t i = n;
+        for (; i > W; i -= W)   // [i-W, i) from first[i-W-1 .. i-1)
+        {
+            const V cur(first + i - W, elem_aligned), prev(first + i - W - 1, elem_aligned);
+            (cur - prev).copy_to(out + i - W, elem_aligned);
+        }
+        for (; i > 1; --i) out[i - 1] = sub(first[i - 1], first[i - 2]);
+        if (n != 0) out[0] = sub(first[0], init);
+    }
+
+    template <class T>
+    void delta_decode(const T* first, std::size_t n, T* out, T init = T{}) noexcept
+    {
+        static_assert(std::is_integral_v<T>, "delta_decode: integral element type");
+        inclusive_scan(first, n, out, init);
+    }
+
+    template <class T>
+    void zigzag_encode(const T* first, std::size_t n, std::make_unsigned_t<T>* out) noexcept
+    {
+        static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "zigzag_encode: signed integral input");
+        transform(first, n, out, detail::zigzag_encode_op<T>{});
+    }
+
+    template <class U>
+    void zigzag_decode(const U* first, std::size_t n, std::make_signed_t<U>* out) noexcept
+    {
+        static_assert(std::is_integral_v<U> && std::is_unsigned_v<U>, "zigzag_decode: unsigned integral input");
+        transform(first, n, out, detail::zigzag_decode_op<U>{});
+    }
+} // namespace simdtl
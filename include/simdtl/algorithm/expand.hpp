@@ -0,0 +1,78 @@
+#pragma once
+// ── L4: expand — the inverse of copy_if ───────────────────────────────────────
+// Scatters a DENSE prefix back into row positions selected by a bitmap (1 bit
+// per row, LSB-first 64-bit words): out[i] = bit i ? dense[k++] : first[i]. This
+// is how a filtered column is decompressed to its rows, or null-filled (pass the
+// fill column as `first`). Returns k, the number of dense elements consumed.
+// `out` may alias `first`. Dispatched AVX2 (expand-LUT + vpermd + blend) and
+// AVX-512 (vpexpand; 8/16-bit need VBMI2) kernels cover every 1/2/4/8-byte
+// arithmetic type; the portable path copies whole all-set / all-clear words.
+#include "../crosslane/compress.hpp"
+#include "../platform/dispatch.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        template <class T>
+        std::size_t expand_portable(const T* first, std::size_t n, const std::uint64_t* bits, const T* dense,
+                                    T* out) noexcept
+        {
+            std::size_t i = 0, k = 0;
+            for (; i + 64 <= n; i += 64)
+            {
+                const std::uint64_t w = bits[i / 64];
+                if (w == ~std::uint64_t{0})
+                {
+                    for (std::size_t j = 0; j < 64; ++j) out[i + j] = dense[k + j];
+                    k += 64;
+                }
+                else if (w == 0)
+                {
+                    for (std::size_t j = 0; j < 64; ++j) out[i + j] = first[i + j];
+                }
+                else
+                {
+                    for (std::size_t j = 0; j < 64; ++j)
+                        out[i + j] = ((w >> j) & 1u) ? dense[k++] : first[i + j];
+                }
+            }
+            for (; i < n; ++i)
+                out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+            return k;
+        }
+    } // namespace detail
+
+    template <class T>
+    std::size_t expand(const T* first, std::size_t n, const std::uint64_t* mask_bitmap, const T* dense,
+                       T* out) noexcept
+    {
+        if constexpr (detail::same_width_v<T, std::int64_t>)
+        {
+            if (auto fn = platform::expand_i64_slot())
+                return fn(reinterpret_cast<const std::int64_t*>(first), n, mask_bitmap,
+                          reinterpret_cast<const std::int64_t*>(dense), reinterpret_cast<std::int64_t*>(out));
+        }
+        else if constexpr (detail::same_width_v<T, std::int32_t>)
+        {
+            if (auto fn = platform::expand_i32_slot())
+                return fn(reinterpret_cast<const std::int32_t*>(first), n, mask_bitmap,
+                          reinterpret_cast<const std::int32_t*>(dense), reinterpret_cast<std::int32_t*>(out));
+        }
+        else if constexpr (detail::same_width_v<T, std::int16_t>)
+        {
+            if (auto fn = platform::expand_i16_slot())
+                return fn(reinterpret_cast<const std::int16_t*>(first), n, mask_bitmap,
+                          reinterpret_cast<const std::int16_t*>(dense), reinterpret_cast<std::int16_t*>(out));
+        }
+        else if constexpr (detail::same_width_v<T, std::int8_t>)
+        {
+            if (auto fn = platform::expand_i8_slot())
+                return fn(reinterpret_cast<const std::int8_t*>(first), n, mask_bitmap,
+                          reinterpret_cast<const std::int8_t*>(dense), reinterpret_cast<std::int8_t*>(out));
+        }
+        return detail::expand_portable(first, n, mask_bitmap, dense, out);
+    }
+} // namespace simdtl
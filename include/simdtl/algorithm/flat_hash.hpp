@@ -0,0 +1,431 @@
+#pragma once
+// ── L4: Swiss-table group probing + flat hash set / map for integer keys ──────
+//   group_match(ctrl, h2)          lanes of a 16-byte control group equal to h2
+//   group_match_empty(ctrl)        lanes holding ctrl_empty
+//   group_match_free(ctrl)         lanes holding ctrl_empty or ctrl_deleted
+// each a group_bits: a 16-bit lane set iterated lowest-first (`for (int j : m)`).
+// Control bytes: 0..127 = full slot with that H2 (low 7 hash bits), ctrl_empty
+// = -128, ctrl_deleted = -2, so "free" is just the sign bit. The compare is a
+// 16-lane std::simd == moved out with mask_bits: pcmpeqb + pmovmskb on every
+// x86 tier (SSE2 is the baseline), the count_i8 pattern on one xmm. That is a
+// few instructions per probe, so it is inlined rather than dispatched.
+//
+// flat_hash_set<K> / flat_hash_map<K, V> (K integral) are open-addressing
+// tables on it: 16-slot groups aligned in the control array, H1 (the hash's
+// other bits) picks the first group and triangular steps visit every group.
+// A lookup matches H2 over a whole group, compares keys only on candidates, and
+// stops at the first group with an empty lane. Load is kept <= 7/8; erase
+// leaves a tombstone only if the group has no empty lane. The *_many forms run
+// a key stream through the table, prefetching the control group and slots of
+// the key `hash_prefetch_distance` ahead so that many misses overlap (the
+// batched-search idea of search.hpp); single lookups on an L2-resident table
+// gain nothing from it.
+#include "../backend/names.hpp"
+#include "../detail/aligned_allocator.hpp"
+#include "../platform/prefetch.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simdtl
+{
+    inline constexpr std::size_t group_width = 16;
+    inline constexpr std::int8_t ctrl_empty = -128;
+    inline constexpr std::int8_t ctrl_deleted = -2;
+
+    // Lane set of one control group; iterating yields lane indices ascending.
+    class group_bits
+    {
+    public:
+        class iterator
+        {
+        public:
+            constexpr explicit iterator(std::uint32_t b) noexcept : b_(b) {}
+            int operator*() const noexcept { return std::countr_zero(b_); }
+            iterator& operator++() noexcept { b_ &= b_ - 1; return *this; }
+            constexpr bool operator==(const iterator&) const noexcept = default;
+
+        private:
+            std::uint32_t b_;
+        };
+
+        constexpr explicit group_bits(std::uint32_t b) noexcept : b_(b) {}
+        constexpr explicit operator bool() const noexcept { return b_ != 0; }
+        constexpr std::uint32_t bits() const noexcept { return b_; }
+        int count() const noexcept { return std::popcount(b_); }
+        int lowest() const noexcept { return std::countr_zero(b_); }   // needs a set lane
+        iterator begin() const noexcept { return iterator(b_); }
+        iterator end() const noexcept { return iterator(0); }
+
+    private:
+        std::uint32_t b_;
+    };
+
+    namespace detail
+    {
+        using ctrl_group = vec<std::int8_t, group_width>;
+
+        inline ctrl_group load_group(const std::int8_t* ctrl) noexcept { return ctrl_group(ctrl, elem_aligned); }
+        inline group_bits to_group_bits(const typename ctrl_group::mask_type& m) noexcept
+        {
+            return group_bits(static_cast<std::uint32_t>(mask_bits(m)));
+        }
+
+        // Keys probed ahead of the one being looked up by the *_many forms.
+        inline constexpr std::size_t hash_prefetch_distance = 8;
+    } // namespace detail
+
+    inline group_bits group_match(const std::int8_t* ctrl, std::int8_t h2) noexcept
+    {
+        return detail::to_group_bits(detail::load_group(ctrl) == detail::ctrl_group(h2));
+    }
+    inline group_bits group_match_empty(const std::int8_t* ctrl) noexcept
+    {
+        return detail::to_group_bits(detail::load_group(ctrl) == detail::ctrl_group(ctrl_empty));
+    }
+    inline group_bits group_match_free(const std::int8_t* ctrl) noexcept
+    {
+        return detail::to_group_bits(detail::load_group(ctrl) < detail::ctrl_group(0));
+    }
+
+    // Default hash for integer keys: a multiply-xorshift finalizer, so keys that
+    // differ only in high bits still spread over both H1 and H2.
+    struct int_hash
+    {
+        template <class K>
+        std::uint64_t operator()(K key) const noexcept
+        {
+            std::uint64_t x = static_cast<std::uint64_t>(key);
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            return x;
+        }
+    };
+
+    namespace detail
+    {
+        template <class K, class V>
+        struct map_slot
+        {
+            K key;
+            V value;
+        };
+
+        template <class K> const K& slot_key(const K& s) noexcept { return s; }
+        template <class K, class V> const K& slot_key(const map_slot<K, V>& s) noexcept { return s.key; }
+
+        // The shared open-addressing core; Slot is K (set) or map_slot<K, V>.
+        template <class K, class Slot, class Hash>
+        class swiss_table
+        {
+        public:
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+            swiss_table() = default;
+            explicit swiss_table(std::size_t expected) { reserve(expected); }
+
+            std::size_t size() const noexcept { return size_; }
+            std::size_t capacity() const noexcept { return ctrl_.size(); }
+
+            void clear() noexcept
+            {
+                for (auto& c : ctrl_) c = ctrl_empty;
+                size_ = 0;
+                growth_left_ = max_load(capacity());
+            }
+
+            // Room for `n` keys without rehashing.
+            void reserve(std::size_t n)
+            {
+                if (n > size_ + growth_left_) rehash(std::max(capacity_for(n), capacity()));
+            }
+
+            std::uint64_t hash(const K& key) const noexcept { return hash_(key); }
+
+            // Slot index of `key`, or npos.
+            std::size_t find(const K& key, std::uint64_t h) const noexcept
+            {
+                if (size_ == 0) return npos;
+                const std::int8_t h2 = static_cast<std::int8_t>(h & 0x7F);
+                const std::size_t gmask = capacity() / group_width - 1;
+                std::size_t g = static_cast<std::size_t>(h >> 7) & gmask;
+                for (std::size_t step = 1;; ++step)
+                {
+                    const std::int8_t* c = ctrl_.data() + g * group_width;
+                    for (int j : group_match(c, h2))
+                    {
+                        const std::size_t s = g * group_width + static_cast<std::size_t>(j);
+                        if (slot_key(slots_[s]) == key) return s;
+                    }
+                    if (group_match_empty(c)) return npos;
+                    g = (g + step) & gmask;
+                }
+            }
+
+            // Slot of `key`, claimed (key stored, rest of the slot untouched) if
+            // it was absent; second = true then.
+            std::pair<std::size_t, bool> find_or_claim(const K& key, std::uint64_t h)
+            {
+                if (const std::size_t s = find(key, h); s != npos) return {s, false};
+                std::size_t s = ctrl_.empty() ? npos : first_free(h);
+                if (s == npos || (growth_left_ == 0 && ctrl_[s] == ctrl_empty))
+                {
+                    // Mostly tombstones: rebuild in place; else grow.
+                    rehash(size_ + 1 <= max_load(capacity()) / 2 ? capacity() : capacity_for(size_ + 1));
+                    s = first_free(h);
+                }
+                if (ctrl_[s] == ctrl_empty) --growth_left_;
+                ctrl_[s] = static_cast<std::int8_t>(h & 0x7F);
+                set_key(slots_[s], key);
+                ++size_;
+                return {s, true};
+            }
+
+            void erase_at(std::size_t s) noexcept
+            {
+                const std::size_t g = s / group_width * group_width;
+                // A probe reaching this group stops at its empty lane anyway, so the
+                // slot can be empty again; otherwise chains may run through it.
+                if (group_match_empty(ctrl_.data() + g))
+                {
+                    ctrl_[s] = ctrl_empty;
+                    ++growth_left_;
+                }
+                else ctrl_[s] = ctrl_deleted;
+                --size_;
+            }
+
+            void prefetch(std::uint64_t h) const noexcept
+            {
+                if (ctrl_.empty()) return;
+                const std::size_t g = static_cast<std::size_t>(h >> 7) & (capacity() / group_width - 1);
+                platform::prefetch(ctrl_.data() + g * group_width);
+                platform::prefetch(slots_.data() + g * group_width);
+            }
+
+            bool full(std::size_t s) const noexcept { return ctrl_[s] >= 0; }
+            Slot& slot(std::size_t s) noexcept { return slots_[s]; }
+            const Slot& slot(std::size_t s) const noexcept { return slots_[s]; }
+
+        private:
+            static std::size_t max_load(std::size_t cap) noexcept { return cap - cap / 8; }
+
+            // Smallest power-of-two number of groups holding n keys at <= 7/8 load.
+            static std::size_t capacity_for(std::size_t n) noexcept
+            {
+                std::size_t cap = group_width;
+                while (max_load(cap) < n) cap *= 2;
+                return cap;
+            }
+
+            static void set_key(K& s, const K& key) noexcept { s = key; }
+            template <class V> static void set_key(map_slot<K, V>& s, const K& key) noexcept { s.key = key; }
+
+            // First empty or deleted slot on h's probe sequence (one must exist).
+            std::size_t first_free(std::uint64_t h) const noexcept
+            {
+                const std::size_t gmask = capacity() / group_width - 1;
+                std::size_t g = static_cast<std::size_t>(h >> 7) & gmask;
+                for (std::size_t step = 1;; ++step)
+                {
+                    if (const group_bits m = group_match_free(ctrl_.data() + g * group_width))
+                        return g * group_width + static_cast<std::size_t>(m.lowest());
+                    g = (g + step) & gmask;
+                }
+            }
+
+            void rehash(std::size_t cap)
+            {
+                std::vector<std::int8_t, aligned_allocator<std::int8_t>> old_ctrl(cap, ctrl_empty);
+                std::vector<Slot> old_slots(cap);
+                old_ctrl.swap(ctrl_);
+                old_slots.swap(slots_);
+                growth_left_ = max_load(cap) - size_;
+                for (std::size_t s = 0; s < old_ctrl.size(); ++s)
+                {
+                    if (old_ctrl[s] < 0) continue;
+                    const std::uint64_t h = hash_(slot_key(old_slots[s]));
+                    const std::size_t t = first_free(h);
+                    ctrl_[t] = old_ctrl[s];
+                    slots_[t] = std::move(old_slots[s]);
+                }
+            }
+
+            std::vector<std::int8_t, aligned_allocator<std::int8_t>> ctrl_;   // capacity() bytes, 16 per group
+            std::vector<Slot> slots_;
+            std::size_t size_ = 0;
+            std::size_t growth_left_ = 0;   // max load - size - tombstones: empties still fillable
+            [[no_unique_address]] Hash hash_{};
+        };
+    } // namespace detail
+
+    template <class K, class Hash = int_hash>
+    class flat_hash_set
+    {
+        static_assert(std::is_integral_v<K>, "flat_hash_set: K must be an integer type");
+
+    public:
+        flat_hash_set() = default;
+        explicit flat_hash_set(std::size_t expected) : t_(expected) {}
+
+        std::size_t size() const noexcept { return t_.size(); }
+        bool empty() const noexcept { return t_.size() == 0; }
+        std::size_t capacity() const noexcept { return t_.capacity(); }
+        void clear() noexcept { t_.clear(); }
+        void reserve(std::size_t n) { t_.reserve(n); }
+
+        // True if `key` was not yet present.
+        bool insert(K key) { return t_.find_or_claim(key, t_.hash(key)).second; }
+        bool contains(K key) const noexcept { return t_.find(key, t_.hash(key)) != table::npos; }
+        bool erase(K key) noexcept
+        {
+            const std::size_t s = t_.find(key, t_.hash(key));
+            if (s == table::npos) return false;
+            t_.erase_at(s);
+            return true;
+        }
+
+        // Returns how many of keys[0, n) were new.
+        std::size_t insert_many(const K* keys, std::size_t n)
+        {
+            constexpr std::size_t D = detail::hash_prefetch_distance;
+            std::size_t added = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (i + D < n) t_.prefetch(t_.hash(keys[i + D]));
+                added += t_.find_or_claim(keys[i], t_.hash(keys[i])).second ? 1u : 0u;
+            }
+            return added;
+        }
+
+        // found[i] = contains(keys[i]); returns how many were found.
+        std::size_t contains_many(const K* keys, std::size_t n, bool* found) const noexcept
+        {
+            constexpr std::size_t D = detail::hash_prefetch_distance;
+            std::size_t hits = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (i + D < n) t_.prefetch(t_.hash(keys[i + D]));
+                found[i] = t_.find(keys[i], t_.hash(keys[i])) != table::npos;
+                hits += found[i] ? 1u : 0u;
+            }
+            return hits;
+        }
+
+        // f(key) for every key, in table order.
+        template <class F>
+        void for_each(F f) const
+        {
+            for (std::size_t s = 0; s < t_.capacity(); ++s)
+                if (t_.full(s)) f(t_.slot(s));
+        }
+
+    private:
+        using table = detail::swiss_table<K, K, Hash>;
+        table t_;
+    };
+
+    template <class K, class V, class Hash = int_hash>
+    class flat_hash_map
+    {
+        static_assert(std::is_integral_v<K>, "flat_hash_map: K must be an integer type");
+        static_assert(std::is_default_constructible_v<V>, "flat_hash_map: V must be default constructible");
+
+    public:
+        flat_hash_map() = default;
+        explicit flat_hash_map(std::size_t expected) : t_(expected) {}
+
+        std::size_t size() const noexcept { return t_.size(); }
+        bool empty() const noexcept { return t_.size() == 0; }
+        std::size_t capacity() const noexcept { return t_.capacity(); }
+        void clear() noexcept { t_.clear(); }
+        void reserve(std::size_t n) { t_.reserve(n); }
+
+        // Keeps an existing value (std::unordered_map::insert); true if `key` was new.
+        bool insert(K key, V value)
+        {
+            const auto [s, added] = t_.find_or_claim(key, t_.hash(key));
+            if (added) t_.slot(s).value = std::move(value);
+            return added;
+        }
+        bool insert_or_assign(K key, V value)
+        {
+            const auto [s, added] = t_.find_or_claim(key, t_.hash(key));
+            t_.slot(s).value = std::move(value);
+            return added;
+        }
+        // Value-initialized on first use.
+        V& operator[](K key)
+        {
+            const auto [s, added] = t_.find_or_claim(key, t_.hash(key));
+            if (added) t_.slot(s).value = V{};
+            return t_.slot(s).value;
+        }
+
+        V* find(K key) noexcept
+        {
+            const std::size_t s = t_.find(key, t_.hash(key));
+            return s == table::npos ? nullptr : &t_.slot(s).value;
+        }
+        const V* find(K key) const noexcept
+        {
+            const std::size_t s = t_.find(key, t_.hash(key));
+            return s == table::npos ? nullptr : &t_.slot(s).value;
+        }
+        bool contains(K key) const noexcept { return t_.find(key, t_.hash(key)) != table::npos; }
+        bool erase(K key) noexcept
+        {
+            const std::size_t s = t_.find(key, t_.hash(key));
+            if (s == table::npos) return false;
+            t_.erase_at(s);
+            return true;
+        }
+
+        // insert(keys[i], values[i]) for i < n; returns how many keys were new.
+        std::size_t insert_many(const K* keys, const V* values, std::size_t n)
+        {
+            constexpr std::size_t D = detail::hash_prefetch_distance;
+            std::size_t added = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (i + D < n) t_.prefetch(t_.hash(keys[i + D]));
+                const auto [s, is_new] = t_.find_or_claim(keys[i], t_.hash(keys[i]));
+                if (is_new) { t_.slot(s).value = values[i]; ++added; }
+            }
+            return added;
+        }
+
+        // out[i] = the value of keys[i], or `missing` if absent (a hash-join
+        // probe); returns how many were found.
+        std::size_t find_many(const K* keys, std::size_t n, V* out, const V& missing = V{}) const
+        {
+            constexpr std::size_t D = detail::hash_prefetch_distance;
+            std::size_t hits = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (i + D < n) t_.prefetch(t_.hash(keys[i + D]));
+                const std::size_t s = t_.find(keys[i], t_.hash(keys[i]));
+                if (s != table::npos) { out[i] = t_.slot(s).value; ++hits; }
+                else out[i] = missing;
+            }
+            return hits;
+        }
+
+        // f(key, value) for every entry, in table order.
+        template <class F>
+        void for_each(F f) const
+        {
+            for (std::size_t s = 0; s < t_.capacity(); ++s)
+                if (t_.full(s)) f(t_.slot(s).key, t_.slot(s).value);
+        }
+
+    private:
+        using table = detail::swiss_table<K, detail::map_slot<K, V>, Hash>;
+        table t_;
+    };
+} // namespace simdtl
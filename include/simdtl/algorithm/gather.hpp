@@ -0,0 +1,113 @@
+#pragma once
+// ── L4: take / scatter by index arrays, and a gather-based sparse dot product ─
+// The late-materialization primitives of a column store:
+//   take(values, idx, m, out)      out[j] = values[idx[j]]
+//   scatter(values, idx, m, dst)   dst[idx[j]] = values[j]  (duplicates: last wins)
+//   sparse_dot(dense, idx, v, nnz) sum_j v[j] * dense[idx[j]]
+// take and sparse_dot over 32/64-bit elements with int32 indices route through
+// dispatched AVX2 / AVX-512 vpgather kernels; so do uint32 indices (the
+// selection vectors of copy_if_indices), which must then be below 2^31 —
+// vpgather sign-extends its 32-bit indices. Those are registered only where a
+// hardware gather actually beats scalar loads (it is microcoded on Haswell and
+// Zen1/Zen2 — see cpu_features::slow_gather); elsewhere, and for other index
+// types, the portable path is an unrolled run of independent scalar loads,
+// which the out-of-order core overlaps just as well. scatter is scalar stores
+// everywhere: vpscatter measured slower than them. sparse_dot reassociates the
+// sum (same caveat as reduce). Indices must be in range; no bounds checks.
+#include "../crosslane/compress.hpp"
+#include "../platform/dispatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // The index types the int32 gather kernels accept.
+        template <class I>
+        inline constexpr bool gather_index_v = std::is_same_v<I, std::int32_t> || std::is_same_v<I, std::uint32_t>;
+
+        template <class T, class I>
+        void take_portable(const T* values, const I* indices, std::size_t m, T* out) noexcept
+        {
+            std::size_t j = 0;
+            for (; j + 4 <= m; j += 4)
+            {
+                const T a = values[indices[j]], b = values[indices[j + 1]];
+                const T c = values[indices[j + 2]], d = values[indices[j + 3]];
+                out[j] = a; out[j + 1] = b; out[j + 2] = c; out[j + 3] = d;
+            }
+            for (; j < m; ++j) out[j] = values[indices[j]];
+        }
+
+        template <class T, class I>
+        void scatter_portable(const T* values, const I* indices, std::size_t m, T* dst) noexcept
+        {
+            for (std::size_t j = 0; j < m; ++j) dst[indices[j]] = values[j];
+        }
+
+        // Four independent partial sums, so consecutive loads don't wait on one add chain.
+        template <class T, class I>
+        T sparse_dot_portable(const T* dense, const I* indices, const T* values, std::size_t nnz) noexcept
+        {
+            T s0{}, s1{}, s2{}, s3{};
+            std::size_t j = 0;
+            for (; j + 4 <= nnz; j += 4)
+            {
+                s0 += values[j]     * dense[indices[j]];
+                s1 += values[j + 1] * dense[indices[j + 1]];
+                s2 += values[j + 2] * dense[indices[j + 2]];
+                s3 += values[j + 3] * dense[indices[j + 3]];
+            }
+            for (; j < nnz; ++j) s0 += values[j] * dense[indices[j]];
+            return (s0 + s1) + (s2 + s3);
+        }
+    } // namespace detail
+
+    template <class T, class I>
+    void take(const T* values, const I* indices, std::size_t m, T* out) noexcept
+    {
+        if constexpr (detail::gather_index_v<I> && detail::same_width_v<T, std::int32_t>)
+        {
+            if (auto fn = platform::take_i32_slot())
+                return fn(reinterpret_cast<const std::int32_t*>(values), reinterpret_cast<const std::int32_t*>(indices), m,
+                          reinterpret_cast<std::int32_t*>(out));
+        }
+        else if constexpr (detail::gather_index_v<I> && detail::same_width_v<T, std::int64_t>)
+        {
+            if (auto fn = platform::take_i64_slot())
+                return fn(reinterpret_cast<const std::int64_t*>(values), reinterpret_cast<const std::int32_t*>(indices), m,
+                          reinterpret_cast<std::int64_t*>(out));
+        }
+        detail::take_portable(values, indices, m, out);
+    }
+
+    template <class T, class I>
+    void scatter(const T* values, const I* indices, std::size_t m, T* dst) noexcept
+    {
+        detail::scatter_portable(values, indices, m, dst);
+    }
+
+    template <class T, class I>
+    T sparse_dot(const T* dense, const I* indices, const T* values, std::size_t nnz) noexcept
+    {
+        if constexpr (detail::gather_index_v<I> && std::is_same_v<T, float>)
+        {
+            if (auto fn = platform::sparse_dot_f32_slot())
+                return fn(dense, reinterpret_cast<const std::int32_t*>(indices), values, nnz);
+        }
+        else if constexpr (detail::gather_index_v<I> && std::is_same_v<T, double>)
+        {
+            if (auto fn = platform::sparse_dot_f64_slot())
+                return fn(dense, reinterpret_cast<const std::int32_t*>(indices), values, nnz);
+        }
+        return detail::sparse_dot_portable(dense, indices, values, nnz);
+    }
+
+    template <class C, class IC>
+    void take(const C& values, const IC& indices, typename C::value_type* out)
+    {
+        take(values.data(), indices.data(), indices.size(), out);
+    }
+} // namespace simdtl
@@ -0,0 +1,109 @@
+#pragma once
+// ── L4: fp16 / bfloat16 bulk conversion ───────────────────────────────────────
+// Half-precision values travel as their raw bits in std::uint16_t (IEEE 754
+// binary16, or bfloat16: the top half of a float).
+//   convert_f16_to_f32 / convert_bf16_to_f32: exact widening.
+//   convert_f32_to_f16 / convert_f32_to_bf16: round to nearest, ties to even;
+//     overflow gives +-inf, tiny values round into the subnormals / zero.
+// NaNs stay NaN with their sign, come out quiet, and keep the payload bits
+// that fit: the behaviour of F16C's vcvtph2ps / vcvtps2ph and AVX-512's
+// vcvtneps2bf16. The portable per-element code below is bit-exact with those
+// instructions (including subnormals, which vcvtneps2bf16 would flush; that
+// kernel patches them), so results never depend on the machine.
+// Dispatch: F16C (AVX2 tier) / AVX-512F for fp16, AVX-512 BF16 for f32 -> bf16,
+// and plain shifts at AVX2 / AVX-512 for bf16 -> f32.
+#include "../platform/dispatch.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        inline float f16_to_f32_one(std::uint16_t h) noexcept
+        {
+            const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+            const std::uint32_t em = h & 0x7FFFu;
+            std::uint32_t bits = (em << 13) + ((127u - 15u) << 23);            // normal: rebias
+            if (em >= 0x7C00u) bits = 0x7F800000u | (em & 0x3FFu) << 13 | (em > 0x7C00u ? 0x00400000u : 0u);
+            else if (em < 0x0400u)                                             // zero / subnormal: em * 2^-24
+                bits = std::bit_cast<std::uint32_t>(static_cast<float>(em) * 0x1p-24f);
+            return std::bit_cast<float>(bits | sign);
+        }
+
+        // After F. Giesen's float_to_half_fast3_rtne: the subnormal range is
+        // rounded by the FPU (adding 0.5f lines the half's units up with the
+        // float's last mantissa bit), the normal range by integer add-and-carry.
+        inline std::uint16_t f32_to_f16_one(float f) noexcept
+        {
+            std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+            const std::uint32_t sign = (x >> 16) & 0x8000u;
+            x &= 0x7FFFFFFFu;
+            std::uint32_t h;
+            if (x > 0x7F800000u) h = 0x7E00u | ((x >> 13) & 0x3FFu);   // NaN: quiet, payload truncated
+            else if (x >= 0x477FF000u) h = 0x7C00u;                      // >= 65520 rounds to inf
+            else if (x < 0x38800000u)                                     // below 2^-14: subnormal / zero
+                h = std::bit_cast<std::uint32_t>(std::bit_cast<float>(x) + 0.5f) - 0x3F000000u;
+            else
+            {
+                const std::uint32_t odd = (x >> 13) & 1u;
+                h = (x + 0xC8000FFFu + odd) >> 13;                        // rebias (-112 << 23), round half even
+            }
+            return static_cast<std::uint16_t>(h | sign);
+        }
+
+        inline float bf16_to_f32_one(std::uint16_t h) noexcept
+        {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(h) << 16);
+        }
+
+        inline std::uint16_t f32_to_bf16_one(float f) noexcept
+        {
+            const std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+            if ((x & 0x7FFFFFFFu) > 0x7F800000u) return static_cast<std::uint16_t>((x >> 16) | 0x40u);   // quiet NaN
+            return static_cast<std::uint16_t>((x + 0x7FFFu + ((x >> 16) & 1u)) >> 16);
+        }
+
+        inline void f16_to_f32_portable(const std::uint16_t* first, std::size_t n, float* out) noexcept
+        {
+            for (std::size_t i = 0; i < n; ++i) out[i] = f16_to_f32_one(first[i]);
+        }
+        inline void f32_to_f16_portable(const float* first, std::size_t n, std::uint16_t* out) noexcept
+        {
+            for (std::size_t i = 0; i < n; ++i) out[i] = f32_to_f16_one(first[i]);
+        }
+        inline void bf16_to_f32_portable(const std::uint16_t* first, std::size_t n, float* out) noexcept
+        {
+            for (std::size_t i = 0; i < n; ++i) out[i] = bf16_to_f32_one(first[i]);
+        }
+        inline void f32_to_bf16_portable(const float* first, std::size_t n, std::uint16_t* out) noexcept
+        {
+            for (std::size_t i = 0; i < n; ++i) out[i] = f32_to_bf16_one(first[i]);
+        }
+    } // namespace detail
+
+    inline void convert_f16_to_f32(const std::uint16_t* first, std::size_t n, float* out) noexcept
+    {
+        if (auto fn = platform::f16_to_f32_slot()) return fn(first, n, out);
+        detail::f16_to_f32_portable(first, n, out);
+    }
+
+    inline void convert_f32_to_f16(const float* first, std::size_t n, std::uint16_t* out) noexcept
+    {
+        if (auto fn = platform::f32_to_f16_slot()) return fn(first, n, out);
+        detail::f32_to_f16_portable(first, n, out);
+    }
+
+    inline void convert_bf16_to_f32(const std::uint16_t* first, std::size_t n, float* out) noexcept
+    {
+        if (auto fn = platform::bf16_to_f32_slot()) return fn(first, n, out);
+        detail::bf16_to_f32_portable(first, n, out);
+    }
+
+    inline void convert_f32_to_bf16(const float* first, std::size_t n, std::uint16_t* out) noexcept
+    {
+        if (auto fn = platform::f32_to_bf16_slot()) return fn(first, n, out);
+        detail::f32_to_bf16_portable(first, n, out);
+    }
+} // namespace simdtl
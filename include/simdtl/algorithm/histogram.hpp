@@ -0,0 +1,124 @@
+#pragma once
+// ── L4: histograms of byte / 16-bit columns, counts over a small domain ──────
+// histogram_u8(first, n, hist):  hist[v] = occurrences of v, for all 256 v.
+// histogram_u16(first, n, hist): the same over 65536 bins.
+// `hist` is overwritten (not accumulated into); counts wrap modulo 2^32.
+//
+// A naive `++hist[x]` serialises on store-to-load forwarding whenever values
+// repeat (each increment must wait for the previous store to the same bin —
+// ~5 cycles per element on constant data). The portable paths spread
+// consecutive elements over interleaved sub-histograms, so repeats hit
+// different memory, then sum the sub-histograms with native-width adds. The
+// AVX-512 histogram_u16 kernel instead gathers 16 bins, folds duplicate lanes
+// with vpconflictd, and scatters the updated counts back (see
+// histogram_avx512.cpp for why bytes stay on the portable path).
+//
+// count_values_in_small_domain(first, n, domain, k, counts): counts[j] =
+// number of elements equal to domain[j]. Meant for k <= 16 (status codes,
+// enums, flags): one dispatched `count` per domain value over L1-sized blocks,
+// so the column streams from memory once however many values are counted.
+// Larger domains work, but a histogram is then the better tool.
+#include "../backend/names.hpp"
+#include "../platform/dispatch.hpp"
+#include "count.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // histogram_u16 only pays for a second 256 KB sub-histogram above this.
+        inline constexpr std::size_t histogram_u16_split = std::size_t{1} << 18;
+
+        // out[b] = sum of sub[0..K)[b], native-width adds. `bins` is 256 or 65536,
+        // a multiple of every native width.
+        template <std::size_t K>
+        void merge_histograms(const std::uint32_t* const (&sub)[K], std::size_t bins, std::uint32_t* out) noexcept
+        {
+            using V = native<std::uint32_t>;
+            constexpr std::size_t W = V::size();
+            static_assert(256 % W == 0);
+            for (std::size_t b = 0; b < bins; b += W)
+            {
+                V s(sub[0] + b, elem_aligned);
+                for (std::size_t j = 1; j < K; ++j) s += V(sub[j] + b, elem_aligned);
+                s.copy_to(out + b, elem_aligned);
+            }
+        }
+
+        inline void histogram_u8_portable(const std::uint8_t* first, std::size_t n, std::uint32_t* hist) noexcept
+        {
+            // Eight bytes per 64-bit load, byte j to sub-histogram j (byte order is
+            // irrelevant: every byte is counted exactly once). 8 KB of tables: L1.
+            alignas(64) std::uint32_t sub[8][256] = {};
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                std::uint64_t w;
+                std::memcpy(&w, first + i, 8);
+                ++sub[0][w & 0xFFu];
+                ++sub[1][(w >> 8) & 0xFFu];
+                ++sub[2][(w >> 16) & 0xFFu];
+                ++sub[3][(w >> 24) & 0xFFu];
+                ++sub[4][(w >> 32) & 0xFFu];
+                ++sub[5][(w >> 40) & 0xFFu];
+                ++sub[6][(w >> 48) & 0xFFu];
+                ++sub[7][w >> 56];
+            }
+            for (; i < n; ++i) ++sub[0][first[i]];
+            const std::uint32_t* const parts[8] = {sub[0], sub[1], sub[2], sub[3], sub[4], sub[5], sub[6], sub[7]};
+            merge_histograms(parts, 256, hist);
+        }
+
+        // Two sub-histograms: `hist` itself and one scratch table (65536 bins
+        // each, so more would spill L2). Small inputs count straight into `hist`.
+        inline void histogram_u16_portable(const std::uint16_t* first, std::size_t n, std::uint32_t* hist)
+        {
+            std::memset(hist, 0, 65536 * sizeof(std::uint32_t));
+            std::size_t i = 0;
+            if (n >= histogram_u16_split)
+            {
+                std::vector<std::uint32_t> other(65536);
+                for (; i + 2 <= n; i += 2)
+                {
+                    ++hist[first[i]];
+                    ++other[first[i + 1]];
+                }
+                const std::uint32_t* const parts[2] = {hist, other.data()};
+                for (; i < n; ++i) ++hist[first[i]];
+                return merge_histograms(parts, 65536, hist);
+            }
+            for (; i < n; ++i) ++hist[first[i]];
+        }
+    } // namespace detail
+
+    // hist must hold 256 counts.
+    inline void histogram_u8(const std::uint8_t* first, std::size_t n, std::uint32_t* hist) noexcept
+    {
+        detail::histogram_u8_portable(first, n, hist);
+    }
+
+    // hist must hold 65536 counts. The portable path may allocate a scratch
+    // sub-histogram (std::bad_alloc); the dispatched kernel never does.
+    inline void histogram_u16(const std::uint16_t* first, std::size_t n, std::uint32_t* hist)
+    {
+        if (auto fn = platform::histogram_u16_slot()) return fn(first, n, hist);
+        detail::histogram_u16_portable(first, n, hist);
+    }
+
+    template <class T>
+    void count_values_in_small_domain(const T* first, std::size_t n, const T* domain, std::size_t k,
+                                      std::size_t* counts) noexcept
+    {
+        constexpr std::size_t block = 16384 / sizeof(T);   // stays in L1 across the k passes
+        for (std::size_t j = 0; j < k; ++j) counts[j] = 0;
+        for (std::size_t i = 0; i < n; i += block)
+        {
+            const std::size_t len = n - i < block ? n - i : block;
+            for (std::size_t j = 0; j < k; ++j) counts[j] += simdtl::count(first + i, len, domain[j]);
+        }
+    }
+} // namespace simdtl
@@ -0,0 +1,191 @@
+#pragma once
+// ── L4: one-pass statistical moments (vector Welford) ─────────────────────────
+// moments(first, n) -> moment_state<T>: count, mean and M2 (the sum of squared
+// deviations) in ONE pass; moments<4>(first, n) also tracks M3 / M4 for skewness
+// and kurtosis. T is float or double; the state is kept in T.
+//
+// Every lane runs its own Welford recurrence over a strided share of the input
+// (a fixed<T, L> of L = 4 native vectors for order 2, 2 for order 4, so the
+// mean -> delta -> mean dependency chains overlap). All lanes see the same count
+// k at step k, so 1/k and the other count-only factors are one scalar per step.
+// The L lane states are then merged with the pairwise (Chan / Pébay) formulas
+// and the tail is pushed one element at a time. Unlike the textbook
+// sum / sum-of-squares pass there is no catastrophic cancellation: 1e4 + small
+// noise in float keeps its variance. float / double route through dispatched
+// AVX2 (+FMA3) / AVX-512 kernels that run the same per-lane recurrence wider.
+//
+// moment_state is mergeable, for streaming and for parallel chunks:
+//   s.push(x)           one more sample
+//   s.append(first, n)  a batch (merges moments<Order>(first, n))
+//   s.merge(other)      combine two disjoint samples
+// Accessors: variance() (population, M2 / n), sample_variance() (M2 / (n - 1)),
+// stddev(), skewness() (sqrt(n) M3 / M2^1.5), kurtosis() (excess: n M4 / M2^2 - 3).
+#include "../backend/names.hpp"
+#include "../platform/dispatch.hpp"
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace simdtl
+{
+    template <class T, int Order = 2>
+    struct moment_state
+    {
+        static_assert(std::is_floating_point_v<T>, "moments are computed in floating point");
+        static_assert(Order == 2 || Order == 4, "track up to M2, or up to M4");
+
+        std::size_t count = 0;
+        T mean{}, m2{}, m3{}, m4{};   // m3 / m4 stay 0 unless Order == 4
+
+        void push(T x) noexcept
+        {
+            const T n1 = static_cast<T>(count);
+            ++count;
+            const T n = static_cast<T>(count);
+            const T delta = x - mean, dn = delta / n, t1 = delta * dn * n1;
+            if constexpr (Order == 4)
+            {
+                const T dn2 = dn * dn;
+                m4 += t1 * dn2 * (n * n - 3 * n + 3) + 6 * dn2 * m2 - 4 * dn * m3;
+                m3 += t1 * dn * (n - 2) - 3 * dn * m2;
+            }
+            m2 += t1;   // = delta * (x - new mean)
+            mean += dn;
+        }
+
+        void merge(const moment_state& o) noexcept
+        {
+            if (o.count == 0) return;
+            if (count == 0) { *this = o; return; }
+            const T na = static_cast<T>(count), nb = static_cast<T>(o.count), n = na + nb;
+            const T delta = o.mean - mean, dn = delta / n;
+            if constexpr (Order == 4)
+            {
+                const T d2 = delta * dn, d3 = d2 * dn;   // delta^2 / n, delta^3 / n^2
+                m4 += o.m4 + d3 * delta * na * nb * (na * na - na * nb + nb * nb) / n
+                    + 6 * dn * dn * (na * na * o.m2 + nb * nb * m2) + 4 * dn * (na * o.m3 - nb * m3);
+                m3 += o.m3 + d3 * na * nb * (na - nb) + 3 * dn * (na * o.m2 - nb * m2);
+            }
+            m2 += o.m2 + delta * dn * na * nb;
+            mean += dn * nb;
+            count += o.count;
+        }
+
+        void append(const T* first, std::size_t n) noexcept;
+
+        T variance() const noexcept { return count > 0 ? m2 / static_cast<T>(count) : T(0); }
+        T sample_variance() const noexcept { return count > 1 ? m2 / static_cast<T>(count - 1) : T(0); }
+        T stddev() const noexcept { return std::sqrt(variance()); }
+        T skewness() const noexcept
+        {
+            static_assert(Order == 4, "skewness needs moments<4>");
+            return m2 > 0 ? std::sqrt(static_cast<T>(count)) * m3 / (m2 * std::sqrt(m2)) : T(0);
+        }
+        T kurtosis() const noexcept
+        {
+            static_assert(Order == 4, "kurtosis needs moments<4>");
+            return m2 > 0 ? static_cast<T>(count) * m4 / (m2 * m2) - 3 : T(0);
+        }
+    };
+
+    namespace detail
+    {
+        // Lanes = the kernels' layout: L means, then L M2s, L M3s, L M4s; each lane
+        // consumed `steps` elements (the first L * steps of the input).
+        template <class T, int Order>
+        moment_state<T, Order> merge_lanes(const T* lanes, std::size_t L, std::size_t steps) noexcept
+        {
+            moment_state<T, Order> s;
+            for (std::size_t j = 0; j < L; ++j)
+            {
+                moment_state<T, Order> lane;
+                lane.count = steps;
+                lane.mean = lanes[j];
+                lane.m2 = lanes[L + j];
+                if constexpr (Order == 4)
+                {
+                    lane.m3 = lanes[2 * L + j];
+                    lane.m4 = lanes[3 * L + j];
+                }
+                s.merge(lane);
+            }
+            return s;
+        }
+
+        template <class T, int Order>
+        std::size_t moments_lanes_portable(const T* first, std::size_t n, T* lanes) noexcept
+        {
+            constexpr std::size_t L = native<T>::size() * (Order == 4 ? 2 : 4);
+            using V = fixed<T, L>;
+            const std::size_t steps = n / L;
+            if (steps == 0) return 0;
+            V mean(T{0}), m2(T{0}), m3(T{0}), m4(T{0});
+            for (std::size_t k = 1; k <= steps; ++k)
+            {
+                const T nk = static_cast<T>(k), inv = T(1) / nk;
+                const V x(first + (k - 1) * L, elem_aligned);
+                const V delta = x - mean, dn = delta * V(inv);
+                if constexpr (Order == 4)
+                {
+                    const V t1 = delta * dn * V(nk - 1), dn2 = dn * dn;
+                    m4 += t1 * dn2 * V(nk * nk - 3 * nk + 3) + V(T(6)) * dn2 * m2 - V(T(4)) * dn * m3;
+                    m3 += t1 * dn * V(nk - 2) - V(T(3)) * dn * m2;
+                    m2 += t1;
+                    mean += dn;
+                }
+                else
+                {
+                    mean += dn;
+                    m2 += delta * (x - mean);   // the classic two-delta form: one multiply fewer
+                }
+            }
+            mean.copy_to(lanes, elem_aligned);
+            m2.copy_to(lanes + L, elem_aligned);
+            if constexpr (Order == 4)
+            {
+                m3.copy_to(lanes + 2 * L, elem_aligned);
+                m4.copy_to(lanes + 3 * L, elem_aligned);
+            }
+            return L;
+        }
+
+        template <class T, int Order>
+        moment_state<T, Order> moments_portable(const T* first, std::size_t n) noexcept
+        {
+            T lanes[4 * platform::moments_max_lanes];
+            const std::size_t L = moments_lanes_portable<T, Order>(first, n, lanes);
+            const std::size_t steps = L > 0 ? n / L : 0;
+            moment_state<T, Order> s = merge_lanes<T, Order>(lanes, L, steps);
+            for (std::size_t i = L * steps; i < n; ++i) s.push(first[i]);
+            return s;
+        }
+    } // namespace detail
+
+    template <int Order = 2, class T>
+    moment_state<T, Order> moments(const T* first, std::size_t n) noexcept
+    {
+        std::size_t (*fn)(const T*, std::size_t, bool, T*) noexcept = nullptr;
+        if constexpr (std::is_same_v<T, float>) fn = platform::moments_f32_slot();
+        else if constexpr (std::is_same_v<T, double>) fn = platform::moments_f64_slot();
+        if (fn == nullptr) return detail::moments_portable<T, Order>(first, n);
+
+        T lanes[4 * platform::moments_max_lanes];
+        const std::size_t L = fn(first, n, Order == 4, lanes);
+        const std::size_t steps = L > 0 ? n / L : 0;
+        moment_state<T, Order> s = detail::merge_lanes<T, Order>(lanes, L, steps);
+        for (std::size_t i = L * steps; i < n; ++i) s.push(first[i]);
+        return s;
+    }
+
+    template <int Order = 2, class C>
+    auto moments(const C& c) noexcept
+    {
+        return moments<Order>(c.data(), c.size());
+    }
+
+    template <class T, int Order>
+    void moment_state<T, Order>::append(const T* first, std::size_t n) noexcept
+    {
+        merge(moments<Order>(first, n));
+    }
+} // namespace simdtl
@@ -0,0 +1,296 @@
+#pragma once
+// ── L4: a small predicate vocabulary recognised at compile time ───────────────
+//   eq(v) ne(v) lt(v) le(v) gt(v) ge(v)   x == v, x != v, x < v, ...
+//   between(lo, hi)                        lo <= x && x <= hi (closed)
+//   in_set(a, b, ...)                      x equals one of the values
+// Each is an ordinary ELEMENTAL predicate (callable on T and on native<T>), so
+// it works with every algorithm taking `pred`. copy_if / remove_if / count_if
+// additionally recognise them and hand (op, constants) to dispatched AVX2 /
+// AVX-512 compare + compress kernels for all 1/2/4/8-byte integer and float /
+// double columns — no lambda, no custom kernel. Both paths compare integer
+// columns against the constant's exact value: a constant outside the column's
+// range (gt(300) on uint8, lt(-1) on uint32) or with a fraction (lt(2.5) on
+// int) is resolved into an equivalent in-range compare, or into an always-true
+// x >= min / always-false x < min. Float columns take the constant by
+// static_cast. Float compares are IEEE: every op but ne is false for NaN.
+#include "../platform/dispatch.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // v as an X: a cast for scalars, a broadcast for vectors.
+        template <class X, class U> requires std::is_arithmetic_v<X>
+        X splat(U v) noexcept { return static_cast<X>(v); }
+        template <class X, class U> requires (!std::is_arithmetic_v<X>)
+        X splat(U v) noexcept { return X(static_cast<typename X::value_type>(v)); }
+
+        template <class X, bool = std::is_arithmetic_v<X>>
+        struct pred_elem { using type = X; };
+        template <class X>
+        struct pred_elem<X, false> { using type = typename X::value_type; };
+        template <class X> using pred_elem_t = typename pred_elem<X>::type;
+
+        // `x Op v` over an element type E, as (op, value) with value in E.
+        template <class E>
+        struct resolved_cmp
+        {
+            platform::cmp_op op;
+            E value;
+        };
+
+        template <class E>
+        inline constexpr bool exact_cmp_v = std::is_integral_v<E> && !std::is_same_v<E, bool>;
+
+        // For integer E, resolves `x Op v` exactly: a fractional v rounds toward
+        // the same integer set (x < 2.5 is x < 3), and a v outside E's range (or
+        // NaN) decides the compare outright, as x >= min (always) or x < min
+        // (never). Other E take static_cast<E>(v).
+        template <class E, class U>
+        resolved_cmp<E> resolve_cmp(platform::cmp_op op, U v) noexcept
+        {
+            using platform::cmp_op;
+            if constexpr (!exact_cmp_v<E>)
+                return {op, static_cast<E>(v)};
+            else
+            {
+                using L = std::numeric_limits<E>;
+                const resolved_cmp<E> always{cmp_op::ge, L::min()}, never{cmp_op::lt, L::min()};
+                const auto w = +v;   // char / bool promoted, for std::cmp_less
+                using W = decltype(w);
+                int side = 0;        // -1 below E's range, +1 above
+                E c{};
+                if constexpr (std::is_floating_point_v<W>)
+                {
+                    if (w != w) return op == cmp_op::ne ? always : never;
+                    const W r = op == cmp_op::lt || op == cmp_op::ge ? std::ceil(w)
+                              : op == cmp_op::le || op == cmp_op::gt ? std::floor(w) : w;
+                    if (r != std::floor(r)) return op == cmp_op::ne ? always : never;   // eq / ne only
+                    // min is 0 or -2^digits and max 2^digits - 1: both bounds exact in W.
+                    if (r < static_cast<W>(L::min())) side = -1;
+                    else if (r >= std::ldexp(W(1), L::digits)) side = 1;
+                    else c = static_cast<E>(r);
+                }
+                else
+                {
+                    if (std::cmp_less(w, +L::min())) side = -1;
+                    else if (std::cmp_greater(w, +L::max())) side = 1;
+                    else c = static_cast<E>(w);
+                }
+                if (side == 0) return {op, c};
+                const bool holds = side < 0 ? op == cmp_op::gt || op == cmp_op::ge || op == cmp_op::ne
+                                            : op == cmp_op::lt || op == cmp_op::le || op == cmp_op::ne;
+                return holds ? always : never;
+            }
+        }
+
+        template <class X>
+        auto apply_cmp(const X& x, const resolved_cmp<pred_elem_t<X>>& r) noexcept
+        {
+            using platform::cmp_op;
+            const X c = splat<X>(r.value);
+            switch (r.op)
+            {
+            case cmp_op::eq: return x == c;
+            case cmp_op::ne: return x != c;
+            case cmp_op::lt: return x < c;
+            case cmp_op::le: return x <= c;
+            case cmp_op::gt: return x > c;
+            default: return x >= c;
+            }
+        }
+
+        // [lo, hi] over E: lo >= v_lo and hi <= v_hi resolved, empty if either
+        // side can never hold (the kernels take an empty range as x < min).
+        template <class E>
+        struct resolved_range
+        {
+            bool empty;
+            E lo, hi;
+        };
+
+        template <class E, class U>
+        resolved_range<E> resolve_range(U lo, U hi) noexcept
+        {
+            using platform::cmp_op;
+            if constexpr (!exact_cmp_v<E>)
+                return {false, static_cast<E>(lo), static_cast<E>(hi)};
+            else
+            {
+                using L = std::numeric_limits<E>;
+                const auto a = resolve_cmp<E>(cmp_op::ge, lo), b = resolve_cmp<E>(cmp_op::le, hi);
+                // Each side is its own op, or ge min (always) / lt min (never).
+                if (a.op == cmp_op::lt || b.op == cmp_op::lt) return {true, L::min(), L::min()};
+                return {false, a.value, b.op == cmp_op::ge ? L::max() : b.value};
+            }
+        }
+
+        template <platform::cmp_op Op, class U>
+        struct compare_pred
+        {
+            U value;
+            static constexpr std::size_t set_size = 0;
+
+            template <class X>
+            auto operator()(const X& x) const noexcept
+            {
+                return apply_cmp(x, resolve_cmp<pred_elem_t<X>>(Op, value));
+            }
+
+            template <class T>
+            void fill(platform::filter_spec<T>& s, T*) const noexcept
+            {
+                const auto r = resolve_cmp<T>(Op, value);
+                s.op = r.op;
+                s.lo = s.hi = r.value;
+            }
+        };
+
+        template <class U>
+        struct between_pred
+        {
+            U lo, hi;
+            static constexpr std::size_t set_size = 0;
+
+            template <class X>
+            auto operator()(const X& x) const noexcept
+            {
+                using E = pred_elem_t<X>;
+                const auto r = resolve_range<E>(lo, hi);
+                if (r.empty) return x < splat<X>(r.lo);   // integers only: x < min
+                return (x >= splat<X>(r.lo)) && (x <= splat<X>(r.hi));
+            }
+
+            template <class T>
+            void fill(platform::filter_spec<T>& s, T*) const noexcept
+            {
+                const auto r = resolve_range<T>(lo, hi);
+                s.op = r.empty ? platform::cmp_op::lt : platform::cmp_op::between;
+                s.lo = r.lo;
+                s.hi = r.hi;
+            }
+        };
+
+        template <class U, std::size_t N>
+        struct in_set_pred
+        {
+            std::array<U, N> values;
+            static constexpr std::size_t set_size = N;
+
+            // Values E cannot hold resolve to never (lt) and drop out of the set.
+            template <class X>
+            auto operator()(const X& x) const noexcept
+            {
+                using E = pred_elem_t<X>;
+                if constexpr (!exact_cmp_v<E>)
+                {
+                    auto m = x == splat<X>(values[0]);
+                    for (std::size_t j = 1; j < N; ++j) m = m || (x == splat<X>(values[j]));
+                    return m;
+                }
+                else
+                {
+                    auto m = x < splat<X>(std::numeric_limits<E>::min());
+                    for (std::size_t j = 0; j < N; ++j)
+                    {
+                        const auto r = resolve_cmp<E>(platform::cmp_op::eq, values[j]);
+                        if (r.op == platform::cmp_op::eq) m = m || (x == splat<X>(r.value));
+                    }
+                    return m;
+                }
+            }
+
+            template <class T>
+            void fill(platform::filter_spec<T>& s, T* storage) const noexcept
+            {
+                std::size_t k = 0;
+                for (std::size_t j = 0; j < N; ++j)
+                {
+                    const auto r = resolve_cmp<T>(platform::cmp_op::eq, values[j]);
+                    if (r.op == platform::cmp_op::eq) storage[k++] = r.value;
+                }
+                s.op = k != 0 ? platform::cmp_op::in_set : platform::cmp_op::lt;
+                s.lo = s.hi = k != 0 ? storage[0] : std::numeric_limits<T>::min();
+                s.set = storage;
+                s.set_n = k;
+            }
+        };
+
+        template <class P> inline constexpr bool is_compare_pred_v = false;
+        template <platform::cmp_op Op, class U> inline constexpr bool is_compare_pred_v<compare_pred<Op, U>> = true;
+        template <class U> inline constexpr bool is_compare_pred_v<between_pred<U>> = true;
+        template <class U, std::size_t N> inline constexpr bool is_compare_pred_v<in_set_pred<U, N>> = true;
+
+        // The kernel element type for T: the fixed-width integer of T's size and
+        // signedness (so char / long route too), float, double; void otherwise.
+        template <std::size_t Size>
+        using int_of_size = std::conditional_t<Size == 1, std::int8_t,
+                            std::conditional_t<Size == 2, std::int16_t,
+                            std::conditional_t<Size == 4, std::int32_t, std::int64_t>>>;
+
+        template <class T, bool = std::is_integral_v<T> && !std::is_same_v<T, bool>>
+        struct filter_key { using type = void; };
+        template <class T>
+        struct filter_key<T, true>
+        {
+            using type = std::conditional_t<std::is_signed_v<T>, int_of_size<sizeof(T)>,
+                                            std::make_unsigned_t<int_of_size<sizeof(T)>>>;
+        };
+        template <> struct filter_key<float, false> { using type = float; };
+        template <> struct filter_key<double, false> { using type = double; };
+        template <class T> using filter_key_t = typename filter_key<T>::type;
+
+        template <class K>
+        platform::filter_fn<K> filter_slot() noexcept
+        {
+            if constexpr (std::is_same_v<K, std::int8_t>) return platform::filter_i8_slot();
+            else if constexpr (std::is_same_v<K, std::uint8_t>) return platform::filter_u8_slot();
+            else if constexpr (std::is_same_v<K, std::int16_t>) return platform::filter_i16_slot();
+            else if constexpr (std::is_same_v<K, std::uint16_t>) return platform::filter_u16_slot();
+            else if constexpr (std::is_same_v<K, std::int32_t>) return platform::filter_i32_slot();
+            else if constexpr (std::is_same_v<K, std::uint32_t>) return platform::filter_u32_slot();
+            else if constexpr (std::is_same_v<K, std::int64_t>) return platform::filter_i64_slot();
+            else if constexpr (std::is_same_v<K, std::uint64_t>) return platform::filter_u64_slot();
+            else if constexpr (std::is_same_v<K, float>) return platform::filter_f32_slot();
+            else return platform::filter_f64_slot();
+        }
+
+        // Whether copy_if / remove_if / count_if can hand `Pred` over T to a kernel.
+        template <class T, class Pred>
+        inline constexpr bool filter_routable_v = is_compare_pred_v<Pred> && !std::is_void_v<filter_key_t<T>>;
+
+        // Runs the installed filter kernel for T (filter_routable_v<T, Pred> must
+        // hold and the slot must be non-null): keep iff pred(x) != negate.
+        template <class T, class Pred>
+        std::size_t run_filter(const T* first, std::size_t n, const Pred& pred, bool negate, T* out) noexcept
+        {
+            using K = filter_key_t<T>;
+            K set[Pred::set_size ? Pred::set_size : 1];
+            platform::filter_spec<K> s{platform::cmp_op::eq, negate, K{}, K{}, nullptr, 0};
+            pred.fill(s, set);
+            return filter_slot<K>()(reinterpret_cast<const K*>(first), n, s, reinterpret_cast<K*>(out));
+        }
+    } // namespace detail
+
+    template <class U> constexpr auto eq(U v) noexcept { return detail::compare_pred<platform::cmp_op::eq, U>{v}; }
+    template <class U> constexpr auto ne(U v) noexcept { return detail::compare_pred<platform::cmp_op::ne, U>{v}; }
+    template <class U> constexpr auto lt(U v) noexcept { return detail::compare_pred<platform::cmp_op::lt, U>{v}; }
+    template <class U> constexpr auto le(U v) noexcept { return detail::compare_pred<platform::cmp_op::le, U>{v}; }
+    template <class U> constexpr auto gt(U v) noexcept { return detail::compare_pred<platform::cmp_op::gt, U>{v}; }
+    template <class U> constexpr auto ge(U v) noexcept { return detail::compare_pred<platform::cmp_op::ge, U>{v}; }
+
+    template <class U> constexpr auto between(U lo, U hi) noexcept { return detail::between_pred<U>{lo, hi}; }
+
+    template <class U, class... Us>
+    constexpr auto in_set(U first, Us... rest) noexcept
+    {
+        return detail::in_set_pred<U, 1 + sizeof...(Us)>{{first, static_cast<U>(rest)...}};
+    }
+} // namespace simdtl
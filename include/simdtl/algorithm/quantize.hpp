@@ -0,0 +1,187 @@
+#pragma once
+// ── L4: linear quantize / dequantize (float <-> int8 / uint8) ─────────────────
+// The affine scheme of ONNX / TFLite / PyTorch:
+//   quantize:   q = clamp(rint(x * (1 / scale)) + zero_point, Out's range)
+//   dequantize: x = float(q - zero_point) * scale
+// 1 / scale is taken once (as the reference implementations do); rounding is
+// to nearest even in the default FP mode; +-inf saturate; NaN maps to
+// zero_point, i.e. to 0.0f on the way back. The integer subtract in dequantize
+// is exact, so the one multiply is correctly rounded (a fused
+// q * scale - zero_point * scale would not be), and every path gives the same
+// bits. zero_point should lie in Out's range and scale be positive and finite.
+// calibrate / calibrate_symmetric pick (scale, zero_point) from the data's
+// minmax_value so the full range (widened to include 0, which must stay exact)
+// maps onto Out. They assume NaN-free input.
+// Dispatch: int8 / uint8 at AVX2 (vmulps, clamp, vcvtps2dq, vpackss / vpackus)
+// and AVX-512 (vpmovdb); any other integral Out runs the portable transform.
+// Out's bounds are only exact floats below 2^24, so wider Outs (int32, int64,
+// ...) finish through convert_saturate's saturate_one / saturate_lanes.
+#include "../backend/names.hpp"
+#include "../platform/dispatch.hpp"
+#include "convert.hpp"
+#include "minmax.hpp"
+#include "transform.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace simdtl
+{
+    struct quant_params
+    {
+        float scale = 1.0f;
+        std::int32_t zero_point = 0;
+    };
+
+    namespace detail
+    {
+        // Clamping before rounding is the same as after: the bounds are integers.
+        // Past float's 24 digits the upper bound rounds up to 2^digits, which
+        // the final saturating cast (not a plain one) pins back to Out's max.
+        template <class Out>
+        struct quantize_op
+        {
+            float inv_scale;
+            float zero_point;
+
+            static constexpr bool exact_bounds = std::numeric_limits<Out>::digits < std::numeric_limits<float>::digits;
+
+            template <class X>
+            auto operator()(const X& x) const noexcept
+            {
+                const float lo = static_cast<float>(std::numeric_limits<Out>::min()) - zero_point;
+                const float hi = static_cast<float>(std::numeric_limits<Out>::max()) - zero_point;
+                if constexpr (std::is_arithmetic_v<X>)
+                {
+                    float t = x * inv_scale;
+                    if (!(t == t)) t = 0.0f;
+                    t = t < lo ? lo : hi < t ? hi : t;
+                    if constexpr (exact_bounds) return std::rint(t) + zero_point;
+                    else return saturate_one<Out>(std::rint(t) + zero_point);
+                }
+                else
+                {
+                    X t = x * X(inv_scale);
+                    where(!(t == t), t) = 0.0f;
+                    t = elem_min(elem_max(t, X(lo)), X(hi));
+                    if constexpr (exact_bounds) return round_even_lanes(t) + X(zero_point);
+                    else return saturate_lanes<Out>(round_even_lanes(t) + X(zero_point));
+                }
+            }
+        };
+
+        struct dequantize_op
+        {
+            float scale;
+            std::int32_t zero_point;
+
+            template <class X>
+            auto operator()(const X& q) const noexcept
+            {
+                const auto d = lane_cast<std::int32_t>(q) - zero_point;
+                return lane_cast<float>(d) * scale;
+            }
+        };
+
+        template <class Out>
+        void quantize_portable(const float* first, std::size_t n, float inv_scale, std::int32_t zero_point,
+                               Out* out) noexcept
+        {
+            transform(first, n, out, quantize_op<Out>{inv_scale, static_cast<float>(zero_point)});
+        }
+
+        template <class In>
+        void dequantize_portable(const In* first, std::size_t n, float scale, std::int32_t zero_point,
+                                 float* out) noexcept
+        {
+            transform(first, n, out, dequantize_op{scale, zero_point});
+        }
+    } // namespace detail
+
+    template <class Out>
+    void quantize(const float* first, std::size_t n, float scale, std::int32_t zero_point, Out* out) noexcept
+    {
+        static_assert(std::is_integral_v<Out>, "quantize produces integers");
+        const float inv_scale = 1.0f / scale;
+        if constexpr (std::is_same_v<Out, std::int8_t>)
+        {
+            if (auto fn = platform::quantize_i8_slot()) return fn(first, n, inv_scale, zero_point, out);
+        }
+        else if constexpr (std::is_same_v<Out, std::uint8_t>)
+        {
+            if (auto fn = platform::quantize_u8_slot()) return fn(first, n, inv_scale, zero_point, out);
+        }
+        detail::quantize_portable(first, n, inv_scale, zero_point, out);
+    }
+
+    template <class In>
+    void dequantize(const In* first, std::size_t n, float scale, std::int32_t zero_point, float* out) noexcept
+    {
+        static_assert(std::is_integral_v<In>, "dequantize reads integers");
+        if constexpr (std::is_same_v<In, std::int8_t>)
+        {
+            if (auto fn = platform::dequantize_i8_slot()) return fn(first, n, scale, zero_point, out);
+        }
+        else if constexpr (std::is_same_v<In, std::uint8_t>)
+        {
+            if (auto fn = platform::dequantize_u8_slot()) return fn(first, n, scale, zero_point, out);
+        }
+        detail::dequantize_portable(first, n, scale, zero_point, out);
+    }
+
+    template <class Out>
+    void quantize(const float* first, std::size_t n, quant_params p, Out* out) noexcept
+    {
+        quantize(first, n, p.scale, p.zero_point, out);
+    }
+    template <class In>
+    void dequantize(const In* first, std::size_t n, quant_params p, float* out) noexcept
+    {
+        dequantize(first, n, p.scale, p.zero_point, out);
+    }
+
+    // Asymmetric parameters for [lo, hi]: the range is widened to include 0,
+    // scale spreads it over Out's 2^bits - 1 steps, and zero_point is where 0
+    // lands (rounded, so 0 is exactly representable). An all-zero range gives
+    // scale 1.
+    template <class Out>
+    quant_params choose_quant_params(float lo, float hi) noexcept
+    {
+        static_assert(std::is_integral_v<Out>, "quantized type must be integral");
+        constexpr float qmin = static_cast<float>(std::numeric_limits<Out>::min());
+        constexpr float qmax = static_cast<float>(std::numeric_limits<Out>::max());
+        lo = lo < 0.0f ? lo : 0.0f;
+        hi = hi > 0.0f ? hi : 0.0f;
+        quant_params p;
+        p.scale = (hi - lo) / (qmax - qmin);
+        if (!(p.scale > 0.0f) || !std::isfinite(p.scale)) p.scale = 1.0f;
+        float zp = std::rint(qmin - lo / p.scale);
+        zp = zp < qmin ? qmin : qmax < zp ? qmax : zp;
+        p.zero_point = static_cast<std::int32_t>(zp);
+        return p;
+    }
+
+    template <class Out>
+    quant_params calibrate(const float* first, std::size_t n) noexcept
+    {
+        const auto [lo, hi] = minmax_value(first, n);
+        return choose_quant_params<Out>(lo, hi);
+    }
+
+    // int8 with zero_point 0: scale = max |x| / 127 (-128 stays unused, so the
+    // range is symmetric).
+    inline quant_params calibrate_symmetric(const float* first, std::size_t n) noexcept
+    {
+        const auto [lo, hi] = minmax_value(first, n);
+        const float m = -lo > hi ? -lo : hi;
+        quant_params p;
+        p.scale = m > 0.0f && std::isfinite(m) ? m / 127.0f : 1.0f;
+        return p;
+    }
+
+    template <class C, class Out> void quantize(const C& c, quant_params p, Out* out)   { quantize(c.data(), c.size(), p, out); }
+    template <class Out, class C> quant_params calibrate(const C& c)                     { return calibrate<Out>(c.data(), c.size()); }
+    template <class C> quant_params calibrate_symmetric(const C& c)                      { return calibrate_symmetric(c.data(), c.size()); }
+} // namespace simdtl
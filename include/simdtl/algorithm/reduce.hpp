@@ -4,8 +4,39 @@
 // old float-only horizontal_sum. NOTE: this assumes associativity/commutativity —
 // for floating point the result may differ bit-for-bit from a sequential
 // std::accumulate because the summation order changes.
+//
+// reduce_wide<Acc>(first, n, init): the sum accumulated in the wider Acc, for
+// narrow element types where `reduce` would overflow within a few elements.
+// Dispatched kernels for int8/uint8 (psadbw against zero: 8 bytes -> one u64
+// per step, never overflows; int8 is biased to unsigned and corrected),
+// int16/uint16 (pmaddwd by 1 into int32 lanes, flushed to int64 before they
+// can overflow) with Acc = int64 / uint64, and float with Acc = double (every
+// element converted before the add). Other pairs take a scalar loop in Acc.
+//
+// Floating-point modes (any arithmetic T, meant for float/double):
+//   reduce_kahan: Neumaier-compensated sum — every lane carries a running
+//     correction (the exact TwoSum error of each add), folded back into the
+//     lane sum every kahan_renorm steps (a correction left to grow loses bits of
+//     its own: 2^22 x 0.1f is off by ~460 without the fold, exact with it), and
+//     the lanes are combined with the same scheme. Error stays near one
+//     rounding whatever n is. Seven adds per element instead of one: about 2x
+//     the time of `reduce`, still ~2x faster than a sequential std::accumulate.
+//     Like `reduce`, the result depends on the native width.
+//   reduce_deterministic / parallel_reduce_deterministic: one fixed association
+//     tree, so the result is bit-identical across ISA tiers, native widths and
+//     thread counts. Blocks of deterministic_block elements are summed in
+//     deterministic_lanes strided lanes (a zero-padded final group), the lanes
+//     folded pairwise (lane[j] += lane[j + 8], then + 4, + 2, + 1), and the
+//     block sums added left to right onto init. The parallel form only changes
+//     who computes each block sum. (The 16 independent lanes also make it
+//     ~3x faster than `reduce` on 64K floats at the SSE2 baseline.)
 #include "../backend/names.hpp"
+#include "../detail/parallel.hpp"
+#include "../platform/dispatch.hpp"
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 
 namespace simdtl
 {
@@ -14,16 +45,16 @@ namespace simdtl
     {
         using V = native<T>;
         constexpr std::size_t W = V::size();
-        std::size_t i = 0;
+        const std::size_t body = n - n % W;
         T result = init;
-        if (n >= W)
+        if (body > 0)
         {
             V acc(T{0});
-            for (; i + W <= n; i += W)
+            for (std::size_t i = 0; i < body; i += W)
                 acc += V(first + i, elem_aligned);
             result += hsum(acc);
         }
-        for (; i < n; ++i)
+        for (std::size_t i = body; i < n; ++i)
             result += first[i];
         return result;
     }
@@ -35,9 +66,201 @@ namespace simdtl
         return reduce(first, n, init);
     }
 
+    // reduce(first, n, init, op) — fold with an ELEMENTAL binary op (callable on
+    // simd<T> pairs and on T pairs), e.g. `[](auto a, auto b){ return a * b; }`,
+    // `a & b`, or `elem_max(a, b)`. op must be associative and commutative. No
+    // identity is needed: the lane accumulators start from the first W elements,
+    // then init and the lanes are folded left to right.
+    template <class T, class Op>
+    T reduce(const T* first, std::size_t n, T init, Op op) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        const std::size_t body = n - n % W;
+        T result = init;
+        if (body > 0)
+        {
+            V acc(first, elem_aligned);
+            for (std::size_t i = W; i < body; i += W)
+                acc = op(acc, V(first + i, elem_aligned));
+            for (std::size_t j = 0; j < W; ++j)
+                result = op(result, T(acc[j]));
+        }
+        for (std::size_t i = body; i < n; ++i)
+            result = op(result, first[i]);
+        return result;
+    }
+
+    namespace detail
+    {
+        template <class Acc, class T>
+        Acc reduce_wide_portable(const T* first, std::size_t n) noexcept
+        {
+            Acc a0{}, a1{}, a2{}, a3{};
+            const std::size_t body = n - n % 4;
+            for (std::size_t i = 0; i < body; i += 4)
+            {
+                a0 += static_cast<Acc>(first[i]);
+                a1 += static_cast<Acc>(first[i + 1]);
+                a2 += static_cast<Acc>(first[i + 2]);
+                a3 += static_cast<Acc>(first[i + 3]);
+            }
+            for (std::size_t i = body; i < n; ++i) a0 += static_cast<Acc>(first[i]);
+            return (a0 + a1) + (a2 + a3);
+        }
+    } // namespace detail
+
+    template <class Acc, class T>
+    Acc reduce_wide(const T* first, std::size_t n, Acc init = Acc{}) noexcept
+    {
+        if constexpr (std::is_same_v<T, std::int8_t> && std::is_same_v<Acc, std::int64_t>)
+        {
+            if (auto fn = platform::reduce_wide_i8_slot()) return init + fn(first, n);
+        }
+        else if constexpr (std::is_same_v<T, std::uint8_t> && std::is_same_v<Acc, std::uint64_t>)
+        {
+            if (auto fn = platform::reduce_wide_u8_slot()) return init + fn(first, n);
+        }
+        else if constexpr (std::is_same_v<T, std::int16_t> && std::is_same_v<Acc, std::int64_t>)
+        {
+            if (auto fn = platform::reduce_wide_i16_slot()) return init + fn(first, n);
+        }
+        else if constexpr (std::is_same_v<T, std::uint16_t> && std::is_same_v<Acc, std::uint64_t>)
+        {
+            if (auto fn = platform::reduce_wide_u16_slot()) return init + fn(first, n);
+        }
+        else if constexpr (std::is_same_v<T, float> && std::is_same_v<Acc, double>)
+        {
+            if (auto fn = platform::reduce_wide_f32_slot()) return init + fn(first, n);
+        }
+        return init + detail::reduce_wide_portable<Acc>(first, n);
+    }
+
+    namespace detail
+    {
+        // Neumaier step: s + x with the rounding error of that add folded into c.
+        template <class T>
+        void neumaier_add(T& s, T& c, T x) noexcept
+        {
+            const T t = s + x;
+            if ((s < T{0} ? -s : s) >= (x < T{0} ? -x : x)) c += (s - t) + x;
+            else                                            c += (x - t) + s;
+            s = t;
+        }
+
+        // Lane-wise a + b, with the exact rounding error of that add in `err`
+        // (Knuth's TwoSum: six adds, no compare/select, any magnitude order).
+        template <class V>
+        V two_sum(V a, V b, V& err) noexcept
+        {
+            const V t = a + b;
+            const V bv = t - a;
+            err = (a - (t - bv)) + (b - bv);
+            return t;
+        }
+
+        // Vector steps between folding the lane corrections back into the sums.
+        inline constexpr std::size_t kahan_renorm = 16;
+
+        inline constexpr std::size_t deterministic_lanes = 16;
+        inline constexpr std::size_t deterministic_block = std::size_t{1} << 12;
+
+        template <class T>
+        T deterministic_block_sum(const T* first, std::size_t len) noexcept
+        {
+            using V = fixed<T, deterministic_lanes>;
+            constexpr std::size_t L = deterministic_lanes;
+            V acc(T{0});
+            std::size_t i = 0;
+            for (; i + L <= len; i += L) acc += V(first + i, elem_aligned);
+            T lane[L] = {};
+            if (i < len)
+            {
+                for (std::size_t j = 0; i + j < len; ++j) lane[j] = first[i + j];
+                acc += V(lane, elem_aligned);
+            }
+            acc.copy_to(lane, elem_aligned);
+            for (std::size_t w = L / 2; w > 0; w /= 2)
+                for (std::size_t j = 0; j < w; ++j) lane[j] += lane[j + w];
+            return lane[0];
+        }
+    } // namespace detail
+
+    template <class T>
+    T reduce_kahan(const T* first, std::size_t n, T init = T{}) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        constexpr std::size_t R = detail::kahan_renorm;
+        const std::size_t body = n - n % (2 * W);
+        T s = init, c = T{0};
+        if (body > 0)
+        {
+            // Two independent (sum, correction) pairs: the add chain is the bottleneck.
+            V s0(T{0}), c0(T{0}), s1(T{0}), c1(T{0}), e0, e1;
+            for (std::size_t i = 0; i < body;)
+            {
+                for (std::size_t k = 0; k < R && i < body; ++k, i += 2 * W)
+                {
+                    s0 = detail::two_sum(s0, V(first + i, elem_aligned), e0);
+                    s1 = detail::two_sum(s1, V(first + i + W, elem_aligned), e1);
+                    c0 += e0;
+                    c1 += e1;
+                }
+                s0 = detail::two_sum(s0, c0, c0);
+                s1 = detail::two_sum(s1, c1, c1);
+            }
+            for (std::size_t j = 0; j < W; ++j)
+            {
+                detail::neumaier_add(s, c, T(s0[j]));
+                detail::neumaier_add(s, c, T(s1[j]));
+                c += T(c0[j]) + T(c1[j]);
+            }
+        }
+        for (std::size_t i = body; i < n; ++i) detail::neumaier_add(s, c, first[i]);
+        return s + c;
+    }
+
+    template <class T>
+    T reduce_deterministic(const T* first, std::size_t n, T init = T{}) noexcept
+    {
+        constexpr std::size_t B = detail::deterministic_block;
+        T s = init;
+        for (std::size_t i = 0; i < n; i += B) s += detail::deterministic_block_sum(first + i, n - i < B ? n - i : B);
+        return s;
+    }
+
+    // Same result as reduce_deterministic for every `threads` (0 = all hardware threads).
+    template <class T>
+    T parallel_reduce_deterministic(const T* first, std::size_t n, T init = T{}, unsigned threads = 0)
+    {
+        constexpr std::size_t B = detail::deterministic_block;
+        const std::size_t blocks = (n + B - 1) / B;
+        if (threads == 0) threads = detail::default_thread_count();
+        std::size_t parts = blocks / 64;   // >= 64 blocks (256K elements) per thread
+        if (parts > threads) parts = threads;
+        if (parts <= 1) return reduce_deterministic(first, n, init);
+
+        std::vector<T> sums(blocks);
+        const std::size_t per = (blocks + parts - 1) / parts;
+        detail::fork_join(parts, [&](std::size_t p) {
+            for (std::size_t b = p * per; b < blocks && b < (p + 1) * per; ++b)
+                sums[b] = detail::deterministic_block_sum(first + b * B, n - b * B < B ? n - b * B : B);
+        });
+        T s = init;
+        for (const T& x : sums) s += x;
+        return s;
+    }
+
     template <class C>
     typename C::value_type reduce(const C& c, typename C::value_type init = {})
     {
         return reduce(c.data(), c.size(), init);
     }
+
+    template <class C, class Op>
+    typename C::value_type reduce(const C& c, typename C::value_type init, Op op)
+    {
+        return reduce(c.data(), c.size(), init, op);
+    }
 } // namespace simdtl
@@ -0,0 +1,147 @@
+#pragma once
+// ── L4: rle_encode / rle_decode (run-length coding) ───────────────────────────
+// rle_encode(first, n, values, lengths): one (value, length) pair per maximal
+// run of equal elements; returns the number of runs (== count_runs). `values`
+// and `lengths` need room for n entries (the worst case; the kernels store
+// whole registers below that bound). rle_decode(values, lengths, runs, out)
+// writes the runs back and returns the elements written (rle_decoded_size).
+// Lengths are uint32_t, so a column holds fewer than 2^32 rows.
+//
+// encode compares each vector with its one-lane-shifted predecessor (as unique
+// does): a lane that differs ends the previous run, so compress_store packs
+// that predecessor into `values` and its index (the run's end) into `lengths`;
+// the ends are then differenced in place by delta_encode. A vector with no
+// boundary (most of a low-cardinality column) costs one compare and a test.
+// decode fills each run with broadcast stores one register wide, letting the
+// last store run past the run's end (the next run overwrites it) as long as it
+// stays inside the output; the final few runs fill exactly.
+// Dispatch: 1/2/4/8-byte integers at AVX2 (vpalignr shift + the crosslane
+// compaction LUTs) and AVX-512 (vpcompress); floats and other T run portable
+// and compare with ==, so -0.0 joins a run of 0.0 and every NaN is its own run.
+#include "../backend/names.hpp"
+#include "../crosslane/compress.hpp"
+#include "../platform/dispatch.hpp"
+#include "copy_if.hpp"
+#include "delta.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // Writes the end index (exclusive) and last value of every run; returns
+        // the number of runs.
+        template <class T>
+        std::size_t rle_ends_portable(const T* first, std::size_t n, T* values, std::uint32_t* ends) noexcept
+        {
+            if (n == 0) return 0;
+            using V = native<T>;
+            constexpr std::size_t W = V::size();
+            std::size_t i = 1, k = 0;
+            for (; i + W <= n; i += W)
+            {
+                const V prev(first + i - 1, elem_aligned);
+                const auto m = V(first + i, elem_aligned) != prev;
+                if (!any_of(m)) continue;
+                compress_store(values + k, prev, m);
+                for (std::size_t j = 0; j < W; ++j)
+                    if (m[j]) ends[k++] = static_cast<std::uint32_t>(i + j);
+            }
+            for (; i < n; ++i)
+                if (!(first[i] == first[i - 1])) { values[k] = first[i - 1]; ends[k++] = static_cast<std::uint32_t>(i); }
+            values[k] = first[n - 1];
+            ends[k++] = static_cast<std::uint32_t>(n);
+            return k;
+        }
+
+        // `n` is the total length (the output's size): whole-register stores
+        // may overhang a run while they stay below it.
+        template <class T>
+        std::size_t rle_decode_portable(const T* values, const std::uint32_t* lengths, std::size_t runs,
+                                        std::size_t n, T* out) noexcept
+        {
+            using V = native<T>;
+            constexpr std::size_t W = V::size();
+            std::size_t p = 0, r = 0;
+            for (; r < runs && p + lengths[r] + W <= n; ++r)
+            {
+                const V v(values[r]);
+                const std::size_t len = lengths[r];
+                for (std::size_t j = 0; j < len; j += W) v.copy_to(out + p + j, elem_aligned);
+                p += len;
+            }
+            for (; r < runs; ++r)
+                for (std::size_t e = p + lengths[r]; p < e; ++p) out[p] = values[r];
+            return p;
+        }
+    } // namespace detail
+
+    // Total elements the runs decode to.
+    inline std::size_t rle_decoded_size(const std::uint32_t* lengths, std::size_t runs) noexcept
+    {
+        std::size_t total = 0;
+        for (std::size_t r = 0; r < runs; ++r) total += lengths[r];
+        return total;
+    }
+
+    template <class T>
+    std::size_t rle_encode(const T* first, std::size_t n, T* values, std::uint32_t* lengths) noexcept
+    {
+        static_assert(std::is_arithmetic_v<T>, "rle_encode: arithmetic element type");
+        const std::size_t runs = [&] {
+            if constexpr (detail::same_width_int_v<T, std::int64_t>)
+            {
+                if (auto fn = platform::rle_encode_i64_slot())
+                    return fn(reinterpret_cast<const std::int64_t*>(first), n, reinterpret_cast<std::int64_t*>(values), lengths);
+            }
+            else if constexpr (detail::same_width_int_v<T, std::int32_t>)
+            {
+                if (auto fn = platform::rle_encode_i32_slot())
+                    return fn(reinterpret_cast<const std::int32_t*>(first), n, reinterpret_cast<std::int32_t*>(values), lengths);
+            }
+            else if constexpr (detail::same_width_int_v<T, std::int16_t>)
+            {
+                if (auto fn = platform::rle_encode_i16_slot())
+                    return fn(reinterpret_cast<const std::int16_t*>(first), n, reinterpret_cast<std::int16_t*>(values), lengths);
+            }
+            else if constexpr (detail::same_width_int_v<T, std::int8_t>)
+            {
+                if (auto fn = platform::rle_encode_i8_slot())
+                    return fn(reinterpret_cast<const std::int8_t*>(first), n, reinterpret_cast<std::int8_t*>(values), lengths);
+            }
+            return detail::rle_ends_portable(first, n, values, lengths);
+        }();
+        delta_encode(lengths, runs, lengths);
+        return runs;
+    }
+
+    template <class T>
+    std::size_t rle_decode(const T* values, const std::uint32_t* lengths, std::size_t runs, T* out) noexcept
+    {
+        static_assert(std::is_arithmetic_v<T>, "rle_decode: arithmetic element type");
+        const std::size_t n = rle_decoded_size(lengths, runs);
+        if constexpr (detail::same_width_int_v<T, std::int64_t>)
+        {
+            if (auto fn = platform::rle_decode_i64_slot())
+                return fn(reinterpret_cast<const std::int64_t*>(values), lengths, runs, n, reinterpret_cast<std::int64_t*>(out));
+        }
+        else if constexpr (detail::same_width_int_v<T, std::int32_t>)
+        {
+            if (auto fn = platform::rle_decode_i32_slot())
+                return fn(reinterpret_cast<const std::int32_t*>(values), lengths, runs, n, reinterpret_cast<std::int32_t*>(out));
+        }
+        else if constexpr (detail::same_width_int_v<T, std::int16_t>)
+        {
+            if (auto fn = platform::rle_decode_i16_slot())
+                return fn(reinterpret_cast<const std::int16_t*>(values), lengths, runs, n, reinterpret_cast<std::int16_t*>(out));
+        }
+        else if constexpr (detail::same_width_int_v<T, std::int8_t>)
+        {
+            if (auto fn = platform::rle_decode_i8_slot())
+                return fn(reinterpret_cast<const std::int8_t*>(values), lengths, runs, n, reinterpret_cast<std::int8_t*>(out));
+        }
+        return detail::rle_decode_portable(values, lengths, runs, n, out);
+    }
+} // namespace simdtl
@@ -0,0 +1,114 @@
+#pragma once
+// ── L4: inclusive_scan / exclusive_scan (prefix sums) ─────────────────────────
+//   inclusive_scan: out[i] = init + first[0] + ... + first[i]
+//   exclusive_scan: out[i] = init + first[0] + ... + first[i-1]   (out[0] = init)
+// `out` may alias `first`. int32/int64 (and same-width unsigned) and float/double
+// route through dispatched SSE2 / AVX2 / AVX-512 kernels: a log-step scan inside
+// each register plus a running carry, so only one add per register is serial
+// (a scalar scan is one dependent add per ELEMENT — 4 cycles each for floats).
+// Other types take the portable sequential loop. Floating point: the kernels
+// reassociate, so results may differ from std::inclusive_scan in the last bits.
+//
+// parallel_inclusive_scan / parallel_exclusive_scan: two passes over P chunks —
+// (1) reduce every chunk but the last, in parallel; (2) a tiny serial scan of
+// the chunk sums gives each chunk its offset; then every chunk is scanned in
+// parallel from that offset. Input is read twice, output written once. Below
+// parallel_scan_grain elements per thread it is just the serial scan.
+#include "../detail/parallel.hpp"
+#include "../platform/dispatch.hpp"
+#include "reduce.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // Minimum elements per thread before the parallel scans fork.
+        inline constexpr std::size_t parallel_scan_grain = std::size_t{1} << 18;
+
+        template <class T>
+        void scan_portable(const T* first, std::size_t n, T* out, T init, bool exclusive) noexcept
+        {
+            T acc = init;
+            if (exclusive)
+                for (std::size_t i = 0; i < n; ++i) { const T x = first[i]; out[i] = acc; acc += x; }
+            else
+                for (std::size_t i = 0; i < n; ++i) { acc += first[i]; out[i] = acc; }
+        }
+
+        // Integer addition wraps identically for signed and unsigned of one width.
+        template <class T, class K>
+        inline constexpr bool scan_int_v = std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) == sizeof(K);
+
+        template <class T>
+        void scan(const T* first, std::size_t n, T* out, T init, bool exclusive) noexcept
+        {
+            if constexpr (scan_int_v<T, std::int32_t>)
+            {
+                if (auto fn = platform::scan_i32_slot())
+                    return fn(reinterpret_cast<const std::int32_t*>(first), n, reinterpret_cast<std::int32_t*>(out),
+                              static_cast<std::int32_t>(init), exclusive);
+            }
+            else if constexpr (scan_int_v<T, std::int64_t>)
+            {
+                if (auto fn = platform::scan_i64_slot())
+                    return fn(reinterpret_cast<const std::int64_t*>(first), n, reinterpret_cast<std::int64_t*>(out),
+                              static_cast<std::int64_t>(init), exclusive);
+            }
+            else if constexpr (std::is_same_v<T, float>)
+            {
+                if (auto fn = platform::scan_f32_slot()) return fn(first, n, out, init, exclusive);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                if (auto fn = platform::scan_f64_slot()) return fn(first, n, out, init, exclusive);
+            }
+            scan_portable(first, n, out, init, exclusive);
+        }
+
+        template <class T>
+        void parallel_scan(const T* first, std::size_t n, T* out, T init, bool exclusive, unsigned threads)
+        {
+            if (threads == 0) threads = default_thread_count();
+            std::size_t parts = n / parallel_scan_grain;
+            if (parts > threads) parts = threads;
+            if (parts <= 1) return scan(first, n, out, init, exclusive);
+
+            const std::size_t chunk = (n + parts - 1) / parts;
+            auto len = [&](std::size_t p) { return (p + 1) * chunk <= n ? chunk : n - p * chunk; };
+            std::vector<T> offset(parts);
+            fork_join(parts - 1, [&](std::size_t p) { offset[p + 1] = simdtl::reduce(first + p * chunk, len(p)); });
+            offset[0] = init;
+            for (std::size_t p = 1; p < parts; ++p) offset[p] += offset[p - 1];
+            fork_join(parts, [&](std::size_t p) { scan(first + p * chunk, len(p), out + p * chunk, offset[p], exclusive); });
+        }
+    } // namespace detail
+
+    template <class T>
+    void inclusive_scan(const T* first, std::size_t n, T* out, T init = T{}) noexcept
+    {
+        detail::scan(first, n, out, init, false);
+    }
+
+    template <class T>
+    void exclusive_scan(const T* first, std::size_t n, T* out, T init = T{}) noexcept
+    {
+        detail::scan(first, n, out, init, true);
+    }
+
+    // threads == 0: one per hardware thread.
+    template <class T>
+    void parallel_inclusive_scan(const T* first, std::size_t n, T* out, T init = T{}, unsigned threads = 0)
+    {
+        detail::parallel_scan(first, n, out, init, false, threads);
+    }
+
+    template <class T>
+    void parallel_exclusive_scan(const T* first, std::size_t n, T* out, T init = T{}, unsigned threads = 0)
+    {
+        detail::parallel_scan(first, n, out, init, true, threads);
+    }
+} // namespace simdtl
@@ -0,0 +1,225 @@
+#pragma once
+// ── L4: lower_bound over sorted arrays (single, batched, k-ary index) ─────────
+// A lone std::lower_bound is a chain of dependent, branch-mispredicting, cache-
+// missing loads. Three remedies, each returning std::lower_bound's INDEX (first
+// position whose element is not < key; n if none):
+//   lower_bound_linear — SIMD count of elements < key; best for short ranges.
+//   lower_bound        — branchless halving (cmov, no mispredicts; both candidate
+//                        next probes prefetched) down to a short window, finished
+//                        linearly.
+//   lower_bound_many   — G searches advanced in LOCKSTEP: every search over the
+//                        same n takes the same number of halvings, so one round
+//                        issues G independent loads and the misses overlap in the
+//                        out-of-order window instead of serialising.
+//                        int32 routes through a dispatched AVX2 gather kernel.
+//   btree_index<T>     — the sorted array re-laid-out as a static (B+1)-ary tree
+//                        of one-cache-line nodes; each level is ONE line fetch +
+//                        a SIMD rank compare, so a search touches log_{B+1}(n)
+//                        lines instead of log_2(n).
+// Requires a strict weak order on the data (no NaNs for floating point).
+#include "../backend/names.hpp"
+#include "../detail/aligned_allocator.hpp"
+#include "../platform/dispatch.hpp"
+#include "../platform/prefetch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // Windows at most this long are finished by the SIMD linear count.
+        inline constexpr std::size_t linear_search_cutoff = 64;
+
+        // Keys searched in lockstep by the portable batched search.
+        inline constexpr std::size_t lower_bound_group = 16;
+
+        template <class T>
+        void lower_bound_many_portable(const T* sorted, std::size_t n, const T* keys, std::size_t m,
+                                       std::size_t* out) noexcept
+        {
+            constexpr std::size_t G = lower_bound_group;
+            for (std::size_t j0 = 0; j0 < m; j0 += G)
+            {
+                const std::size_t g = (m - j0 < G) ? m - j0 : G;
+                const T* k = keys + j0;
+                if (n == 0)
+                {
+                    for (std::size_t t = 0; t < g; ++t) out[j0 + t] = 0;
+                    continue;
+                }
+                // Invariant: the answer for key t lies in [pos[t], pos[t] + len].
+                std::size_t pos[G] = {};
+                std::size_t len = n;
+                while (len > 1)
+                {
+                    const std::size_t half = len / 2;
+                    for (std::size_t t = 0; t < g; ++t)
+                        pos[t] += (sorted[pos[t] + half] < k[t]) ? half : 0;
+                    len -= half;
+                }
+                for (std::size_t t = 0; t < g; ++t)
+                    out[j0 + t] = pos[t] + ((sorted[pos[t]] < k[t]) ? 1 : 0);
+            }
+        }
+    } // namespace detail
+
+    // Vectorized linear search: on sorted data the lower bound IS the number of
+    // elements < key, so a branch-free SIMD count beats any search on short ranges.
+    template <class T>
+    std::size_t lower_bound_linear(const T* sorted, std::size_t n, T key) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        const V vkey(key);
+        std::size_t i = 0, below = 0;
+        for (; i + W <= n; i += W)
+            below += static_cast<std::size_t>(lane_count(V(sorted + i, elem_aligned) < vkey));
+        for (; i < n; ++i)
+            below += (sorted[i] < key) ? std::size_t{1} : std::size_t{0};
+        return below;
+    }
+
+    // Branchless binary search narrowed to a short window, then a linear count.
+    // Without branches the CPU no longer speculates the next load, so we prefetch
+    // both halves' probes ourselves.
+    template <class T>
+    std::size_t lower_bound(const T* sorted, std::size_t n, T key) noexcept
+    {
+        std::size_t base = 0, len = n;
+        while (len > detail::linear_search_cutoff)
+        {
+            const std::size_t half = len / 2;
+            const std::size_t next = (len - half) / 2;   // both possible next probes
+            platform::prefetch(sorted + base + next);
+            platform::prefetch(sorted + base + half + next);
+            base += (sorted[base + half] < key) ? half : 0;
+            len -= half;
+        }
+        return base + lower_bound_linear(sorted + base, len, key);
+    }
+
+    // out[j] = lower_bound(sorted, n, keys[j]) for every j < m.
+    template <class T>
+    void lower_bound_many(const T* sorted, std::size_t n, const T* keys, std::size_t m,
+                          std::size_t* out) noexcept
+    {
+        if constexpr (std::is_same_v<T, std::int32_t>)
+            if (auto fn = platform::lower_bound_many_i32_slot())
+            {
+                fn(sorted, n, keys, m, out);
+                return;
+            }
+        detail::lower_bound_many_portable(sorted, n, keys, m, out);
+    }
+
+    template <class C, class K>
+    void lower_bound_many(const C& sorted, const K& keys, std::size_t* out)
+    {
+        lower_bound_many(sorted.data(), sorted.size(), keys.data(), keys.size(), out);
+    }
+
+    // Static k-ary search tree ("S-tree") over a sorted array. Node k holds B keys
+    // (one 64-byte line) and has B+1 children numbered k*(B+1)+1 .. k*(B+1)+B+1, so
+    // the layout is implicit — no child pointers. Keys are placed by an in-order
+    // walk; the final node is padded with slots that map to index n and hold the
+    // largest value of T (+inf where T has one, so pads still sort after +inf keys). Nodes are line-aligned. Built once (O(n)), then immutable.
+    template <class T>
+    class btree_index
+    {
+    public:
+        static constexpr std::size_t B = 64 / sizeof(T);
+
+        btree_index() = default;
+
+        btree_index(const T* sorted, std::size_t n)
+            : n_(n), nodes_((n + B - 1) / B), keys_(nodes_ * B), pos_(nodes_ * B)
+        {
+            std::size_t next = 0;
+            build(sorted, 0, next);
+        }
+
+        template <class C>
+        explicit btree_index(const C& sorted) : btree_index(sorted.data(), sorted.size()) {}
+
+        std::size_t size() const noexcept { return n_; }
+
+        // Index into the ORIGINAL sorted array, identical to simdtl::lower_bound.
+        std::size_t lower_bound(T key) const noexcept
+        {
+            // Track the candidate SLOT and translate it once at the end, so the
+            // descent touches only key lines (no pos_ miss per level).
+            std::size_t slot = keys_.size(), k = 0;
+            while (k < nodes_)
+            {
+                const std::size_t r = rank(keys_.data() + k * B, key);
+                if (r < B) slot = k * B + r;   // deeper candidates are always smaller
+                k = k * (B + 1) + r + 1;
+            }
+            return slot < keys_.size() ? pos_[slot] : n_;
+        }
+
+        // G descents in lockstep, prefetching each key's next node one level ahead.
+        void lower_bound_many(const T* keys, std::size_t m, std::size_t* out) const noexcept
+        {
+            constexpr std::size_t G = detail::lower_bound_group;
+            for (std::size_t j0 = 0; j0 < m; j0 += G)
+            {
+                const std::size_t g = (m - j0 < G) ? m - j0 : G;
+                std::size_t k[G] = {}, slot[G];
+                for (std::size_t t = 0; t < g; ++t) slot[t] = keys_.size();
+                for (bool live = nodes_ > 0; live;)
+                {
+                    live = false;
+                    for (std::size_t t = 0; t < g; ++t)
+                    {
+                        if (k[t] >= nodes_) continue;
+                        const std::size_t r = rank(keys_.data() + k[t] * B, keys[j0 + t]);
+                        if (r < B) slot[t] = k[t] * B + r;
+                        k[t] = k[t] * (B + 1) + r + 1;
+                        if (k[t] < nodes_) { platform::prefetch(keys_.data() + k[t] * B); live = true; }
+                    }
+                }
+                for (std::size_t t = 0; t < g; ++t)
+                    out[j0 + t] = slot[t] < keys_.size() ? pos_[slot[t]] : n_;
+            }
+        }
+
+    private:
+        using V = native<T>;
+        static_assert(B % V::size() == 0, "a node must be a whole number of native vectors");
+
+        // SIMD compare of the whole node: number of keys < key (0..B).
+        static std::size_t rank(const T* node, T key) noexcept
+        {
+            const V vkey(key);
+            std::size_t r = 0;
+            for (std::size_t s = 0; s < B; s += V::size())
+                r += static_cast<std::size_t>(lane_count(V(node + s, elem_aligned) < vkey));
+            return r;
+        }
+
+        void build(const T* sorted, std::size_t k, std::size_t& next)
+        {
+            if (k >= nodes_) return;
+            for (std::size_t i = 0; i < B; ++i)
+            {
+                build(sorted, k * (B + 1) + i + 1, next);
+                if (next < n_) { keys_[k * B + i] = sorted[next]; pos_[k * B + i] = next; ++next; }
+                else           { keys_[k * B + i] = pad; pos_[k * B + i] = n_; }
+            }
+            build(sorted, k * (B + 1) + B + 1, next);
+        }
+
+        static constexpr T pad = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                       : std::numeric_limits<T>::max();
+
+        std::size_t n_ = 0;
+        std::size_t nodes_ = 0;
+        std::vector<T, detail::aligned_allocator<T>> keys_;   // node k = one 64-byte line
+        std::vector<std::size_t> pos_;
+    };
+} // namespace simdtl
@@ -0,0 +1,275 @@
+#pragma once
+// ── L4: top_k / bottom_k / nth_element (selection by threshold filtering) ─────
+// top_k(first, n, k, out, indices = nullptr): the k largest values, largest
+//   first, into out[0, k) (and their positions into indices, if given; ties go
+//   to the lower position). bottom_k: the k smallest, smallest first. Both
+//   return the count written: min(k, n) minus any NaNs, which are skipped.
+//   Once k candidates are held, the running threshold (the worst of them) is
+//   broadcast and each vector is compared against it; only lanes that beat it
+//   are compress_store'd into a 2k-entry candidate buffer, which is cut back to
+//   the best k (raising the threshold) whenever it fills. On a large input the
+//   threshold quickly sits near the answer, so nearly every vector is discarded
+//   by one compare + any_of.
+// nth_element(first, n, nth): the same contract as std::nth_element (no NaNs).
+//   Two pivots bracketing rank nth are read off a sorted sample; one
+//   vectorized pass counts the elements below / above them, a branchless pass
+//   moves the three groups into place, and only the small middle group (a few
+//   percent of n) is left to std::nth_element. If the bracket misses (unlucky
+//   sample) it falls back to std::nth_element on the whole range.
+// Both allocate a scratch buffer, so neither is noexcept.
+#include "../backend/names.hpp"
+#include "../crosslane/compress.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace simdtl
+{
+    namespace detail
+    {
+        // Below this, std::nth_element on the range beats the two passes.
+        inline constexpr std::size_t nth_element_cutoff = 4096;
+
+        template <bool Largest, class T>
+        bool select_better(T a, T b) noexcept
+        {
+            return Largest ? b < a : a < b;
+        }
+
+        // Candidate buffer for top_k / bottom_k: up to 2k + W entries (values, plus
+        // positions when asked for), cut back to the best k whenever it fills.
+        template <bool Largest, class T>
+        class k_best
+        {
+        public:
+            k_best(std::size_t k, std::size_t lanes, bool with_indices)
+                : k_(k), cap_(2 * k + lanes), vals_(cap_),
+                  pos_(with_indices ? cap_ : 0), order_(with_indices ? cap_ : 0),
+                  kept_vals_(with_indices ? k : 0), kept_pos_(with_indices ? k : 0)
+            {
+            }
+
+            std::size_t size() const noexcept { return size_; }
+            bool with_indices() const noexcept { return !pos_.empty(); }
+            bool room_for(std::size_t m) const noexcept { return size_ + m <= cap_; }
+
+            void push(T v, std::size_t at) noexcept
+            {
+                vals_[size_] = v;
+                if (with_indices()) pos_[size_] = at;
+                ++size_;
+            }
+
+            // Append the kept lanes of v (loaded from position `at`).
+            template <class V, class Mask>
+            void push(const V& v, const Mask& keep, std::size_t at) noexcept
+            {
+                const std::size_t added = compress_store(vals_.data() + size_, v, keep);
+                if (with_indices())
+                    for (std::size_t j = 0, s = size_; j < V::size(); ++j)
+                        if (keep[j]) pos_[s++] = at + j;
+                size_ += added;
+            }
+
+            // Keep the best k (ties: lower position) and return the worst of them.
+            T cut() noexcept
+            {
+                if (!with_indices())
+                {
+                    std::nth_element(vals_.data(), vals_.data() + (k_ - 1), vals_.data() + size_,
+                                     [](T a, T b) { return select_better<Largest>(a, b); });
+                    size_ = k_;
+                    return vals_[k_ - 1];
+                }
+                rank_best(k_);
+                for (std::size_t j = 0; j < k_; ++j)
+                {
+                    kept_vals_[j] = vals_[order_[j]];
+                    kept_pos_[j] = pos_[order_[j]];
+                }
+                std::copy(kept_vals_.begin(), kept_vals_.end(), vals_.begin());
+                std::copy(kept_pos_.begin(), kept_pos_.end(), pos_.begin());
+                size_ = k_;
+                return vals_[k_ - 1];
+            }
+
+            // Write the (at most k) best entries, best first; return the count.
+            std::size_t finish(T* out, std::size_t* indices) noexcept
+            {
+                const std::size_t m = size_ < k_ ? size_ : k_;
+                if (m == 0) return 0;
+                if (!with_indices())
+                {
+                    auto better = [](T a, T b) { return select_better<Largest>(a, b); };
+                    if (size_ > m) std::nth_element(vals_.data(), vals_.data() + (m - 1), vals_.data() + size_, better);
+                    std::sort(vals_.data(), vals_.data() + m, better);
+                    std::copy(vals_.data(), vals_.data() + m, out);
+                    return m;
+                }
+                rank_best(m);
+                std::sort(order_.data(), order_.data() + m, [&](std::size_t a, std::size_t b) { return before(a, b); });
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    out[j] = vals_[order_[j]];
+                    indices[j] = pos_[order_[j]];
+                }
+                return m;
+            }
+
+        private:
+            bool before(std::size_t a, std::size_t b) const noexcept
+            {
+                if (vals_[a] != vals_[b]) return select_better<Largest>(vals_[a], vals_[b]);
+                return pos_[a] < pos_[b];
+            }
+
+            // order_[0, m) = the slots of the best m entries, order_[m - 1] the m-th best.
+            void rank_best(std::size_t m) noexcept
+            {
+                std::iota(order_.begin(), order_.begin() + size_, std::size_t{0});
+                std::nth_element(order_.begin(), order_.begin() + (m - 1), order_.begin() + size_,
+                                 [&](std::size_t a, std::size_t b) { return before(a, b); });
+            }
+
+            std::size_t k_, cap_, size_ = 0;
+            std::vector<T> vals_;
+            std::vector<std::size_t> pos_, order_;
+            std::vector<T> kept_vals_;
+            std::vector<std::size_t> kept_pos_;
+        };
+
+        template <bool Largest, class T>
+        std::size_t select_k(const T* first, std::size_t n, std::size_t k, T* out, std::size_t* indices)
+        {
+            using V = native<T>;
+            constexpr std::size_t W = V::size();
+            if (k > n) k = n;
+            if (k == 0) return 0;
+            k_best<Largest, T> best(k, W, indices != nullptr);
+
+            // Fill with the first k non-NaN values; the worst of them is the first threshold.
+            std::size_t i = 0;
+            for (; i < n && best.size() < k; ++i)
+                if (first[i] == first[i]) best.push(first[i], i);
+            if (best.size() < k) return best.finish(out, indices);
+            T thr = best.cut();
+
+            auto beats = [&](const V& v) { return Largest ? v > V(thr) : v < V(thr); };
+            auto take = [&](std::size_t at) {
+                const V v(first + at, elem_aligned);
+                auto keep = beats(v);
+                if (!any_of(keep)) return;
+                if (!best.room_for(W))
+                {
+                    thr = best.cut();
+                    keep = beats(v);
+                    if (!any_of(keep)) return;
+                }
+                best.push(v, keep, at);
+            };
+            // Discard four vectors per branch while none of them beats the threshold.
+            const std::size_t body4 = i + (n - i) / (4 * W) * (4 * W);
+            for (; i < body4; i += 4 * W)
+            {
+                const V v0(first + i, elem_aligned), v1(first + i + W, elem_aligned);
+                const V v2(first + i + 2 * W, elem_aligned), v3(first + i + 3 * W, elem_aligned);
+                if (none_of((beats(v0) || beats(v1)) || (beats(v2) || beats(v3)))) continue;
+                for (std::size_t j = 0; j < 4; ++j) take(i + j * W);
+            }
+            const std::size_t body = i + (n - i) / W * W;
+            for (; i < body; i += W) take(i);
+            for (; i < n; ++i)
+            {
+                if (!select_better<Largest>(first[i], thr)) continue;
+                if (!best.room_for(1))
+                {
+                    thr = best.cut();
+                    if (!select_better<Largest>(first[i], thr)) continue;
+                }
+                best.push(first[i], i);
+            }
+            return best.finish(out, indices);
+        }
+
+        // Sample size for nth_element's pivot bracket, and the bracket's half-width
+        // in sample ranks (~4 standard deviations of the sample rank of nth).
+        inline std::size_t nth_sample_size(std::size_t n) noexcept
+        {
+            const std::size_t s = n / 256;
+            return s < 1024 ? 1024 : s > 65536 ? 65536 : s;
+        }
+    } // namespace detail
+
+    // out (and indices, if given) must hold min(k, n) entries.
+    template <class T>
+    std::size_t top_k(const T* first, std::size_t n, std::size_t k, T* out, std::size_t* indices = nullptr)
+    {
+        return detail::select_k<true>(first, n, k, out, indices);
+    }
+
+    template <class T>
+    std::size_t bottom_k(const T* first, std::size_t n, std::size_t k, T* out, std::size_t* indices = nullptr)
+    {
+        return detail::select_k<false>(first, n, k, out, indices);
+    }
+
+    // first[nth] becomes the element a full sort would put there; everything
+    // before it is <= it and everything after is >=. No NaNs.
+    template <class T>
+    void nth_element(T* first, std::size_t n, std::size_t nth)
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        if (nth >= n) return;
+        if (n < detail::nth_element_cutoff) return std::nth_element(first, first + nth, first + n);
+
+        // Bracket rank nth between two sample values (or the range ends).
+        const std::size_t s = detail::nth_sample_size(n), stride = n / s;
+        std::vector<T> sample(s);
+        for (std::size_t j = 0; j < s; ++j) sample[j] = first[j * stride + stride / 2];
+        std::sort(sample.begin(), sample.end());
+        const std::size_t r = static_cast<std::size_t>(double(nth) / double(n) * double(s));
+        const std::size_t delta = 2 * static_cast<std::size_t>(std::sqrt(double(s)));
+        const bool has_lo = r >= delta, has_hi = r + delta < s;
+        const T lo = sample[has_lo ? r - delta : 0], hi = sample[has_hi ? r + delta : s - 1];
+
+        // Pass 1: how many fall below lo / above hi.
+        const std::size_t body = n - n % W;
+        std::size_t below = 0, above = 0;
+        for (std::size_t i = 0; i < body; i += W)
+        {
+            const V v(first + i, elem_aligned);
+            if (has_lo) below += static_cast<std::size_t>(lane_count(v < V(lo)));
+            if (has_hi) above += static_cast<std::size_t>(lane_count(v > V(hi)));
+        }
+        for (std::size_t i = body; i < n; ++i)
+        {
+            below += has_lo && first[i] < lo;
+            above += has_hi && hi < first[i];
+        }
+        if (nth < below || nth >= n - above) return std::nth_element(first, first + nth, first + n);
+
+        // Pass 2: the three groups into place. Every element is stored at all
+        // three cursors and only its group's cursor advances — branchless, which
+        // beats compress_store's per-lane branches on this ~50/50 split. One
+        // slack slot after each group absorbs the stores that don't count.
+        const std::size_t middle = n - below - above;
+        std::vector<T> tmp(n + 3);
+        T* lt = tmp.data();
+        T* mid = tmp.data() + below + 1;
+        T* gt = tmp.data() + below + middle + 2;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const T x = first[i];
+            const bool l = has_lo && x < lo, g = has_hi && hi < x;
+            *lt = x; *mid = x; *gt = x;
+            lt += l; gt += g; mid += !(l | g);
+        }
+        std::copy(tmp.data(), tmp.data() + below, first);
+        std::copy(tmp.data() + below + 1, tmp.data() + below + 1 + middle, first + below);
+        std::copy(tmp.data() + below + middle + 2, tmp.data() + n + 2, first + below + middle);
+        std::nth_element(first + below, first + nth, first + (n - above));
+    }
+} // namespace simdtl
@@ -0,0 +1,219 @@
+#pragma once
+// ── L4: batched vector similarity (dot / L2² / cosine) + fused nearest-k ──────
+// One query of `dim` elements against `rows` stored vectors laid out row-major
+// (row r starts at base + r * dim):
+//   dot_many(q, base, rows, dim, out)     out[r] = sum q[i] * row[i]
+//   l2sq_many(q, base, rows, dim, out)    out[r] = sum (row[i] - q[i])^2
+//   cosine_many(q, base, rows, dim, out)  out[r] = dot / (|q| |row|), 0 if either is 0
+// for float, and for int8 (quantized embeddings): int8 dot / L2² are exact in
+// int64 for any dim, int8 cosine is float. The kernels accumulate int32 lanes
+// and flush them into int64 every i8_flush elements, before they can wrap.
+// nearest_k<M>(q, base, rows, dim, k, idx, scores) scores the rows in blocks
+// and keeps the k best (largest dot / cosine, smallest L2²) in a heap held in
+// the caller's output arrays, so nothing is allocated; the result is sorted
+// best first, ties broken by lower row index, and min(k, rows) is returned.
+// float and int8 route through dispatched AVX2 (+FMA3) / AVX-512 kernels that
+// register-block four rows at a time: each query vector is loaded once and
+// feeds four (for dot / L2², eight) independent accumulator chains; float
+// cosine stays on the AVX2 kernel even on AVX-512 machines. The portable
+// path scores row by row through dot / transform_reduce. Float results
+// reassociate, so they may differ from a sequential loop in the last bits.
+#include "transform_reduce.hpp"
+#include "../platform/dispatch.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace simdtl
+{
+    enum class metric { dot, l2sq, cosine };
+
+    // Score type: int64 for int8 dot / L2², float otherwise.
+    template <metric M, class T>
+    using score_t = std::conditional_t<std::is_same_v<T, std::int8_t> && M != metric::cosine, std::int64_t, float>;
+
+    namespace detail
+    {
+        // Rows scored per nearest_k block (the scores live on the stack).
+        inline constexpr std::size_t nearest_block = 256;
+
+        // int8 elements per int32 partial sum: 32768 * 255² < 2^31, so a chunk
+        // of squared differences (or products, at most 128²) cannot wrap.
+        inline constexpr std::size_t i8_flush = 32768;
+
+        inline float cosine_finish(float d, float qq, float rr) noexcept
+        {
+            return qq > 0.0f && rr > 0.0f ? d / (std::sqrt(qq) * std::sqrt(rr)) : 0.0f;
+        }
+
+        // int8 dot products and norms are exact, so every path agrees bit for bit.
+        inline float cosine_finish(std::int64_t d, std::int64_t qq, std::int64_t rr) noexcept
+        {
+            return qq > 0 && rr > 0 ? static_cast<float>(double(d) / std::sqrt(double(qq) * double(rr))) : 0.0f;
+        }
+
+        template <metric M>
+        void score_many_portable(const float* q, const float* base, std::size_t rows, std::size_t dim, float* out) noexcept
+        {
+            const float qq = M == metric::cosine ? dot_portable(q, q, dim) : 0.0f;
+            for (std::size_t r = 0; r < rows; ++r)
+            {
+                const float* row = base + r * dim;
+                if constexpr (M == metric::dot)
+                    out[r] = dot_portable(q, row, dim);
+                else if constexpr (M == metric::l2sq)
+                    out[r] = transform_reduce(q, dim, row, 0.0f, [](auto a, auto b) { return a + b; },
+                                              [](auto a, auto b) { const auto d = b - a; return d * d; });
+                else
+                    out[r] = cosine_finish(dot_portable(q, row, dim), qq, dot_portable(row, row, dim));
+            }
+        }
+
+        template <metric M>
+        void score_many_portable(const std::int8_t* q, const std::int8_t* base, std::size_t rows, std::size_t dim,
+                                 score_t<M, std::int8_t>* out) noexcept
+        {
+            std::int64_t qq = 0;
+            if constexpr (M == metric::cosine)
+                for (std::size_t i = 0; i < dim; ++i) qq += q[i] * q[i];
+            for (std::size_t r = 0; r < rows; ++r)
+            {
+                const std::int8_t* row = base + r * dim;
+                std::int64_t acc = 0, rr = 0;
+                for (std::size_t i = 0; i < dim; ++i)
+                {
+                    if constexpr (M == metric::l2sq)
+                    {
+                        const std::int32_t d = row[i] - q[i];
+                        acc += d * d;
+                    }
+                    else
+                    {
+                        acc += q[i] * row[i];
+                        if constexpr (M == metric::cosine) rr += row[i] * row[i];
+                    }
+                }
+                if constexpr (M == metric::cosine) out[r] = cosine_finish(acc, qq, rr);
+                else out[r] = acc;
+            }
+        }
+
+        // Heap over the caller's (score, index) arrays, worst kept entry at the root.
+        template <metric M, class S>
+        bool nearest_better(S sa, std::size_t ia, S sb, std::size_t ib) noexcept
+        {
+            if (sa != sb) return M == metric::l2sq ? sa < sb : sa > sb;
+            return ia < ib;
+        }
+
+        template <metric M, class S>
+        void nearest_sift_down(S* scores, std::size_t* idx, std::size_t size, std::size_t at) noexcept
+        {
+            for (;;)
+            {
+                std::size_t worst = at;
+                const std::size_t l = 2 * at + 1, r = l + 1;
+                if (l < size && nearest_better<M>(scores[worst], idx[worst], scores[l], idx[l])) worst = l;
+                if (r < size && nearest_better<M>(scores[worst], idx[worst], scores[r], idx[r])) worst = r;
+                if (worst == at) return;
+                const S s = scores[at]; scores[at] = scores[worst]; scores[worst] = s;
+                const std::size_t i = idx[at]; idx[at] = idx[worst]; idx[worst] = i;
+                at = worst;
+            }
+        }
+    } // namespace detail
+
+    template <metric M>
+    void score_many(const float* q, const float* base, std::size_t rows, std::size_t dim, float* out) noexcept
+    {
+        if constexpr (M == metric::dot)
+        {
+            if (auto fn = platform::dot_many_f32_slot()) return fn(q, base, rows, dim, out);
+        }
+        else if constexpr (M == metric::l2sq)
+        {
+            if (auto fn = platform::l2sq_many_f32_slot()) return fn(q, base, rows, dim, out);
+        }
+        else
+        {
+            if (auto fn = platform::cosine_many_f32_slot()) return fn(q, base, rows, dim, out);
+        }
+        detail::score_many_portable<M>(q, base, rows, dim, out);
+    }
+
+    template <metric M>
+    void score_many(const std::int8_t* q, const std::int8_t* base, std::size_t rows, std::size_t dim,
+                    score_t<M, std::int8_t>* out) noexcept
+    {
+        if constexpr (M == metric::dot)
+        {
+            if (auto fn = platform::dot_many_i8_slot()) return fn(q, base, rows, dim, out);
+        }
+        else if constexpr (M == metric::l2sq)
+        {
+            if (auto fn = platform::l2sq_many_i8_slot()) return fn(q, base, rows, dim, out);
+        }
+        else
+        {
+            if (auto fn = platform::cosine_many_i8_slot()) return fn(q, base, rows, dim, out);
+        }
+        detail::score_many_portable<M>(q, base, rows, dim, out);
+    }
+
+    inline void dot_many(const float* q, const float* base, std::size_t rows, std::size_t dim, float* out) noexcept
+    { score_many<metric::dot>(q, base, rows, dim, out); }
+    inline void l2sq_many(const float* q, const float* base, std::size_t rows, std::size_t dim, float* out) noexcept
+    { score_many<metric::l2sq>(q, base, rows, dim, out); }
+    inline void cosine_many(const float* q, const float* base, std::size_t rows, std::size_t dim, float* out) noexcept
+    { score_many<metric::cosine>(q, base, rows, dim, out); }
+
+    inline void dot_many(const std::int8_t* q, const std::int8_t* base, std::size_t rows, std::size_t dim, std::int64_t* out) noexcept
+    { score_many<metric::dot>(q, base, rows, dim, out); }
+    inline void l2sq_many(const std::int8_t* q, const std::int8_t* base, std::size_t rows, std::size_t dim, std::int64_t* out) noexcept
+    { score_many<metric::l2sq>(q, base, rows, dim, out); }
+    inline void cosine_many(const std::int8_t* q, const std::int8_t* base, std::size_t rows, std::size_t dim, float* out) noexcept
+    { score_many<metric::cosine>(q, base, rows, dim, out); }
+
+    // idx and scores must hold k entries each.
+    template <metric M, class T>
+    std::size_t nearest_k(const T* q, const T* base, std::size_t rows, std::size_t dim, std::size_t k,
+                          std::size_t* idx, score_t<M, T>* scores) noexcept
+    {
+        using S = score_t<M, T>;
+        if (k > rows) k = rows;
+        if (k == 0) return 0;
+        S block[detail::nearest_block];
+        std::size_t size = 0;
+        for (std::size_t r0 = 0; r0 < rows; r0 += detail::nearest_block)
+        {
+            const std::size_t m = rows - r0 < detail::nearest_block ? rows - r0 : detail::nearest_block;
+            score_many<M>(q, base + r0 * dim, m, dim, block);
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                if (size < k)
+                {
+                    // Still filling: append, and heapify once full.
+                    scores[size] = block[j];
+                    idx[size] = r0 + j;
+                    if (++size == k)
+                        for (std::size_t at = k / 2; at-- > 0;) detail::nearest_sift_down<M>(scores, idx, k, at);
+                }
+                else if (detail::nearest_better<M>(block[j], r0 + j, scores[0], idx[0]))
+                {
+                    scores[0] = block[j];
+                    idx[0] = r0 + j;
+                    detail::nearest_sift_down<M>(scores, idx, k, 0);
+                }
+            }
+        }
+        // Heap sort: repeatedly move the worst to the back, leaving best first.
+        for (std::size_t end = k; end > 1; --end)
+        {
+            const S s = scores[0]; scores[0] = scores[end - 1]; scores[end - 1] = s;
+            const std::size_t i = idx[0]; idx[0] = idx[end - 1]; idx[end - 1] = i;
+            detail::nearest_sift_down<M>(scores, idx, end - 1, 0);
+        }
+        return k;
+    }
+} // namespace simdtl
@@ -0,0 +1,148 @@
+#pragma once
+// ── L4: StreamVByte (byte-oriented varint coding of uint32) ───────────────────
+// streamvbyte_encode(first, n, out): returns the bytes written; `out` needs
+// room for streamvbyte_max_bytes(n), and bytes between the returned size and
+// that bound may be scribbled on (the kernel stores 16 at a time).
+// streamvbyte_decode(in, n, out) reads n values back and returns the bytes
+// consumed. The *_delta forms fuse delta_encode / delta_decode (delta.hpp) for
+// sorted ids and timestamps; zigzag_encode the deltas first when the sequence
+// is not monotone.
+//
+// Layout (Lemire's StreamVByte, default "1234" codec): ceil(n / 4) control
+// bytes, then the data bytes. Control byte k holds 2-bit codes for values
+// 4k .. 4k+3, value 4k+j in bits 2j..2j+1; code = bytes - 1, and the value's
+// low code+1 bytes follow little-endian. Unused codes of a final partial
+// control byte are 0. Keeping the lengths apart from the data is what lets a
+// decoder find four values' boundaries from one byte: one 256-entry table of
+// pshufb controls places the 4..16 data bytes of a quad straight into four
+// dword lanes (and the inverse table compacts them when encoding).
+//
+// Dispatch: whole quads at AVX2 (two quads per ymm, pshufb LUTs); the
+// portable code is a plain byte loop. The decode kernel loads 16 bytes per
+// quad, so the last three quads always take the byte loop: the input may end
+// exactly at the encoded size.
+#include "../platform/dispatch.hpp"
+#include "delta.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace simdtl
+{
+    constexpr std::size_t streamvbyte_max_bytes(std::size_t n) noexcept { return (n + 3) / 4 + 4 * n; }
+
+    namespace detail
+    {
+        inline constexpr std::size_t svb_delta_chunk = 1024;   // values per fused-delta step (a multiple of 4)
+
+        constexpr unsigned svb_code(std::uint32_t v) noexcept
+        {
+            return unsigned{v > 0xFFu} + unsigned{v > 0xFFFFu} + unsigned{v > 0xFFFFFFu};
+        }
+
+        // n values (a final partial quad included): control bytes at ctrl, data
+        // at data; returns the data cursor.
+        inline std::uint8_t* svb_encode_portable(const std::uint32_t* first, std::size_t n,
+                                                 std::uint8_t* ctrl, std::uint8_t* data) noexcept
+        {
+            for (std::size_t i = 0; i < n; i += 4)
+            {
+                unsigned key = 0;
+                for (std::size_t j = 0; j < 4 && i + j < n; ++j)
+                {
+                    const std::uint32_t v = first[i + j];
+                    const unsigned code = svb_code(v);
+                    key |= code << (2 * j);
+                    for (unsigned b = 0; b <= code; ++b) *data++ = static_cast<std::uint8_t>(v >> (8 * b));
+                }
+                ctrl[i / 4] = static_cast<std::uint8_t>(key);
+            }
+            return data;
+        }
+
+        inline const std::uint8_t* svb_decode_portable(const std::uint8_t* ctrl, const std::uint8_t* data,
+                                                       std::size_t n, std::uint32_t* out) noexcept
+        {
+            for (std::size_t i = 0; i < n; i += 4)
+            {
+                const unsigned key = ctrl[i / 4];
+                for (std::size_t j = 0; j < 4 && i + j < n; ++j)
+                {
+                    const unsigned code = (key >> (2 * j)) & 3u;
+                    std::uint32_t v = 0;
+                    for (unsigned b = 0; b <= code; ++b) v |= std::uint32_t{data[b]} << (8 * b);
+                    data += code + 1;
+                    out[i + j] = v;
+                }
+            }
+            return data;
+        }
+
+        inline std::uint8_t* svb_encode(const std::uint32_t* first, std::size_t n,
+                                        std::uint8_t* ctrl, std::uint8_t* data) noexcept
+        {
+            const std::size_t quads = n / 4;
+            if (auto fn = platform::svb_encode_slot(); fn && quads != 0)
+            {
+                data = fn(first, quads, ctrl, data);
+                return svb_encode_portable(first + quads * 4, n % 4, ctrl + quads, data);
+            }
+            return svb_encode_portable(first, n, ctrl, data);
+        }
+
+        inline const std::uint8_t* svb_decode(const std::uint8_t* ctrl, const std::uint8_t* data,
+                                              std::size_t n, std::uint32_t* out) noexcept
+        {
+            const std::size_t safe = n / 4 > 3 ? n / 4 - 3 : 0;   // quads with 12 data bytes behind them
+            if (auto fn = platform::svb_decode_slot(); fn && safe != 0)
+            {
+                data = fn(ctrl, data, safe, out);
+                return svb_decode_portable(ctrl + safe, data, n - safe * 4, out + safe * 4);
+            }
+            return svb_decode_portable(ctrl, data, n, out);
+        }
+    } // namespace detail
+
+    inline std::size_t streamvbyte_encode(const std::uint32_t* first, std::size_t n, std::uint8_t* out) noexcept
+    {
+        const std::size_t head = (n + 3) / 4;
+        return static_cast<std::size_t>(detail::svb_encode(first, n, out, out + head) - out);
+    }
+
+    inline std::size_t streamvbyte_decode(const std::uint8_t* in, std::size_t n, std::uint32_t* out) noexcept
+    {
+        const std::size_t head = (n + 3) / 4;
+        return static_cast<std::size_t>(detail::svb_decode(in, in + head, n, out) - in);
+    }
+
+    // Encodes first[i] - first[i-1] (first[-1] = init), a chunk at a time
+    // through a stack buffer.
+    inline std::size_t streamvbyte_encode_delta(const std::uint32_t* first, std::size_t n, std::uint8_t* out,
+                                                std::uint32_t init = 0) noexcept
+    {
+        std::uint32_t buf[detail::svb_delta_chunk];
+        std::uint8_t* ctrl = out;
+        std::uint8_t* data = out + (n + 3) / 4;
+        for (std::size_t i = 0; i < n; i += detail::svb_delta_chunk)
+        {
+            const std::size_t m = n - i < detail::svb_delta_chunk ? n - i : detail::svb_delta_chunk;
+            delta_encode(first + i, m, buf, i == 0 ? init : first[i - 1]);
+            data = detail::svb_encode(buf, m, ctrl + i / 4, data);
+        }
+        return static_cast<std::size_t>(data - out);
+    }
+
+    // Decodes a chunk, then prefix-sums it while it is still in cache.
+    inline std::size_t streamvbyte_decode_delta(const std::uint8_t* in, std::size_t n, std::uint32_t* out,
+                                                std::uint32_t init = 0) noexcept
+    {
+        const std::uint8_t* ctrl = in;
+        const std::uint8_t* data = in + (n + 3) / 4;
+        for (std::size_t i = 0; i < n; i += detail::svb_delta_chunk)
+        {
+            const std::size_t m = n - i < detail::svb_delta_chunk ? n - i : detail::svb_delta_chunk;
+            data = detail::svb_decode(ctrl + i / 4, data, m, out + i);
+            delta_decode(out + i, m, out + i, i == 0 ? init : out[i - 1]);
+        }
+        return static_cast<std::size_t>(data - in);
+    }
+} // namespace simdtl
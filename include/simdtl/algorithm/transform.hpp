@@ -4,11 +4,28 @@
 // lambda works for both, e.g. unary `[](auto x){ return x * x; }`, binary
 // `[](auto a, auto b){ return a + b; }`. (Trivial maps auto-vectorize anyway; the
 // value of transform is fused/masked elemental ops expressed once.)
+//
+// transform(const In*, n, Out*, op) with In != Out: op sees In lanes and its
+// result is lane_cast to Out (static_cast per lane). Both sides run at the
+// wider of the two native lane counts (vec<T, W>: native where T's width
+// matches, fixed_size otherwise), so a uint8 -> float map loads one 16-byte
+// vector and stores four float vectors. Convert inside op
+// where the arithmetic must happen in another type, e.g. uint8 -> float
+// normalisation `[](auto x){ return simdtl::lane_cast<float>(x) * (1.0f / 255); }`.
+// For saturating / rounding narrowing see convert.hpp.
 #include "../backend/names.hpp"
 #include <cstddef>
 
 namespace simdtl
 {
+    namespace detail
+    {
+        // Lanes per step when converting In -> Out: the wider native vector count.
+        template <class In, class Out>
+        inline constexpr std::size_t convert_width =
+            native<In>::size() > native<Out>::size() ? native<In>::size() : native<Out>::size();
+    } // namespace detail
+
     template <class T, class Op>
     void transform(const T* first, std::size_t n, T* out, Op op) noexcept
     {
@@ -38,4 +55,19 @@ namespace simdtl
         for (; i < n; ++i)
             out[i] = op(a[i], b[i]);
     }
+
+    template <class In, class Out, class Op>
+    void transform(const In* first, std::size_t n, Out* out, Op op) noexcept
+    {
+        constexpr std::size_t W = detail::convert_width<In, Out>;
+        using VIn = vec<In, W>;
+        const std::size_t body = n - n % W;
+        for (std::size_t i = 0; i < body; i += W)
+        {
+            const auto r = lane_cast<Out>(op(VIn(first + i, elem_aligned)));
+            r.copy_to(out + i, elem_aligned);
+        }
+        for (std::size_t i = body; i < n; ++i)
+            out[i] = lane_cast<Out>(op(first[i]));
+    }
 } // namespace simdtl
@@ -0,0 +1,117 @@
+#pragma once
+// ── L4: transform_reduce / dot ────────────────────────────────────────────────
+// transform_reduce(first, n, init, reduce_op, transform_op): fold of
+//   transform_op(x) over one range; transform_reduce(a, n, b, init, reduce_op,
+//   transform_op): fold of transform_op(a[i], b[i]) over two. Both ops are
+//   ELEMENTAL (as for transform / reduce-with-op) and the map is fused into the
+//   fold, so nothing is materialised. reduce_op must be associative and
+//   commutative; lanes start from the first transformed vector (no identity).
+// transform_reduce(a, n, b, init) = init + dot(a, b, n), like std's default
+//   (plus, multiplies).
+// dot(a, b, n): float / double route through dispatched FMA kernels (AVX2+FMA3,
+//   AVX-512) with four independent accumulators, so the loop is bound by loads
+//   rather than by the 4-cycle FMA latency; other types and the portable path
+//   multiply-add into four native accumulators (no FMA at the baseline ISA —
+//   emulated FMA would be slower than mul + add). Floating-point results
+//   reassociate (and FMA skips one rounding), so they may differ from a
+//   sequential loop in the last bits.
+#include "../backend/names.hpp"
+#include "../platform/dispatch.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace simdtl
+{
+    template <class T, class R, class Op>
+    T transform_reduce(const T* first, std::size_t n, T init, R reduce_op, Op transform_op) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        const std::size_t body = n - n % W;
+        T result = init;
+        if (body > 0)
+        {
+            V acc = transform_op(V(first, elem_aligned));
+            for (std::size_t i = W; i < body; i += W)
+                acc = reduce_op(acc, transform_op(V(first + i, elem_aligned)));
+            for (std::size_t j = 0; j < W; ++j)
+                result = reduce_op(result, T(acc[j]));
+        }
+        for (std::size_t i = body; i < n; ++i)
+            result = reduce_op(result, transform_op(first[i]));
+        return result;
+    }
+
+    template <class T, class R, class Op>
+    T transform_reduce(const T* a, std::size_t n, const T* b, T init, R reduce_op, Op transform_op) noexcept
+    {
+        using V = native<T>;
+        constexpr std::size_t W = V::size();
+        const std::size_t body = n - n % W;
+        T result = init;
+        if (body > 0)
+        {
+            V acc = transform_op(V(a, elem_aligned), V(b, elem_aligned));
+            for (std::size_t i = W; i < body; i += W)
+                acc = reduce_op(acc, transform_op(V(a + i, elem_aligned), V(b + i, elem_aligned)));
+            for (std::size_t j = 0; j < W; ++j)
+                result = reduce_op(result, T(acc[j]));
+        }
+        for (std::size_t i = body; i < n; ++i)
+            result = reduce_op(result, transform_op(a[i], b[i]));
+        return result;
+    }
+
+    namespace detail
+    {
+        template <class T>
+        T dot_portable(const T* a, const T* b, std::size_t n) noexcept
+        {
+            using V = native<T>;
+            constexpr std::size_t W = V::size();
+            const std::size_t body = n - n % (4 * W);
+            T result{};
+            if (body > 0)
+            {
+                V s0(T{0}), s1(T{0}), s2(T{0}), s3(T{0});
+                for (std::size_t i = 0; i < body; i += 4 * W)
+                {
+                    s0 += V(a + i, elem_aligned) * V(b + i, elem_aligned);
+                    s1 += V(a + i + W, elem_aligned) * V(b + i + W, elem_aligned);
+                    s2 += V(a + i + 2 * W, elem_aligned) * V(b + i + 2 * W, elem_aligned);
+                    s3 += V(a + i + 3 * W, elem_aligned) * V(b + i + 3 * W, elem_aligned);
+                }
+                result = hsum((s0 + s1) + (s2 + s3));
+            }
+            for (std::size_t i = body; i < n; ++i) result += a[i] * b[i];
+            return result;
+        }
+    } // namespace detail
+
+    template <class T>
+    T dot(const T* a, const T* b, std::size_t n) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if (auto fn = platform::dot_f32_slot()) return fn(a, b, n);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if (auto fn = platform::dot_f64_slot()) return fn(a, b, n);
+        }
+        return detail::dot_portable(a, b, n);
+    }
+
+    template <class T>
+    T transform_reduce(const T* a, std::size_t n, const T* b, T init) noexcept
+    {
+        return init + dot(a, b, n);
+    }
+
+    // b must hold at least a.size() elements.
+    template <class C>
+    typename C::value_type dot(const C& a, const C& b)
+    {
+        return dot(a.data(), b.data(), a.size());
+    }
+} // namespace simdtl
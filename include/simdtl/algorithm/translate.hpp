@@ -0,0 +1,62 @@
+#pragma once
+// ── L4: byte translation (tr) and small-dictionary decode ─────────────────────
+//   translate_bytes(first, n, table, out)        out[i] = table[first[i]], 256 entries
+//   dict_decode(codes, n, dict, dict_size, out)  out[i] = dict[codes[i]], byte codes
+// For 1-byte elements (char, int8_t, uint8_t, std::byte...); `out` may alias
+// `first`. dict_decode needs every code < dict_size <= 256 and takes any
+// trivially copyable value type; 1-byte values become a translate_bytes table.
+// Dispatch: translate_bytes at AVX2 (the table as sixteen 16-byte pshufb chunks,
+// XOR-cascaded so eight lookups cover each 128-byte half) and AVX-512 (the same
+// on zmm; two vpermi2b and a blend with AVX512_VBMI). dict_decode for 4- and
+// 8-byte values: dictionaries stay in registers (vpermd / vpermq / vpermi2*)
+// up to 16 (4-byte) / 8 (8-byte) entries at AVX2 and 32 / 16 at AVX-512;
+// larger ones use vpgather where gathers are fast. Other
+// value sizes and the scalar tier are the plain lookup loop (std::simd has no
+// byte-table shuffle).
+#include "../platform/dispatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace simdtl
+{
+    template <class T>
+    void translate_bytes(const T* first, std::size_t n, const T* table, T* out) noexcept
+    {
+        static_assert(sizeof(T) == 1 && std::is_trivially_copyable_v<T>, "translate_bytes: T must be a 1-byte type");
+        const auto* in = reinterpret_cast<const std::uint8_t*>(first);
+        const auto* tab = reinterpret_cast<const std::uint8_t*>(table);
+        auto* dst = reinterpret_cast<std::uint8_t*>(out);
+        if (auto fn = platform::translate_u8_slot()) return fn(in, n, tab, dst);
+        for (std::size_t i = 0; i < n; ++i) dst[i] = tab[in[i]];
+    }
+
+    template <class V>
+    void dict_decode(const std::uint8_t* codes, std::size_t n, const V* dict, std::size_t dict_size, V* out) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<V>, "dict_decode: V must be trivially copyable");
+        if constexpr (sizeof(V) == 1)
+        {
+            if (auto fn = platform::translate_u8_slot())
+            {
+                std::uint8_t table[256] = {};
+                std::memcpy(table, dict, dict_size);
+                return fn(codes, n, table, reinterpret_cast<std::uint8_t*>(out));
+            }
+        }
+        else if constexpr (sizeof(V) == 4)
+        {
+            if (auto fn = platform::dict_decode_u32_slot())
+                return fn(codes, n, reinterpret_cast<const std::uint32_t*>(dict), dict_size,
+                          reinterpret_cast<std::uint32_t*>(out));
+        }
+        else if constexpr (sizeof(V) == 8)
+        {
+            if (auto fn = platform::dict_decode_u64_slot())
+                return fn(codes, n, reinterpret_cast<const std::uint64_t*>(dict), dict_size,
+                          reinterpret_cast<std::uint64_t*>(out));
+        }
+        for (std::size_t i = 0; i < n; ++i) out[i] = dict[codes[i]];
+    }
+} // namespace simdtl
@@ -8,16 +8,27 @@
 //   stable name        TS / vir (today)     C++26 <simd> (tomorrow)
 //   ----------------   ------------------   -----------------------
 //   lane_count(mask)   popcount             reduce_count
+//   mask_bits(mask)    vir::to_bitset       to_bitset
 //   find_first(mask)   find_first_set       reduce_min_index
 //   find_last(mask)    find_last_set        reduce_max_index
 //   hmin(v)            hmin                 reduce_min
 //   hmax(v)            hmax                 reduce_max
 //   hsum(v)            reduce               reduce
 //   any_of/all_of/none_of                   (unchanged)
+//   lane_cast<U>(v)    static_simd_cast     explicit basic_simd<U> ctor
+//   mask_cast<M>(m)    vir::to_simd_mask    explicit basic_mask ctor
 //   elem_aligned       element_aligned      simd_flag_default
 //   vec_aligned        vector_aligned       simd_flag_aligned
 #include "simd.hpp"
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_FORCE_INLINE [[gnu::always_inline]] inline
+#else
+#  define SIMDTL_FORCE_INLINE inline
+#endif
 
 namespace simdtl
 {
@@ -27,6 +38,10 @@ namespace simdtl
     template <class T> using native_mask = typename stdx::native_simd<T>::mask_type;
     template <class T, std::size_t N>
     using fixed = stdx::simd<T, stdx::simd_abi::fixed_size<N>>;
+    // N lanes of T in the best ABI for that width: native<T> when N matches it
+    // (fast masks), fixed_size otherwise. C++26 spells it std::simd<T, N>.
+    template <class T, std::size_t N>
+    using vec = stdx::simd<T, stdx::simd_abi::deduce_t<T, N>>;
 
     // Alignment flags used at every load/store site. Default to element_aligned
     // (always safe for arbitrary container memory); vec_aligned is the fast,
@@ -40,6 +55,13 @@ namespace simdtl
     template <class Mask> bool all_of    (const Mask& m) noexcept { return stdx::all_of(m); }
     template <class Mask> bool none_of   (const Mask& m) noexcept { return stdx::none_of(m); }
 
+    // Lane j -> bit j of an integer (LSB-first), for masks of up to 64 lanes:
+    // how a selection leaves the register as a bitmap.
+    template <class Mask> std::uint64_t mask_bits(const Mask& m) noexcept
+    {
+        return static_cast<std::uint64_t>(backend::mask_to_bitset(m).to_ullong());
+    }
+
     // UB if no lane is set — callers MUST gate with any_of() first.
     template <class Mask> int find_first(const Mask& m) noexcept { return stdx::find_first_set(m); }
     template <class Mask> int find_last (const Mask& m) noexcept { return stdx::find_last_set(m); }
@@ -50,9 +72,36 @@ namespace simdtl
     template <class V> auto hmin(const V& v) noexcept { return stdx::hmin(v); }
     template <class V> auto hmax(const V& v) noexcept { return stdx::hmax(v); }
 
-    // Element-wise (lane-wise) min/max of two vectors.
-    template <class V> V elem_min(const V& a, const V& b) noexcept { return stdx::min(a, b); }
-    template <class V> V elem_max(const V& a, const V& b) noexcept { return stdx::max(a, b); }
+    // Element-wise (lane-wise) min/max of two vectors. The scalar overloads make
+    // them elemental, e.g. `reduce(p, n, init, [](auto a, auto b){ return elem_min(a, b); })`.
+    // GCC keeps the vector forms out of line inside loops (a call per step in
+    // minmax_value), so they are forced inline.
+    template <class V> requires (!std::is_arithmetic_v<V>)
+    SIMDTL_FORCE_INLINE V elem_min(const V& a, const V& b) noexcept { return stdx::min(a, b); }
+    template <class V> requires (!std::is_arithmetic_v<V>)
+    SIMDTL_FORCE_INLINE V elem_max(const V& a, const V& b) noexcept { return stdx::max(a, b); }
+    template <class T> requires std::is_arithmetic_v<T> T elem_min(T a, T b) noexcept { return b < a ? b : a; }
+    template <class T> requires std::is_arithmetic_v<T> T elem_max(T a, T b) noexcept { return a < b ? b : a; }
+
+    // Lane-wise value conversion to element type U (static_cast semantics per
+    // lane), keeping the lane count (and the native ABI when U has one at that
+    // width); scalars just static_cast, so it is elemental.
+    template <class U, class V> requires (!std::is_arithmetic_v<V>)
+    auto lane_cast(const V& v) noexcept { return stdx::static_simd_cast<stdx::rebind_simd_t<U, V>>(v); }
+    template <class U, class T> requires std::is_arithmetic_v<T>
+    U lane_cast(T x) noexcept { return static_cast<U>(x); }
+
+    // The same lanes as a mask of another element type / ABI (equal lane count),
+    // e.g. to combine an int8 column's mask with a double column's; bool -> bool
+    // for scalars. libstdc++ goes through the lanes' bits (a movemask one way).
+    template <class M, class Mask> requires (!std::is_same_v<Mask, bool>)
+    M mask_cast(const Mask& m) noexcept
+    {
+        if constexpr (std::is_same_v<M, Mask>) return m;
+        else return backend::mask_from_bitset<M>(backend::mask_to_bitset(m));
+    }
+    template <class M> requires std::is_same_v<M, bool>
+    bool mask_cast(bool m) noexcept { return m; }
 
     // Masked/selected assignment: `where(mask, v) = value;` writes only true lanes.
     template <class Mask, class V>
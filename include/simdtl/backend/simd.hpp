@@ -16,9 +16,21 @@
 #if defined(__cpp_lib_simd) && !defined(SIMDTL_FORCE_VIR_SIMD)
 #  include <simd>
 namespace simdtl { namespace stdx = std; }            // C++26: std::simd lives in std
+namespace simdtl::backend
+{
+    template <class M> auto mask_to_bitset(const M& m) noexcept { return m.to_bitset(); }
+    template <class M, class B> M mask_from_bitset(const B& bits) noexcept { return M(bits); }
+}
 #  define SIMDTL_SIMD_BACKEND "std (C++26)"
 #else
 #  include <vir/simd.h>
+#  include <vir/simd_bitset.h>
 namespace simdtl { namespace stdx = vir::stdx; }
+namespace simdtl::backend
+{
+    // libstdc++: vpmovmskb / movmskps / kmov — never a per-lane loop.
+    template <class M> auto mask_to_bitset(const M& m) noexcept { return vir::to_bitset(m); }
+    template <class M, class B> M mask_from_bitset(const B& bits) noexcept { return vir::to_simd_mask<M>(bits); }
+}
 #  define SIMDTL_SIMD_BACKEND "vir-simd"
 #endif
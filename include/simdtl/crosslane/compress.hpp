@@ -1,5 +1,5 @@
 #pragma once
-// ── L3: stream compaction primitive (the marquee gap in std::simd) ────────────
+// ── L3: stream compaction / expansion primitives (the marquee gap in std::simd) ─
 // std::simd offers only position-preserving blend (where()); it cannot pack the
 // selected lanes into a contiguous prefix. compress_store does exactly that.
 //
@@ -9,6 +9,7 @@
 // like remove(value), through the runtime dispatch slot.
 #include "../backend/names.hpp"
 #include <cstddef>
+#include <type_traits>
 
 namespace simdtl
 {
@@ -22,4 +23,28 @@ namespace simdtl
                 dst[k++] = v[j];
         return k;
     }
+
+    // expand_load: the inverse of compress_store. Lane j of the result is the next
+    // unread element of `src` if keep[j], else passthru[j]; reads exactly
+    // lane_count(keep) elements (so `src` needs no slack). The fast AVX2/AVX-512
+    // paths for whole columns live behind simdtl::expand's dispatch slots.
+    template <class T>
+    native<T> expand_load(const T* src, native_mask<T> keep, native<T> passthru = native<T>(T{})) noexcept
+    {
+        constexpr std::size_t W = native<T>::size();
+        std::size_t k = 0;
+        for (std::size_t j = 0; j < W; ++j)
+            if (keep[j])
+                passthru[j] = src[k++];
+        return passthru;
+    }
+
+    namespace detail
+    {
+        // Pure data-movement kernels only care about the element WIDTH, so any
+        // arithmetic T of the kernel's width may route through it (bool excluded).
+        template <class T, class K>
+        inline constexpr bool same_width_v =
+            std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) == sizeof(K);
+    } // namespace detail
 } // namespace simdtl
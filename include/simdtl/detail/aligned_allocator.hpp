@@ -0,0 +1,34 @@
+#pragma once
+// ── L2: over-aligned std::allocator replacement ───────────────────────────────
+// Layout-sensitive containers (cache-line tree nodes, hash control groups) must
+// start on a line boundary or every node straddles two lines. C++17 aligned
+// operator new does the work; this just plugs it into std::vector.
+#include <cstddef>
+#include <new>
+
+namespace simdtl::detail
+{
+    template <class T, std::size_t Align = 64>
+    struct aligned_allocator
+    {
+        using value_type = T;
+
+        template <class U> struct rebind { using other = aligned_allocator<U, Align>; };
+
+        aligned_allocator() noexcept = default;
+        template <class U>
+        aligned_allocator(const aligned_allocator<U, Align>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+        }
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            ::operator delete(p, std::align_val_t{Align});
+        }
+
+        template <class U>
+        bool operator==(const aligned_allocator<U, Align>&) const noexcept { return true; }
+    };
+} // namespace simdtl::detail
@@ -0,0 +1,38 @@
+#pragma once
+// ── L2: fork-join over a fixed number of parts ────────────────────────────────
+// Part 0 runs on the calling thread, parts 1..parts-1 on fresh std::threads,
+// all joined before returning. Deliberately minimal (no pool): callers only
+// fork for inputs large enough that thread start-up is noise. If a thread
+// cannot be started, its part (and every later one) runs on the caller instead,
+// so the result never depends on how many threads were actually obtained.
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace simdtl::detail
+{
+    // Threads to use when the caller passes 0: one per hardware thread.
+    inline unsigned default_thread_count() noexcept
+    {
+        const unsigned hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 1u : hw;
+    }
+
+    template <class F>
+    void fork_join(std::size_t parts, F f) noexcept
+    {
+        std::vector<std::thread> workers;
+        std::size_t p = 1;
+        try
+        {
+            workers.reserve(parts > 0 ? parts - 1 : 0);
+            for (; p < parts; ++p) workers.emplace_back(f, p);
+        }
+        catch (...)
+        {
+        }
+        for (std::size_t q = p; q < parts; ++q) f(q);
+        if (parts > 0) f(std::size_t{0});
+        for (auto& t : workers) t.join();
+    }
+} // namespace simdtl::detail
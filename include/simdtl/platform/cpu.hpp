@@ -6,6 +6,8 @@
 // confirms the OS actually saves the YMM/ZMM register state.
 #include "arch_macros.hpp"
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 
 #if SIMDTL_ARCH_X86
 #  if SIMDTL_COMPILER_MSVC
@@ -35,9 +37,19 @@ namespace simdtl::platform
         bool sse42     = false;
         bool popcnt    = false;
         bool avx       = false;
+        bool fma       = false;   // vfmadd* (FMA3: Haswell+, Piledriver+)
+        bool f16c      = false;   // vcvtph2ps / vcvtps2ph (Ivy Bridge+, Piledriver+)
         bool avx2      = false;
         bool avx512f   = false;
         bool avx512bw  = false;
+        bool avx512cd  = false;
+        bool avx512dq  = false;
+        bool avx512vl  = false;
+        bool avx512vbmi  = false; // vpermb / vpermi2b byte permutes (Cannon Lake, Ice Lake+, Zen4+)
+        bool avx512vbmi2 = false; // vpcompressb/w, vpexpandb/w (Ice Lake+, Zen4+)
+        bool avx512bf16  = false; // vcvtneps2bf16 (Cooper Lake, Sapphire Rapids+, Zen4+)
+        bool avx512vpopcntdq = false; // vpopcnt{d,q} (Ice Lake+, Zen4+)
+        bool slow_gather = false; // vpgather* loses to scalar loads (Haswell, Zen1/Zen2)
         bool os_avx    = false;   // OS saves XMM+YMM (XCR0 bits 1,2)
         bool os_avx512 = false;   // OS saves opmask+ZMM hi+ZMM (XCR0 bits 5,6,7)
     };
@@ -82,17 +94,29 @@ namespace simdtl::platform
         std::uint32_t r[4] = {0, 0, 0, 0};
         detail::cpuid(0, 0, r);
         const std::uint32_t max_leaf = r[0];
+        const bool intel = r[1] == 0x756E6547u && r[3] == 0x49656E69u && r[2] == 0x6C65746Eu;   // "GenuineIntel"
+        const bool amd   = r[1] == 0x68747541u && r[3] == 0x69746E65u && r[2] == 0x444D4163u;   // "AuthenticAMD"
 
         bool osxsave = false;
         if (max_leaf >= 1)
         {
             detail::cpuid(1, 0, r);
+            const std::uint32_t eax = r[0];
             const std::uint32_t ecx = r[2];
             const std::uint32_t edx = r[3];
+            // Gathers are microcoded (one load per lane and then some) on Haswell
+            // and on Zen1/Zen2 (family 17h); from Broadwell / Zen3 they beat scalar.
+            std::uint32_t family = (eax >> 8) & 0xFu, model = (eax >> 4) & 0xFu;
+            if (family == 0xFu) family += (eax >> 20) & 0xFFu;
+            if (family == 0x6u || family >= 0xFu) model |= ((eax >> 16) & 0xFu) << 4;
+            f.slow_gather = (amd && family < 0x19u) ||
+                            (intel && family == 0x6u && (model == 0x3Cu || model == 0x3Fu || model == 0x45u || model == 0x46u));
             f.sse2   = (edx >> 26) & 1u;
             f.popcnt = (ecx >> 23) & 1u;
             f.sse42  = (ecx >> 20) & 1u;
             f.avx    = (ecx >> 28) & 1u;
+            f.fma    = (ecx >> 12) & 1u;
+            f.f16c   = (ecx >> 29) & 1u;
             osxsave  = (ecx >> 27) & 1u;
         }
 
@@ -106,15 +130,28 @@ namespace simdtl::platform
         if (max_leaf >= 7)
         {
             detail::cpuid(7, 0, r);
+            const std::uint32_t max_subleaf = r[0];
             const std::uint32_t ebx = r[1];
+            const std::uint32_t ecx = r[2];
             f.avx2     = (ebx >> 5) & 1u;
             f.avx512f  = (ebx >> 16) & 1u;
+            f.avx512dq = (ebx >> 17) & 1u;
+            f.avx512cd = (ebx >> 28) & 1u;
             f.avx512bw = (ebx >> 30) & 1u;
+            f.avx512vl = (ebx >> 31) & 1u;
+            f.avx512vbmi  = (ecx >> 1) & 1u;
+            f.avx512vbmi2 = (ecx >> 6) & 1u;
+            f.avx512vpopcntdq = (ecx >> 14) & 1u;
+            if (max_subleaf >= 1)
+            {
+                detail::cpuid(7, 1, r);
+                f.avx512bf16 = (r[0] >> 5) & 1u;
+            }
         }
 
         // An instruction set is only USABLE if the OS preserves its registers.
-        if (!f.os_avx)    { f.avx = f.avx2 = false; }
-        if (!f.os_avx512) { f.avx512f = f.avx512bw = false; }
+        if (!f.os_avx)    { f.avx = f.avx2 = f.fma = f.f16c = false; }
+        if (!f.os_avx512) { f.avx512f = f.avx512bw = f.avx512cd = f.avx512dq = f.avx512vl = f.avx512vbmi = f.avx512vbmi2 = f.avx512bf16 = f.avx512vpopcntdq = false; }
 #endif // SIMDTL_ARCH_X86
         return f;
     }
@@ -122,17 +159,45 @@ namespace simdtl::platform
     inline isa_level detect_isa_level() noexcept
     {
         const cpu_features f = detect_cpu_features();
-        if (f.avx512f && f.avx512bw) return isa_level::avx512;
+        // The avx512 tier is the Skylake-SP set (F+CD+BW+DQ+VL) that MSVC's
+        // /arch:AVX512 targets; later extensions (VBMI2, ...) are probed per kernel.
+        if (f.avx512f && f.avx512cd && f.avx512bw && f.avx512dq && f.avx512vl) return isa_level::avx512;
         if (f.avx2)                  return isa_level::avx2;
         if (f.sse42)                 return isa_level::sse42;
         if (f.sse2)                  return isa_level::sse2;
         return isa_level::scalar;
     }
 
+    // SIMDTL_MAX_ISA=scalar|sse2|sse42|avx2|avx512 LOWERS (never raises) the
+    // detected tier, so the narrower kernels can be exercised — and bisected — on
+    // a wide machine. Unset or unrecognised: no cap.
+    inline isa_level isa_cap_from_env() noexcept
+    {
+#if SIMDTL_COMPILER_MSVC
+        char* v = nullptr;
+        std::size_t len = 0;
+        if (_dupenv_s(&v, &len, "SIMDTL_MAX_ISA") != 0 || v == nullptr) return isa_level::avx512;
+        char name[16] = {};
+        strncpy_s(name, v, _TRUNCATE);
+        std::free(v);
+#else
+        const char* name = std::getenv("SIMDTL_MAX_ISA");
+        if (name == nullptr) return isa_level::avx512;
+#endif
+        if (std::strcmp(name, "scalar") == 0) return isa_level::scalar;
+        if (std::strcmp(name, "sse2") == 0)   return isa_level::sse2;
+        if (std::strcmp(name, "sse42") == 0)  return isa_level::sse42;
+        if (std::strcmp(name, "avx2") == 0)   return isa_level::avx2;
+        return isa_level::avx512;
+    }
+
     // Detected once, cached. Dispatch tables (M1) resolve against this.
     inline isa_level best_isa() noexcept
     {
-        static const isa_level level = detect_isa_level();
+        static const isa_level level = [] {
+            const isa_level hw = detect_isa_level(), cap = isa_cap_from_env();
+            return hw < cap ? hw : cap;
+        }();
         return level;
     }
 
@@ -91,4 +91,427 @@ namespace simdtl::platform
     { if (best_isa() >= lvl && (remove_i8_slot() == nullptr || lvl > remove_i8_lvl())) { remove_i8_slot() = fn; remove_i8_lvl() = lvl; } }
     inline void register_remove_i16(isa_level lvl, remove_i16_fn fn) noexcept
     { if (best_isa() >= lvl && (remove_i16_slot() == nullptr || lvl > remove_i16_lvl())) { remove_i16_slot() = fn; remove_i16_lvl() = lvl; } }
+
+    // --- lower_bound for a batch of keys over one sorted array (AVX2 gathers) ---
+    using lower_bound_many_i32_fn = void (*)(const std::int32_t*, std::size_t, const std::int32_t*, std::size_t,
+                                             std::size_t*) noexcept;
+    inline lower_bound_many_i32_fn& lower_bound_many_i32_slot() noexcept { static lower_bound_many_i32_fn fn = nullptr; return fn; }
+    inline isa_level& lower_bound_many_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_lower_bound_many_i32(isa_level lvl, lower_bound_many_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (lower_bound_many_i32_slot() == nullptr || lvl > lower_bound_many_i32_lvl())) { lower_bound_many_i32_slot() = fn; lower_bound_many_i32_lvl() = lvl; } }
+
+    // --- unique (drop consecutive duplicates in place) for 1/2/4/8-byte ints ---
+    using unique_i8_fn  = std::size_t (*)(std::int8_t*,  std::size_t) noexcept;
+    using unique_i16_fn = std::size_t (*)(std::int16_t*, std::size_t) noexcept;
+    using unique_i32_fn = std::size_t (*)(std::int32_t*, std::size_t) noexcept;
+    using unique_i64_fn = std::size_t (*)(std::int64_t*, std::size_t) noexcept;
+    inline unique_i8_fn&  unique_i8_slot()  noexcept { static unique_i8_fn  fn = nullptr; return fn; }
+    inline unique_i16_fn& unique_i16_slot() noexcept { static unique_i16_fn fn = nullptr; return fn; }
+    inline unique_i32_fn& unique_i32_slot() noexcept { static unique_i32_fn fn = nullptr; return fn; }
+    inline unique_i64_fn& unique_i64_slot() noexcept { static unique_i64_fn fn = nullptr; return fn; }
+    inline isa_level& unique_i8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& unique_i16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& unique_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& unique_i64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_unique_i8(isa_level lvl, unique_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (unique_i8_slot() == nullptr || lvl > unique_i8_lvl())) { unique_i8_slot() = fn; unique_i8_lvl() = lvl; } }
+    inline void register_unique_i16(isa_level lvl, unique_i16_fn fn) noexcept
+    { if (best_isa() >= lvl && (unique_i16_slot() == nullptr || lvl > unique_i16_lvl())) { unique_i16_slot() = fn; unique_i16_lvl() = lvl; } }
+    inline void register_unique_i32(isa_level lvl, unique_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (unique_i32_slot() == nullptr || lvl > unique_i32_lvl())) { unique_i32_slot() = fn; unique_i32_lvl() = lvl; } }
+    inline void register_unique_i64(isa_level lvl, unique_i64_fn fn) noexcept
+    { if (best_isa() >= lvl && (unique_i64_slot() == nullptr || lvl > unique_i64_lvl())) { unique_i64_slot() = fn; unique_i64_lvl() = lvl; } }
+
+    // --- expand (scatter a dense prefix into bitmap-selected rows; passthrough elsewhere) ---
+    // Returns the number of dense elements consumed. Bitmap: 1 bit per row, LSB-first words.
+    using expand_i8_fn  = std::size_t (*)(const std::int8_t*,  std::size_t, const std::uint64_t*, const std::int8_t*,  std::int8_t*)  noexcept;
+    using expand_i16_fn = std::size_t (*)(const std::int16_t*, std::size_t, const std::uint64_t*, const std::int16_t*, std::int16_t*) noexcept;
+    using expand_i32_fn = std::size_t (*)(const std::int32_t*, std::size_t, const std::uint64_t*, const std::int32_t*, std::int32_t*) noexcept;
+    using expand_i64_fn = std::size_t (*)(const std::int64_t*, std::size_t, const std::uint64_t*, const std::int64_t*, std::int64_t*) noexcept;
+    inline expand_i8_fn&  expand_i8_slot()  noexcept { static expand_i8_fn  fn = nullptr; return fn; }
+    inline expand_i16_fn& expand_i16_slot() noexcept { static expand_i16_fn fn = nullptr; return fn; }
+    inline expand_i32_fn& expand_i32_slot() noexcept { static expand_i32_fn fn = nullptr; return fn; }
+    inline expand_i64_fn& expand_i64_slot() noexcept { static expand_i64_fn fn = nullptr; return fn; }
+    inline isa_level& expand_i8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& expand_i16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& expand_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& expand_i64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_expand_i8(isa_level lvl, expand_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (expand_i8_slot() == nullptr || lvl > expand_i8_lvl())) { expand_i8_slot() = fn; expand_i8_lvl() = lvl; } }
+    inline void register_expand_i16(isa_level lvl, expand_i16_fn fn) noexcept
+    { if (best_isa() >= lvl && (expand_i16_slot() == nullptr || lvl > expand_i16_lvl())) { expand_i16_slot() = fn; expand_i16_lvl() = lvl; } }
+    inline void register_expand_i32(isa_level lvl, expand_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (expand_i32_slot() == nullptr || lvl > expand_i32_lvl())) { expand_i32_slot() = fn; expand_i32_lvl() = lvl; } }
+    inline void register_expand_i64(isa_level lvl, expand_i64_fn fn) noexcept
+    { if (best_isa() >= lvl && (expand_i64_slot() == nullptr || lvl > expand_i64_lvl())) { expand_i64_slot() = fn; expand_i64_lvl() = lvl; } }
+    // --- take by int32 index arrays, and a gather-based sparse dot product ---
+    // Kernels gather 32/64-bit values through 32-bit row ids; they are registered only
+    // where hardware gathers beat scalar loads (cpu_features::slow_gather).
+    using take_i32_fn    = void (*)(const std::int32_t*, const std::int32_t*, std::size_t, std::int32_t*) noexcept;
+    using take_i64_fn    = void (*)(const std::int64_t*, const std::int32_t*, std::size_t, std::int64_t*) noexcept;
+    using sparse_dot_f32_fn = float  (*)(const float*,  const std::int32_t*, const float*,  std::size_t) noexcept;
+    using sparse_dot_f64_fn = double (*)(const double*, const std::int32_t*, const double*, std::size_t) noexcept;
+    inline take_i32_fn&    take_i32_slot()    noexcept { static take_i32_fn    fn = nullptr; return fn; }
+    inline take_i64_fn&    take_i64_slot()    noexcept { static take_i64_fn    fn = nullptr; return fn; }
+    inline sparse_dot_f32_fn& sparse_dot_f32_slot() noexcept { static sparse_dot_f32_fn fn = nullptr; return fn; }
+    inline sparse_dot_f64_fn& sparse_dot_f64_slot() noexcept { static sparse_dot_f64_fn fn = nullptr; return fn; }
+    inline isa_level& take_i32_lvl()    noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& take_i64_lvl()    noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& sparse_dot_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& sparse_dot_f64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_take_i32(isa_level lvl, take_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (take_i32_slot() == nullptr || lvl > take_i32_lvl())) { take_i32_slot() = fn; take_i32_lvl() = lvl; } }
+    inline void register_take_i64(isa_level lvl, take_i64_fn fn) noexcept
+    { if (best_isa() >= lvl && (take_i64_slot() == nullptr || lvl > take_i64_lvl())) { take_i64_slot() = fn; take_i64_lvl() = lvl; } }
+    inline void register_sparse_dot_f32(isa_level lvl, sparse_dot_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (sparse_dot_f32_slot() == nullptr || lvl > sparse_dot_f32_lvl())) { sparse_dot_f32_slot() = fn; sparse_dot_f32_lvl() = lvl; } }
+    inline void register_sparse_dot_f64(isa_level lvl, sparse_dot_f64_fn fn) noexcept
+    { if (best_isa() >= lvl && (sparse_dot_f64_slot() == nullptr || lvl > sparse_dot_f64_lvl())) { sparse_dot_f64_slot() = fn; sparse_dot_f64_lvl() = lvl; } }
+    // --- prefix sum: out[i] = init + in[0..i] (inclusive) or in[0..i) (exclusive, flag) ---
+    // `out` may alias `in`. SSE2, AVX2 and AVX-512 tiers all register.
+    using scan_i32_fn = void (*)(const std::int32_t*, std::size_t, std::int32_t*, std::int32_t, bool) noexcept;
+    using scan_i64_fn = void (*)(const std::int64_t*, std::size_t, std::int64_t*, std::int64_t, bool) noexcept;
+    using scan_f32_fn = void (*)(const float*,  std::size_t, float*,  float,  bool) noexcept;
+    using scan_f64_fn = void (*)(const double*, std::size_t, double*, double, bool) noexcept;
+    inline scan_i32_fn& scan_i32_slot() noexcept { static scan_i32_fn fn = nullptr; return fn; }
+    inline scan_i64_fn& scan_i64_slot() noexcept { static scan_i64_fn fn = nullptr; return fn; }
+    inline scan_f32_fn& scan_f32_slot() noexcept { static scan_f32_fn fn = nullptr; return fn; }
+    inline scan_f64_fn& scan_f64_slot() noexcept { static scan_f64_fn fn = nullptr; return fn; }
+    inline isa_level& scan_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& scan_i64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& scan_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& scan_f64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_scan_i32(isa_level lvl, scan_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (scan_i32_slot() == nullptr || lvl > scan_i32_lvl())) { scan_i32_slot() = fn; scan_i32_lvl() = lvl; } }
+    inline void register_scan_i64(isa_level lvl, scan_i64_fn fn) noexcept
+    { if (best_isa() >= lvl && (scan_i64_slot() == nullptr || lvl > scan_i64_lvl())) { scan_i64_slot() = fn; scan_i64_lvl() = lvl; } }
+    inline void register_scan_f32(isa_level lvl, scan_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (scan_f32_slot() == nullptr || lvl > scan_f32_lvl())) { scan_f32_slot() = fn; scan_f32_lvl() = lvl; } }
+    inline void register_scan_f64(isa_level lvl, scan_f64_fn fn) noexcept
+    { if (best_isa() >= lvl && (scan_f64_slot() == nullptr || lvl > scan_f64_lvl())) { scan_f64_slot() = fn; scan_f64_lvl() = lvl; } }
+    // --- 16-bit histogram: hist[v] = occurrences of v, 65536 bins, overwritten ---
+    // (Bytes have no slot: the portable sub-histogram loop beats every kernel tried.)
+    using histogram_u16_fn = void (*)(const std::uint16_t*, std::size_t, std::uint32_t*) noexcept;
+    inline histogram_u16_fn& histogram_u16_slot() noexcept { static histogram_u16_fn fn = nullptr; return fn; }
+    inline isa_level& histogram_u16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_histogram_u16(isa_level lvl, histogram_u16_fn fn) noexcept
+    { if (best_isa() >= lvl && (histogram_u16_slot() == nullptr || lvl > histogram_u16_lvl())) { histogram_u16_slot() = fn; histogram_u16_lvl() = lvl; } }
+    // --- widening sum: int8/int16 -> int64, uint8/uint16 -> uint64, float -> double ---
+    using reduce_wide_i8_fn  = std::int64_t  (*)(const std::int8_t*,   std::size_t) noexcept;
+    using reduce_wide_u8_fn  = std::uint64_t (*)(const std::uint8_t*,  std::size_t) noexcept;
+    using reduce_wide_i16_fn = std::int64_t  (*)(const std::int16_t*,  std::size_t) noexcept;
+    using reduce_wide_u16_fn = std::uint64_t (*)(const std::uint16_t*, std::size_t) noexcept;
+    using reduce_wide_f32_fn = double        (*)(const float*,         std::size_t) noexcept;
+    inline reduce_wide_i8_fn&  reduce_wide_i8_slot()  noexcept { static reduce_wide_i8_fn  fn = nullptr; return fn; }
+    inline reduce_wide_u8_fn&  reduce_wide_u8_slot()  noexcept { static reduce_wide_u8_fn  fn = nullptr; return fn; }
+    inline reduce_wide_i16_fn& reduce_wide_i16_slot() noexcept { static reduce_wide_i16_fn fn = nullptr; return fn; }
+    inline reduce_wide_u16_fn& reduce_wide_u16_slot() noexcept { static reduce_wide_u16_fn fn = nullptr; return fn; }
+    inline reduce_wide_f32_fn& reduce_wide_f32_slot() noexcept { static reduce_wide_f32_fn fn = nullptr; return fn; }
+    inline isa_level& reduce_wide_i8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& reduce_wide_u8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& reduce_wide_i16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& reduce_wide_u16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& reduce_wide_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_reduce_wide_i8(isa_level lvl, reduce_wide_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (reduce_wide_i8_slot() == nullptr || lvl > reduce_wide_i8_lvl())) { reduce_wide_i8_slot() = fn; reduce_wide_i8_lvl() = lvl; } }
+    inline void register_reduce_wide_u8(isa_level lvl, reduce_wide_u8_fn fn) noexcept
+    { if (best_isa() >= lvl && (reduce_wide_u8_slot() == nullptr || lvl > reduce_wide_u8_lvl())) { reduce_wide_u8_slot() = fn; reduce_wide_u8_lvl() = lvl; } }
+    inline void register_reduce_wide_i16(isa_level lvl, reduce_wide_i16_fn fn) noexcept
+    { if (best_isa() >= lvl && (reduce_wide_i16_slot() == nullptr || lvl > reduce_wide_i16_lvl())) { reduce_wide_i16_slot() = fn; reduce_wide_i16_lvl() = lvl; } }
+    inline void register_reduce_wide_u16(isa_level lvl, reduce_wide_u16_fn fn) noexcept
+    { if (best_isa() >= lvl && (reduce_wide_u16_slot() == nullptr || lvl > reduce_wide_u16_lvl())) { reduce_wide_u16_slot() = fn; reduce_wide_u16_lvl() = lvl; } }
+    inline void register_reduce_wide_f32(isa_level lvl, reduce_wide_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (reduce_wide_f32_slot() == nullptr || lvl > reduce_wide_f32_lvl())) { reduce_wide_f32_slot() = fn; reduce_wide_f32_lvl() = lvl; } }
+    // --- dot product: sum of a[i] * b[i] (FMA; AVX2 tier registers only if the CPU has FMA3) ---
+    using dot_f32_fn = float  (*)(const float*,  const float*,  std::size_t) noexcept;
+    using dot_f64_fn = double (*)(const double*, const double*, std::size_t) noexcept;
+    inline dot_f32_fn& dot_f32_slot() noexcept { static dot_f32_fn fn = nullptr; return fn; }
+    inline dot_f64_fn& dot_f64_slot() noexcept { static dot_f64_fn fn = nullptr; return fn; }
+    inline isa_level& dot_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& dot_f64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_dot_f32(isa_level lvl, dot_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (dot_f32_slot() == nullptr || lvl > dot_f32_lvl())) { dot_f32_slot() = fn; dot_f32_lvl() = lvl; } }
+    inline void register_dot_f64(isa_level lvl, dot_f64_fn fn) noexcept
+    { if (best_isa() >= lvl && (dot_f64_slot() == nullptr || lvl > dot_f64_lvl())) { dot_f64_slot() = fn; dot_f64_lvl() = lvl; } }
+    // --- batched similarity: one query vs `rows` row-major vectors of `dim` (FMA; AVX2 tier needs FMA3) ---
+    using many_f32_fn        = void (*)(const float*, const float*, std::size_t, std::size_t, float*) noexcept;
+    using many_i8_fn         = void (*)(const std::int8_t*, const std::int8_t*, std::size_t, std::size_t, std::int64_t*) noexcept;
+    using cosine_many_i8_fn  = void (*)(const std::int8_t*, const std::int8_t*, std::size_t, std::size_t, float*) noexcept;
+    inline many_f32_fn&       dot_many_f32_slot()    noexcept { static many_f32_fn fn = nullptr; return fn; }
+    inline many_f32_fn&       l2sq_many_f32_slot()   noexcept { static many_f32_fn fn = nullptr; return fn; }
+    inline many_f32_fn&       cosine_many_f32_slot() noexcept { static many_f32_fn fn = nullptr; return fn; }
+    inline many_i8_fn&        dot_many_i8_slot()     noexcept { static many_i8_fn fn = nullptr; return fn; }
+    inline many_i8_fn&        l2sq_many_i8_slot()    noexcept { static many_i8_fn fn = nullptr; return fn; }
+    inline cosine_many_i8_fn& cosine_many_i8_slot()  noexcept { static cosine_many_i8_fn fn = nullptr; return fn; }
+    inline isa_level& dot_many_f32_lvl()    noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& l2sq_many_f32_lvl()   noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& cosine_many_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& dot_many_i8_lvl()     noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& l2sq_many_i8_lvl()    noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& cosine_many_i8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_dot_many_f32(isa_level lvl, many_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (dot_many_f32_slot() == nullptr || lvl > dot_many_f32_lvl())) { dot_many_f32_slot() = fn; dot_many_f32_lvl() = lvl; } }
+    inline void register_l2sq_many_f32(isa_level lvl, many_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (l2sq_many_f32_slot() == nullptr || lvl > l2sq_many_f32_lvl())) { l2sq_many_f32_slot() = fn; l2sq_many_f32_lvl() = lvl; } }
+    inline void register_cosine_many_f32(isa_level lvl, many_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (cosine_many_f32_slot() == nullptr || lvl > cosine_many_f32_lvl())) { cosine_many_f32_slot() = fn; cosine_many_f32_lvl() = lvl; } }
+    inline void register_dot_many_i8(isa_level lvl, many_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (dot_many_i8_slot() == nullptr || lvl > dot_many_i8_lvl())) { dot_many_i8_slot() = fn; dot_many_i8_lvl() = lvl; } }
+    inline void register_l2sq_many_i8(isa_level lvl, many_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (l2sq_many_i8_slot() == nullptr || lvl > l2sq_many_i8_lvl())) { l2sq_many_i8_slot() = fn; l2sq_many_i8_lvl() = lvl; } }
+    inline void register_cosine_many_i8(isa_level lvl, cosine_many_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (cosine_many_i8_slot() == nullptr || lvl > cosine_many_i8_lvl())) { cosine_many_i8_slot() = fn; cosine_many_i8_lvl() = lvl; } }
+    // --- one-pass moments: per-lane Welford states, laid out [mean L][M2 L][M3 L][M4 L] ---
+    // Returns the lane count L (<= moments_max_lanes); each lane consumed n / L elements.
+    inline constexpr std::size_t moments_max_lanes = 64;
+    using moments_f32_fn = std::size_t (*)(const float*,  std::size_t, bool fourth, float*  lanes) noexcept;
+    using moments_f64_fn = std::size_t (*)(const double*, std::size_t, bool fourth, double* lanes) noexcept;
+    inline moments_f32_fn& moments_f32_slot() noexcept { static moments_f32_fn fn = nullptr; return fn; }
+    inline moments_f64_fn& moments_f64_slot() noexcept { static moments_f64_fn fn = nullptr; return fn; }
+    inline isa_level& moments_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& moments_f64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_moments_f32(isa_level lvl, moments_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (moments_f32_slot() == nullptr || lvl > moments_f32_lvl())) { moments_f32_slot() = fn; moments_f32_lvl() = lvl; } }
+    inline void register_moments_f64(isa_level lvl, moments_f64_fn fn) noexcept
+    { if (best_isa() >= lvl && (moments_f64_slot() == nullptr || lvl > moments_f64_lvl())) { moments_f64_slot() = fn; moments_f64_lvl() = lvl; } }
+    // --- element conversion: saturating packs, uint8 -> float, float -> int rounding (see convert.hpp) ---
+    using convert_sat_i32_i16_fn = void (*)(const std::int32_t*, std::size_t, std::int16_t*) noexcept;
+    using convert_sat_i32_u8_fn = void (*)(const std::int32_t*, std::size_t, std::uint8_t*) noexcept;
+    using convert_sat_i16_i8_fn = void (*)(const std::int16_t*, std::size_t, std::int8_t*) noexcept;
+    using convert_sat_i16_u8_fn = void (*)(const std::int16_t*, std::size_t, std::uint8_t*) noexcept;
+    using convert_u8_f32_fn = void (*)(const std::uint8_t*, std::size_t, float*) noexcept;
+    using convert_round_f32_i32_fn = void (*)(const float*, std::size_t, std::int32_t*) noexcept;
+    using convert_round_f32_u8_fn = void (*)(const float*, std::size_t, std::uint8_t*) noexcept;
+    inline convert_sat_i32_i16_fn&   convert_sat_i32_i16_slot()   noexcept { static convert_sat_i32_i16_fn fn = nullptr; return fn; }
+    inline convert_sat_i32_u8_fn&    convert_sat_i32_u8_slot()    noexcept { static convert_sat_i32_u8_fn fn = nullptr; return fn; }
+    inline convert_sat_i16_i8_fn&    convert_sat_i16_i8_slot()    noexcept { static convert_sat_i16_i8_fn fn = nullptr; return fn; }
+    inline convert_sat_i16_u8_fn&    convert_sat_i16_u8_slot()    noexcept { static convert_sat_i16_u8_fn fn = nullptr; return fn; }
+    inline convert_u8_f32_fn&        convert_u8_f32_slot()        noexcept { static convert_u8_f32_fn fn = nullptr; return fn; }
+    inline convert_round_f32_i32_fn& convert_round_f32_i32_slot() noexcept { static convert_round_f32_i32_fn fn = nullptr; return fn; }
+    inline convert_round_f32_u8_fn&  convert_round_f32_u8_slot()  noexcept { static convert_round_f32_u8_fn fn = nullptr; return fn; }
+    inline isa_level& convert_sat_i32_i16_lvl()   noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& convert_sat_i32_u8_lvl()    noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& convert_sat_i16_i8_lvl()    noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& convert_sat_i16_u8_lvl()    noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& convert_u8_f32_lvl()        noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& convert_round_f32_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& convert_round_f32_u8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_convert_sat_i32_i16(isa_level lvl, convert_sat_i32_i16_fn fn) noexcept
+    { if (best_isa() >= lvl && (convert_sat_i32_i16_slot() == nullptr || lvl > convert_sat_i32_i16_lvl())) { convert_sat_i32_i16_slot() = fn; convert_sat_i32_i16_lvl() = lvl; } }
+    inline void register_convert_sat_i32_u8(isa_level lvl, convert_sat_i32_u8_fn fn) noexcept
+    { if (best_isa() >= lvl && (convert_sat_i32_u8_slot() == nullptr || lvl > convert_sat_i32_u8_lvl())) { convert_sat_i32_u8_slot() = fn; convert_sat_i32_u8_lvl() = lvl; } }
+    inline void register_convert_sat_i16_i8(isa_level lvl, convert_sat_i16_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (convert_sat_i16_i8_slot() == nullptr || lvl > convert_sat_i16_i8_lvl())) { convert_sat_i16_i8_slot() = fn; convert_sat_i16_i8_lvl() = lvl; } }
+    inline void register_convert_sat_i16_u8(isa_level lvl, convert_sat_i16_u8_fn fn) noexcept
+    { if (best_isa() >= lvl && (convert_sat_i16_u8_slot() == nullptr || lvl > convert_sat_i16_u8_lvl())) { convert_sat_i16_u8_slot() = fn; convert_sat_i16_u8_lvl() = lvl; } }
+    inline void register_convert_u8_f32(isa_level lvl, convert_u8_f32_fn fn) noexcept
+    { if (best_isa() >= lvl && (convert_u8_f32_slot() == nullptr || lvl > convert_u8_f32_lvl())) { convert_u8_f32_slot() = fn; convert_u8_f32_lvl() = lvl; } }
+    inline void register_convert_round_f32_i32(isa_level lvl, convert_round_f32_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (convert_round_f32_i32_slot() == nullptr || lvl > convert_round_f32_i32_lvl())) { convert_round_f32_i32_slot() = fn; convert_round_f32_i32_lvl() = lvl; } }
+    inline void register_convert_round_f32_u8(isa_level lvl, convert_round_f32_u8_fn fn) noexcept
+    { if (best_isa() >= lvl && (convert_round_f32_u8_slot() == nullptr || lvl > convert_round_f32_u8_lvl())) { convert_round_f32_u8_slot() = fn; convert_round_f32_u8_lvl() = lvl; } }
+    // --- half-precision bulk conversion (IEEE fp16 / bfloat16 as raw uint16 bits; see half.hpp) ---
+    // The AVX2 tier registers the fp16 pair only with F16C; the AVX-512 f32 -> bf16 needs AVX512_BF16.
+    using from_half_fn = void (*)(const std::uint16_t*, std::size_t, float*) noexcept;
+    using to_half_fn   = void (*)(const float*, std::size_t, std::uint16_t*) noexcept;
+    inline from_half_fn& f16_to_f32_slot()  noexcept { static from_half_fn fn = nullptr; return fn; }
+    inline to_half_fn&   f32_to_f16_slot()  noexcept { static to_half_fn fn = nullptr; return fn; }
+    inline from_half_fn& bf16_to_f32_slot() noexcept { static from_half_fn fn = nullptr; return fn; }
+    inline to_half_fn&   f32_to_bf16_slot() noexcept { static to_half_fn fn = nullptr; return fn; }
+    inline isa_level& f16_to_f32_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& f32_to_f16_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& bf16_to_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& f32_to_bf16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_f16_to_f32(isa_level lvl, from_half_fn fn) noexcept
+    { if (best_isa() >= lvl && (f16_to_f32_slot() == nullptr || lvl > f16_to_f32_lvl())) { f16_to_f32_slot() = fn; f16_to_f32_lvl() = lvl; } }
+    inline void register_f32_to_f16(isa_level lvl, to_half_fn fn) noexcept
+    { if (best_isa() >= lvl && (f32_to_f16_slot() == nullptr || lvl > f32_to_f16_lvl())) { f32_to_f16_slot() = fn; f32_to_f16_lvl() = lvl; } }
+    inline void register_bf16_to_f32(isa_level lvl, from_half_fn fn) noexcept
+    { if (best_isa() >= lvl && (bf16_to_f32_slot() == nullptr || lvl > bf16_to_f32_lvl())) { bf16_to_f32_slot() = fn; bf16_to_f32_lvl() = lvl; } }
+    inline void register_f32_to_bf16(isa_level lvl, to_half_fn fn) noexcept
+    { if (best_isa() >= lvl && (f32_to_bf16_slot() == nullptr || lvl > f32_to_bf16_lvl())) { f32_to_bf16_slot() = fn; f32_to_bf16_lvl() = lvl; } }
+    // --- linear quantize / dequantize (float <-> int8 / uint8; see quantize.hpp) ---
+    // The kernels take 1 / scale for quantize and scale for dequantize.
+    using quantize_i8_fn   = void (*)(const float*, std::size_t, float, std::int32_t, std::int8_t*) noexcept;
+    using quantize_u8_fn   = void (*)(const float*, std::size_t, float, std::int32_t, std::uint8_t*) noexcept;
+    using dequantize_i8_fn = void (*)(const std::int8_t*, std::size_t, float, std::int32_t, float*) noexcept;
+    using dequantize_u8_fn = void (*)(const std::uint8_t*, std::size_t, float, std::int32_t, float*) noexcept;
+    inline quantize_i8_fn&   quantize_i8_slot()   noexcept { static quantize_i8_fn fn = nullptr; return fn; }
+    inline quantize_u8_fn&   quantize_u8_slot()   noexcept { static quantize_u8_fn fn = nullptr; return fn; }
+    inline dequantize_i8_fn& dequantize_i8_slot() noexcept { static dequantize_i8_fn fn = nullptr; return fn; }
+    inline dequantize_u8_fn& dequantize_u8_slot() noexcept { static dequantize_u8_fn fn = nullptr; return fn; }
+    inline isa_level& quantize_i8_lvl()   noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& quantize_u8_lvl()   noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& dequantize_i8_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& dequantize_u8_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_quantize_i8(isa_level lvl, quantize_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (quantize_i8_slot() == nullptr || lvl > quantize_i8_lvl())) { quantize_i8_slot() = fn; quantize_i8_lvl() = lvl; } }
+    inline void register_quantize_u8(isa_level lvl, quantize_u8_fn fn) noexcept
+    { if (best_isa() >= lvl && (quantize_u8_slot() == nullptr || lvl > quantize_u8_lvl())) { quantize_u8_slot() = fn; quantize_u8_lvl() = lvl; } }
+    inline void register_dequantize_i8(isa_level lvl, dequantize_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (dequantize_i8_slot() == nullptr || lvl > dequantize_i8_lvl())) { dequantize_i8_slot() = fn; dequantize_i8_lvl() = lvl; } }
+    inline void register_dequantize_u8(isa_level lvl, dequantize_u8_fn fn) noexcept
+    { if (best_isa() >= lvl && (dequantize_u8_slot() == nullptr || lvl > dequantize_u8_lvl())) { dequantize_u8_slot() = fn; dequantize_u8_lvl() = lvl; } }
+    // --- bitpack / bitunpack whole 512-value blocks (vertical layout; see bitpack.hpp) ---
+    using bitpack_blocks_fn = void (*)(const std::uint32_t*, std::size_t, unsigned, std::uint32_t*) noexcept;
+    inline bitpack_blocks_fn& bitpack_slot()   noexcept { static bitpack_blocks_fn fn = nullptr; return fn; }
+    inline bitpack_blocks_fn& bitunpack_slot() noexcept { static bitpack_blocks_fn fn = nullptr; return fn; }
+    inline isa_level& bitpack_lvl()   noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& bitunpack_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_bitpack(isa_level lvl, bitpack_blocks_fn fn) noexcept
+    { if (best_isa() >= lvl && (bitpack_slot() == nullptr || lvl > bitpack_lvl())) { bitpack_slot() = fn; bitpack_lvl() = lvl; } }
+    inline void register_bitunpack(isa_level lvl, bitpack_blocks_fn fn) noexcept
+    { if (best_isa() >= lvl && (bitunpack_slot() == nullptr || lvl > bitunpack_lvl())) { bitunpack_slot() = fn; bitunpack_lvl() = lvl; } }
+    // --- StreamVByte whole quads (4 values per control byte; see streamvbyte.hpp) ---
+    // Both return the data cursor past the last quad. encode may store up to 12
+    // bytes past its last quad (the caller's buffer is streamvbyte_max_bytes);
+    // decode may load up to 12 bytes past it (the caller keeps 3 quads back).
+    using svb_encode_fn = std::uint8_t* (*)(const std::uint32_t*, std::size_t, std::uint8_t*, std::uint8_t*) noexcept;
+    using svb_decode_fn = const std::uint8_t* (*)(const std::uint8_t*, const std::uint8_t*, std::size_t, std::uint32_t*) noexcept;
+    inline svb_encode_fn& svb_encode_slot() noexcept { static svb_encode_fn fn = nullptr; return fn; }
+    inline svb_decode_fn& svb_decode_slot() noexcept { static svb_decode_fn fn = nullptr; return fn; }
+    inline isa_level& svb_encode_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& svb_decode_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_svb_encode(isa_level lvl, svb_encode_fn fn) noexcept
+    { if (best_isa() >= lvl && (svb_encode_slot() == nullptr || lvl > svb_encode_lvl())) { svb_encode_slot() = fn; svb_encode_lvl() = lvl; } }
+    inline void register_svb_decode(isa_level lvl, svb_decode_fn fn) noexcept
+    { if (best_isa() >= lvl && (svb_decode_slot() == nullptr || lvl > svb_decode_lvl())) { svb_decode_slot() = fn; svb_decode_lvl() = lvl; } }
+    // --- rle_encode / rle_decode for 1/2/4/8-byte ints (see rle.hpp) ---
+    // encode writes each run's last value and END index (exclusive) and returns the
+    // run count; decode takes the decoded total n as the bound for its wide stores.
+    using rle_encode_i8_fn  = std::size_t (*)(const std::int8_t*, std::size_t, std::int8_t*, std::uint32_t*) noexcept;
+    using rle_encode_i16_fn = std::size_t (*)(const std::int16_t*, std::size_t, std::int16_t*, std::uint32_t*) noexcept;
+    using rle_encode_i32_fn = std::size_t (*)(const std::int32_t*, std::size_t, std::int32_t*, std::uint32_t*) noexcept;
+    using rle_encode_i64_fn = std::size_t (*)(const std::int64_t*, std::size_t, std::int64_t*, std::uint32_t*) noexcept;
+    using rle_decode_i8_fn  = std::size_t (*)(const std::int8_t*, const std::uint32_t*, std::size_t, std::size_t, std::int8_t*) noexcept;
+    using rle_decode_i16_fn = std::size_t (*)(const std::int16_t*, const std::uint32_t*, std::size_t, std::size_t, std::int16_t*) noexcept;
+    using rle_decode_i32_fn = std::size_t (*)(const std::int32_t*, const std::uint32_t*, std::size_t, std::size_t, std::int32_t*) noexcept;
+    using rle_decode_i64_fn = std::size_t (*)(const std::int64_t*, const std::uint32_t*, std::size_t, std::size_t, std::int64_t*) noexcept;
+    inline rle_encode_i8_fn&  rle_encode_i8_slot()  noexcept { static rle_encode_i8_fn  fn = nullptr; return fn; }
+    inline rle_encode_i16_fn& rle_encode_i16_slot() noexcept { static rle_encode_i16_fn fn = nullptr; return fn; }
+    inline rle_encode_i32_fn& rle_encode_i32_slot() noexcept { static rle_encode_i32_fn fn = nullptr; return fn; }
+    inline rle_encode_i64_fn& rle_encode_i64_slot() noexcept { static rle_encode_i64_fn fn = nullptr; return fn; }
+    inline rle_decode_i8_fn&  rle_decode_i8_slot()  noexcept { static rle_decode_i8_fn  fn = nullptr; return fn; }
+    inline rle_decode_i16_fn& rle_decode_i16_slot() noexcept { static rle_decode_i16_fn fn = nullptr; return fn; }
+    inline rle_decode_i32_fn& rle_decode_i32_slot() noexcept { static rle_decode_i32_fn fn = nullptr; return fn; }
+    inline rle_decode_i64_fn& rle_decode_i64_slot() noexcept { static rle_decode_i64_fn fn = nullptr; return fn; }
+    inline isa_level& rle_encode_i8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& rle_encode_i16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& rle_encode_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& rle_encode_i64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& rle_decode_i8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& rle_decode_i16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& rle_decode_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& rle_decode_i64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_rle_encode_i8(isa_level lvl, rle_encode_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_encode_i8_slot() == nullptr || lvl > rle_encode_i8_lvl())) { rle_encode_i8_slot() = fn; rle_encode_i8_lvl() = lvl; } }
+    inline void register_rle_encode_i16(isa_level lvl, rle_encode_i16_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_encode_i16_slot() == nullptr || lvl > rle_encode_i16_lvl())) { rle_encode_i16_slot() = fn; rle_encode_i16_lvl() = lvl; } }
+    inline void register_rle_encode_i32(isa_level lvl, rle_encode_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_encode_i32_slot() == nullptr || lvl > rle_encode_i32_lvl())) { rle_encode_i32_slot() = fn; rle_encode_i32_lvl() = lvl; } }
+    inline void register_rle_encode_i64(isa_level lvl, rle_encode_i64_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_encode_i64_slot() == nullptr || lvl > rle_encode_i64_lvl())) { rle_encode_i64_slot() = fn; rle_encode_i64_lvl() = lvl; } }
+    inline void register_rle_decode_i8(isa_level lvl, rle_decode_i8_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_decode_i8_slot() == nullptr || lvl > rle_decode_i8_lvl())) { rle_decode_i8_slot() = fn; rle_decode_i8_lvl() = lvl; } }
+    inline void register_rle_decode_i16(isa_level lvl, rle_decode_i16_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_decode_i16_slot() == nullptr || lvl > rle_decode_i16_lvl())) { rle_decode_i16_slot() = fn; rle_decode_i16_lvl() = lvl; } }
+    inline void register_rle_decode_i32(isa_level lvl, rle_decode_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_decode_i32_slot() == nullptr || lvl > rle_decode_i32_lvl())) { rle_decode_i32_slot() = fn; rle_decode_i32_lvl() = lvl; } }
+    inline void register_rle_decode_i64(isa_level lvl, rle_decode_i64_fn fn) noexcept
+    { if (best_isa() >= lvl && (rle_decode_i64_slot() == nullptr || lvl > rle_decode_i64_lvl())) { rle_decode_i64_slot() = fn; rle_decode_i64_lvl() = lvl; } }
+    // --- selection bitmaps: popcount / bitmap_to_indices over whole 64-bit words (see bitmap.hpp) ---
+    // bitmap_to_indices writes base + row and may store whole registers up to out + words * 64.
+    using bitmap_popcount_fn   = std::size_t (*)(const std::uint64_t*, std::size_t) noexcept;
+    using bitmap_to_indices_fn = std::size_t (*)(const std::uint64_t*, std::size_t, std::uint32_t, std::uint32_t*) noexcept;
+    inline bitmap_popcount_fn&   bitmap_popcount_slot()   noexcept { static bitmap_popcount_fn fn = nullptr; return fn; }
+    inline bitmap_to_indices_fn& bitmap_to_indices_slot() noexcept { static bitmap_to_indices_fn fn = nullptr; return fn; }
+    inline isa_level& bitmap_popcount_lvl()   noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& bitmap_to_indices_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_bitmap_popcount(isa_level lvl, bitmap_popcount_fn fn) noexcept
+    { if (best_isa() >= lvl && (bitmap_popcount_slot() == nullptr || lvl > bitmap_popcount_lvl())) { bitmap_popcount_slot() = fn; bitmap_popcount_lvl() = lvl; } }
+    inline void register_bitmap_to_indices(isa_level lvl, bitmap_to_indices_fn fn) noexcept
+    { if (best_isa() >= lvl && (bitmap_to_indices_slot() == nullptr || lvl > bitmap_to_indices_lvl())) { bitmap_to_indices_slot() = fn; bitmap_to_indices_lvl() = lvl; } }
+    // --- compress 32- / 64-bit values by a row bitmap over whole 64-bit words (see copy_if.hpp) ---
+    // out may alias src; stores whole registers up to out + words * 64.
+    using compress_bits_i32_fn = std::size_t (*)(const std::int32_t*, std::size_t, const std::uint64_t*, std::int32_t*) noexcept;
+    inline compress_bits_i32_fn& compress_bits_i32_slot() noexcept { static compress_bits_i32_fn fn = nullptr; return fn; }
+    inline isa_level& compress_bits_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_compress_bits_i32(isa_level lvl, compress_bits_i32_fn fn) noexcept
+    { if (best_isa() >= lvl && (compress_bits_i32_slot() == nullptr || lvl > compress_bits_i32_lvl())) { compress_bits_i32_slot() = fn; compress_bits_i32_lvl() = lvl; } }
+    using compress_bits_i64_fn = std::size_t (*)(const std::int64_t*, std::size_t, const std::uint64_t*, std::int64_t*) noexcept;
+    inline compress_bits_i64_fn& compress_bits_i64_slot() noexcept { static compress_bits_i64_fn fn = nullptr; return fn; }
+    inline isa_level& compress_bits_i64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_compress_bits_i64(isa_level lvl, compress_bits_i64_fn fn) noexcept
+    { if (best_isa() >= lvl && (compress_bits_i64_slot() == nullptr || lvl > compress_bits_i64_lvl())) { compress_bits_i64_slot() = fn; compress_bits_i64_lvl() = lvl; } }
+    // --- compare-with-constant filters for copy_if / remove_if / count_if (see predicates.hpp) ---
+    // Keep row i iff op(a[i]) != negate; returns the kept count. out == nullptr only
+    // counts. Writes exactly out[0, count) (out may alias a).
+    enum class cmp_op : std::uint8_t { eq, ne, lt, le, gt, ge, between, in_set };
+    template <class T>
+    struct filter_spec
+    {
+        cmp_op op;
+        bool negate;
+        T lo, hi;              // the constant (lo), or the closed range [lo, hi]
+        const T* set;          // in_set: set_n values
+        std::size_t set_n;
+    };
+    template <class T> using filter_fn = std::size_t (*)(const T*, std::size_t, const filter_spec<T>&, T*) noexcept;
+    inline filter_fn<std::int8_t>&   filter_i8_slot()  noexcept { static filter_fn<std::int8_t>   fn = nullptr; return fn; }
+    inline filter_fn<std::uint8_t>&  filter_u8_slot()  noexcept { static filter_fn<std::uint8_t>  fn = nullptr; return fn; }
+    inline filter_fn<std::int16_t>&  filter_i16_slot() noexcept { static filter_fn<std::int16_t>  fn = nullptr; return fn; }
+    inline filter_fn<std::uint16_t>& filter_u16_slot() noexcept { static filter_fn<std::uint16_t> fn = nullptr; return fn; }
+    inline filter_fn<std::int32_t>&  filter_i32_slot() noexcept { static filter_fn<std::int32_t>  fn = nullptr; return fn; }
+    inline filter_fn<std::uint32_t>& filter_u32_slot() noexcept { static filter_fn<std::uint32_t> fn = nullptr; return fn; }
+    inline filter_fn<std::int64_t>&  filter_i64_slot() noexcept { static filter_fn<std::int64_t>  fn = nullptr; return fn; }
+    inline filter_fn<std::uint64_t>& filter_u64_slot() noexcept { static filter_fn<std::uint64_t> fn = nullptr; return fn; }
+    inline filter_fn<float>&         filter_f32_slot() noexcept { static filter_fn<float>         fn = nullptr; return fn; }
+    inline filter_fn<double>&        filter_f64_slot() noexcept { static filter_fn<double>        fn = nullptr; return fn; }
+    inline isa_level& filter_i8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_u8_lvl()  noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_i16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_u16_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_i32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_u32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_i64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_u64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_f32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline isa_level& filter_f64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_filter_i8(isa_level lvl, filter_fn<std::int8_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_i8_slot() == nullptr || lvl > filter_i8_lvl())) { filter_i8_slot() = fn; filter_i8_lvl() = lvl; } }
+    inline void register_filter_u8(isa_level lvl, filter_fn<std::uint8_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_u8_slot() == nullptr || lvl > filter_u8_lvl())) { filter_u8_slot() = fn; filter_u8_lvl() = lvl; } }
+    inline void register_filter_i16(isa_level lvl, filter_fn<std::int16_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_i16_slot() == nullptr || lvl > filter_i16_lvl())) { filter_i16_slot() = fn; filter_i16_lvl() = lvl; } }
+    inline void register_filter_u16(isa_level lvl, filter_fn<std::uint16_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_u16_slot() == nullptr || lvl > filter_u16_lvl())) { filter_u16_slot() = fn; filter_u16_lvl() = lvl; } }
+    inline void register_filter_i32(isa_level lvl, filter_fn<std::int32_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_i32_slot() == nullptr || lvl > filter_i32_lvl())) { filter_i32_slot() = fn; filter_i32_lvl() = lvl; } }
+    inline void register_filter_u32(isa_level lvl, filter_fn<std::uint32_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_u32_slot() == nullptr || lvl > filter_u32_lvl())) { filter_u32_slot() = fn; filter_u32_lvl() = lvl; } }
+    inline void register_filter_i64(isa_level lvl, filter_fn<std::int64_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_i64_slot() == nullptr || lvl > filter_i64_lvl())) { filter_i64_slot() = fn; filter_i64_lvl() = lvl; } }
+    inline void register_filter_u64(isa_level lvl, filter_fn<std::uint64_t> fn) noexcept
+    { if (best_isa() >= lvl && (filter_u64_slot() == nullptr || lvl > filter_u64_lvl())) { filter_u64_slot() = fn; filter_u64_lvl() = lvl; } }
+    inline void register_filter_f32(isa_level lvl, filter_fn<float> fn) noexcept
+    { if (best_isa() >= lvl && (filter_f32_slot() == nullptr || lvl > filter_f32_lvl())) { filter_f32_slot() = fn; filter_f32_lvl() = lvl; } }
+    inline void register_filter_f64(isa_level lvl, filter_fn<double> fn) noexcept
+    { if (best_isa() >= lvl && (filter_f64_slot() == nullptr || lvl > filter_f64_lvl())) { filter_f64_slot() = fn; filter_f64_lvl() = lvl; } }
+    // --- 256-entry byte translation / byte-code dictionary decode (see translate.hpp) ---
+    // out may alias the input for translate; dict_decode needs codes < dict_n <= 256.
+    using translate_u8_fn = void (*)(const std::uint8_t*, std::size_t, const std::uint8_t*, std::uint8_t*) noexcept;
+    inline translate_u8_fn& translate_u8_slot() noexcept { static translate_u8_fn fn = nullptr; return fn; }
+    inline isa_level& translate_u8_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_translate_u8(isa_level lvl, translate_u8_fn fn) noexcept
+    { if (best_isa() >= lvl && (translate_u8_slot() == nullptr || lvl > translate_u8_lvl())) { translate_u8_slot() = fn; translate_u8_lvl() = lvl; } }
+    using dict_decode_u32_fn = void (*)(const std::uint8_t*, std::size_t, const std::uint32_t*, std::size_t, std::uint32_t*) noexcept;
+    inline dict_decode_u32_fn& dict_decode_u32_slot() noexcept { static dict_decode_u32_fn fn = nullptr; return fn; }
+    inline isa_level& dict_decode_u32_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_dict_decode_u32(isa_level lvl, dict_decode_u32_fn fn) noexcept
+    { if (best_isa() >= lvl && (dict_decode_u32_slot() == nullptr || lvl > dict_decode_u32_lvl())) { dict_decode_u32_slot() = fn; dict_decode_u32_lvl() = lvl; } }
+    using dict_decode_u64_fn = void (*)(const std::uint8_t*, std::size_t, const std::uint64_t*, std::size_t, std::uint64_t*) noexcept;
+    inline dict_decode_u64_fn& dict_decode_u64_slot() noexcept { static dict_decode_u64_fn fn = nullptr; return fn; }
+    inline isa_level& dict_decode_u64_lvl() noexcept { static isa_level l = isa_level::scalar; return l; }
+    inline void register_dict_decode_u64(isa_level lvl, dict_decode_u64_fn fn) noexcept
+    { if (best_isa() >= lvl && (dict_decode_u64_slot() == nullptr || lvl > dict_decode_u64_lvl())) { dict_decode_u64_slot() = fn; dict_decode_u64_lvl() = lvl; } }
 } // namespace simdtl::platform
@@ -0,0 +1,24 @@
+#pragma once
+// ── L1: software prefetch hint ────────────────────────────────────────────────
+// Latency-bound loops (batched binary search, hash probing) issue the NEXT round's
+// loads one step early so several cache misses are in flight at once. A prefetch
+// is only a hint: it never faults and compiles to nothing where unsupported.
+#include "arch_macros.hpp"
+
+#if SIMDTL_ARCH_X86 && SIMDTL_COMPILER_MSVC
+#  include <xmmintrin.h>   // _mm_prefetch (SSE, part of the x64 baseline)
+#endif
+
+namespace simdtl::platform
+{
+    inline void prefetch(const void* p) noexcept
+    {
+#if SIMDTL_ARCH_X86 && SIMDTL_COMPILER_MSVC
+        _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(p, 0, 3);
+#else
+        (void)p;
+#endif
+    }
+} // namespace simdtl::platform
@@ -24,6 +24,27 @@
 #include "crosslane/reverse.hpp"     // M3: reverse (any element size; AVX2 int32)
 #include "algorithm/copy_if.hpp"     // M3: copy_if / remove_if / remove
 #include "string_range.hpp"          // M4: SSE4.2 count_in_range / to_lower/upper/flip_case
+#include "algorithm/search.hpp"      // lower_bound / lower_bound_many / btree_index
+#include "algorithm/expand.hpp"      // expand (inverse of copy_if) via bitmap
+#include "algorithm/gather.hpp"      // take / scatter / sparse_dot by index arrays
+#include "algorithm/scan.hpp"        // inclusive/exclusive_scan (+ parallel two-pass)
+#include "algorithm/histogram.hpp"   // histogram_u8/u16, count_values_in_small_domain
+#include "algorithm/transform_reduce.hpp" // transform_reduce / dot (dispatched FMA)
+#include "algorithm/similarity.hpp"  // dot_many / l2sq_many / cosine_many, nearest_k
+#include "algorithm/select.hpp"      // top_k / bottom_k / nth_element (threshold filtering)
+#include "algorithm/moments.hpp"     // moments / moment_state (one-pass vector Welford)
+#include "algorithm/convert.hpp"     // convert / convert_saturate / convert_round (pack / unpack)
+#include "algorithm/half.hpp"        // convert_f16/bf16_to_f32 and back (F16C / AVX-512 BF16)
+#include "algorithm/quantize.hpp"    // quantize / dequantize / calibrate (int8, uint8 scale + zero point)
+#include "algorithm/bitpack.hpp"     // bitpack / bitunpack (vertical layout) + fused count_if / reduce / sum
+#include "algorithm/delta.hpp"       // delta_encode / delta_decode (dispatched scan), zigzag_encode / zigzag_decode
+#include "algorithm/streamvbyte.hpp" // StreamVByte encode / decode (pshufb LUTs) + fused delta forms
+#include "algorithm/rle.hpp"         // rle_encode / rle_decode (shifted-neighbour boundaries, broadcast fills)
+#include "algorithm/bitmap.hpp"
+#include "algorithm/predicates.hpp"
+#include "algorithm/columns.hpp"
+#include "algorithm/translate.hpp"
+#include "algorithm/flat_hash.hpp"
 
 // Future milestones (kept here as the public surface map):
 // #include "crosslane/reverse.hpp"    // M3: any-size reverse
@@ -0,0 +1,49 @@
+// ── Opt-in AVX2 selection-bitmap kernels (self-registering) ───────────────────
+//   bitmap_popcount  : the pshufb nibble count (two table lookups per byte), byte
+//                      counts summed per 64-bit lane by vpsadbw; 8 words per step
+//                      in two accumulators, scalar popcnt for the rest.
+// bitmap_to_indices lives in crosslane_avx2.cpp, next to the perm_lut it reads.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    inline __m256i nibble_counts(__m256i v) noexcept
+    {
+        const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                               0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0F);
+        const __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, low));
+        const __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+        return _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256());
+    }
+
+    std::size_t bitmap_popcount_avx2(const std::uint64_t* bits, std::size_t words) noexcept
+    {
+        __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+        std::size_t w = 0;
+        for (; w + 8 <= words; w += 8)
+        {
+            a0 = _mm256_add_epi64(a0, nibble_counts(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + w))));
+            a1 = _mm256_add_epi64(a1, nibble_counts(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + w + 4))));
+        }
+        const __m256i a = _mm256_add_epi64(a0, a1);
+        const __m128i s = _mm_add_epi64(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+        std::size_t total = static_cast<std::size_t>(_mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1));
+        for (; w < words; ++w) total += static_cast<std::size_t>(_mm_popcnt_u64(bits[w]));
+        return total;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_bitmap_popcount(isa_level::avx2, &bitmap_popcount_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,96 @@
+// ── Opt-in AVX-512 selection-bitmap kernels (self-registering) ────────────────
+//   bitmap_popcount  : vpopcntq per 8 words where VPOPCNTDQ exists (probed at
+//                      registration), else the AVX2 kernel's nibble counts on
+//                      zmm; the last words are one zero-masked load.
+//   bitmap_to_indices: each 16-bit quarter of a word compresses iota + base into
+//                      a register (vpcompressd, never the memory form — see
+//                      crosslane_avx512.cpp) and stores it whole.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_VPOPCNTDQ __attribute__((target("avx512vpopcntdq")))
+#else
+#  define SIMDTL_TARGET_VPOPCNTDQ
+#endif
+
+namespace
+{
+    inline std::int64_t hsum64(__m512i v) noexcept
+    {
+        alignas(64) std::int64_t t[8];
+        _mm512_store_si512(t, v);
+        return ((t[0] + t[1]) + (t[2] + t[3])) + ((t[4] + t[5]) + (t[6] + t[7]));
+    }
+
+    inline __mmask8 tail8(std::size_t r) noexcept { return static_cast<__mmask8>((1u << r) - 1u); }
+
+    SIMDTL_TARGET_VPOPCNTDQ std::size_t bitmap_popcount_vpopcntdq(const std::uint64_t* bits, std::size_t words) noexcept
+    {
+        __m512i a0 = _mm512_setzero_si512(), a1 = _mm512_setzero_si512();
+        std::size_t w = 0;
+        for (; w + 16 <= words; w += 16)
+        {
+            a0 = _mm512_add_epi64(a0, _mm512_popcnt_epi64(_mm512_loadu_si512(bits + w)));
+            a1 = _mm512_add_epi64(a1, _mm512_popcnt_epi64(_mm512_loadu_si512(bits + w + 8)));
+        }
+        for (; w + 8 <= words; w += 8) a0 = _mm512_add_epi64(a0, _mm512_popcnt_epi64(_mm512_loadu_si512(bits + w)));
+        if (w < words) a1 = _mm512_add_epi64(a1, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(tail8(words - w), bits + w)));
+        return static_cast<std::size_t>(hsum64(_mm512_add_epi64(a0, a1)));
+    }
+
+    inline __m512i nibble_counts(__m512i v) noexcept
+    {
+        // popcount of 0..15 in each 128-bit lane (vpshufb looks up within lanes).
+        const __m512i table = _mm512_setr4_epi64(0x0302020102010100, 0x0403030203020201,
+                                                 0x0302020102010100, 0x0403030203020201);
+        const __m512i low = _mm512_set1_epi8(0x0F);
+        const __m512i lo = _mm512_shuffle_epi8(table, _mm512_and_si512(v, low));
+        const __m512i hi = _mm512_shuffle_epi8(table, _mm512_and_si512(_mm512_srli_epi16(v, 4), low));
+        return _mm512_sad_epu8(_mm512_add_epi8(lo, hi), _mm512_setzero_si512());
+    }
+
+    std::size_t bitmap_popcount_avx512(const std::uint64_t* bits, std::size_t words) noexcept
+    {
+        __m512i a = _mm512_setzero_si512();
+        std::size_t w = 0;
+        for (; w + 8 <= words; w += 8) a = _mm512_add_epi64(a, nibble_counts(_mm512_loadu_si512(bits + w)));
+        if (w < words) a = _mm512_add_epi64(a, nibble_counts(_mm512_maskz_loadu_epi64(tail8(words - w), bits + w)));
+        return static_cast<std::size_t>(hsum64(a));
+    }
+
+    std::size_t bitmap_to_indices_avx512(const std::uint64_t* bits, std::size_t words, std::uint32_t base, std::uint32_t* out) noexcept
+    {
+        const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        std::size_t k = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            const std::uint64_t x = bits[w];
+            if (x == 0) continue;
+            for (unsigned q = 0; q < 4; ++q)
+            {
+                const __mmask16 m = static_cast<__mmask16>(x >> (16 * q));
+                if (m == 0) continue;
+                const __m512i pos = _mm512_add_epi32(iota, _mm512_set1_epi32(static_cast<int>(base + w * 64 + 16 * q)));
+                _mm512_storeu_si512(out + k, _mm512_maskz_compress_epi32(m, pos));
+                k += static_cast<std::size_t>(_mm_popcnt_u32(m));
+            }
+        }
+        return k;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_bitmap_popcount(isa_level::avx512, detect_cpu_features().avx512vpopcntdq
+                                                            ? &bitmap_popcount_vpopcntdq : &bitmap_popcount_avx512);
+            register_bitmap_to_indices(isa_level::avx512, &bitmap_to_indices_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
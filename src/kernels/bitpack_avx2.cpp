@@ -0,0 +1,157 @@
+// ── Opt-in AVX2 bitpack / bitunpack kernels (self-registering) ────────────────
+// Whole 512-value blocks of the vertical layout in bitpack.hpp: the 16 lanes
+// are two ymm registers side by side, so each of a lane's 32 steps is one
+// vpsrld / vpslld pair, vpor and vpand per register, with the shift counts
+// immediates (one fully unrolled instantiation per width, picked once per
+// call). The tail stream stays in the header.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_BITPACK_INLINE [[gnu::always_inline]] inline
+#else
+#  define SIMDTL_BITPACK_INLINE inline
+#endif
+
+namespace
+{
+    constexpr std::size_t lanes = 16, block = 512;
+
+    constexpr std::uint32_t bit_mask(unsigned bits) noexcept
+    {
+        return bits >= 32 ? 0xFFFFFFFFu : (std::uint32_t{1} << bits) - 1u;
+    }
+
+    inline __m256i load(const std::uint32_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    inline void store(std::uint32_t* p, __m256i v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+    template <unsigned B, std::size_t K>
+    SIMDTL_BITPACK_INLINE void pack_step(const std::uint32_t* in, std::uint32_t* out, __m256i& a0, __m256i& a1) noexcept
+    {
+        constexpr unsigned s = K * B % 32, w = K * B / 32;
+        __m256i v0 = load(in + K * lanes), v1 = load(in + K * lanes + 8);
+        if constexpr (B < 32)
+        {
+            const __m256i m = _mm256_set1_epi32(static_cast<int>(bit_mask(B)));
+            v0 = _mm256_and_si256(v0, m);
+            v1 = _mm256_and_si256(v1, m);
+        }
+        if constexpr (s == 0) { a0 = v0; a1 = v1; }
+        else
+        {
+            a0 = _mm256_or_si256(a0, _mm256_slli_epi32(v0, s));
+            a1 = _mm256_or_si256(a1, _mm256_slli_epi32(v1, s));
+        }
+        if constexpr (s + B >= 32)
+        {
+            store(out + w * lanes, a0);
+            store(out + w * lanes + 8, a1);
+            if constexpr (s + B > 32)
+            {
+                a0 = _mm256_srli_epi32(v0, 32 - s);
+                a1 = _mm256_srli_epi32(v1, 32 - s);
+            }
+        }
+    }
+
+    template <unsigned B, std::size_t... K>
+    void pack_block(const std::uint32_t* in, std::uint32_t* out, std::index_sequence<K...>) noexcept
+    {
+        __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+        (pack_step<B, K>(in, out, a0, a1), ...);
+    }
+
+    template <unsigned B, std::size_t K>
+    SIMDTL_BITPACK_INLINE void unpack_step(const std::uint32_t* in, std::uint32_t* out, __m256i& c0, __m256i& c1) noexcept
+    {
+        constexpr unsigned s = K * B % 32, w = K * B / 32;
+        __m256i v0 = c0, v1 = c1;
+        if constexpr (s != 0)
+        {
+            v0 = _mm256_srli_epi32(v0, s);
+            v1 = _mm256_srli_epi32(v1, s);
+        }
+        if constexpr (s + B >= 32 && w + 1 < B)
+        {
+            c0 = load(in + (w + 1) * lanes);
+            c1 = load(in + (w + 1) * lanes + 8);
+            if constexpr (s + B > 32)
+            {
+                v0 = _mm256_or_si256(v0, _mm256_slli_epi32(c0, 32 - s));
+                v1 = _mm256_or_si256(v1, _mm256_slli_epi32(c1, 32 - s));
+            }
+        }
+        if constexpr (B < 32)
+        {
+            const __m256i m = _mm256_set1_epi32(static_cast<int>(bit_mask(B)));
+            v0 = _mm256_and_si256(v0, m);
+            v1 = _mm256_and_si256(v1, m);
+        }
+        store(out + K * lanes, v0);
+        store(out + K * lanes + 8, v1);
+    }
+
+    template <unsigned B, std::size_t... K>
+    void unpack_block(const std::uint32_t* in, std::uint32_t* out, std::index_sequence<K...>) noexcept
+    {
+        __m256i c0 = load(in), c1 = load(in + 8);
+        (unpack_step<B, K>(in, out, c0, c1), ...);
+    }
+
+    template <unsigned B>
+    void pack_blocks(const std::uint32_t* first, std::size_t blocks, std::uint32_t* out) noexcept
+    {
+        if constexpr (B > 0)
+            for (std::size_t b = 0; b < blocks; ++b)
+                pack_block<B>(first + b * block, out + b * lanes * B, std::make_index_sequence<32>{});
+    }
+
+    template <unsigned B>
+    void unpack_blocks(const std::uint32_t* in, std::size_t blocks, std::uint32_t* out) noexcept
+    {
+        if constexpr (B == 0)
+        {
+            for (std::size_t i = 0; i < blocks * block; i += 8) store(out + i, _mm256_setzero_si256());
+        }
+        else
+        {
+            for (std::size_t b = 0; b < blocks; ++b)
+                unpack_block<B>(in + b * lanes * B, out + b * block, std::make_index_sequence<32>{});
+        }
+    }
+
+    using blocks_fn = void (*)(const std::uint32_t*, std::size_t, std::uint32_t*) noexcept;
+
+    template <unsigned... B>
+    constexpr auto pack_table(std::integer_sequence<unsigned, B...>) noexcept { return std::array<blocks_fn, 33>{&pack_blocks<B>...}; }
+    template <unsigned... B>
+    constexpr auto unpack_table(std::integer_sequence<unsigned, B...>) noexcept { return std::array<blocks_fn, 33>{&unpack_blocks<B>...}; }
+
+    void bitpack_avx2(const std::uint32_t* first, std::size_t blocks, unsigned bits, std::uint32_t* out) noexcept
+    {
+        static constexpr auto table = pack_table(std::make_integer_sequence<unsigned, 33>{});
+        table[bits](first, blocks, out);
+    }
+
+    void bitunpack_avx2(const std::uint32_t* in, std::size_t blocks, unsigned bits, std::uint32_t* out) noexcept
+    {
+        static constexpr auto table = unpack_table(std::make_integer_sequence<unsigned, 33>{});
+        table[bits](in, blocks, out);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_bitpack(isa_level::avx2, &bitpack_avx2);
+            register_bitunpack(isa_level::avx2, &bitunpack_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
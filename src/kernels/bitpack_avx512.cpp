@@ -0,0 +1,126 @@
+// ── Opt-in AVX-512 bitpack / bitunpack kernels (self-registering) ─────────────
+// The AVX2 kernel with the layout's 16 lanes in one zmm register: per step one
+// vpsrld / vpslld pair, vpord and vpandd, shift counts as immediates, one fully
+// unrolled instantiation per width. The tail stream stays in the header.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_BITPACK_INLINE [[gnu::always_inline]] inline
+#else
+#  define SIMDTL_BITPACK_INLINE inline
+#endif
+
+namespace
+{
+    constexpr std::size_t lanes = 16, block = 512;
+
+    constexpr std::uint32_t bit_mask(unsigned bits) noexcept
+    {
+        return bits >= 32 ? 0xFFFFFFFFu : (std::uint32_t{1} << bits) - 1u;
+    }
+
+    inline __m512i load(const std::uint32_t* p) noexcept { return _mm512_loadu_si512(p); }
+    inline void store(std::uint32_t* p, __m512i v) noexcept { _mm512_storeu_si512(p, v); }
+
+    template <unsigned B, std::size_t K>
+    SIMDTL_BITPACK_INLINE void pack_step(const std::uint32_t* in, std::uint32_t* out, __m512i& acc) noexcept
+    {
+        constexpr unsigned s = K * B % 32, w = K * B / 32;
+        __m512i v = load(in + K * lanes);
+        if constexpr (B < 32) v = _mm512_and_si512(v, _mm512_set1_epi32(static_cast<int>(bit_mask(B))));
+        if constexpr (s == 0) acc = v;
+        else acc = _mm512_or_si512(acc, _mm512_maskz_slli_epi32(0xFFFF, v, s));
+        if constexpr (s + B >= 32)
+        {
+            store(out + w * lanes, acc);
+            if constexpr (s + B > 32) acc = _mm512_maskz_srli_epi32(0xFFFF, v, 32 - s);
+        }
+    }
+
+    template <unsigned B, std::size_t... K>
+    void pack_block(const std::uint32_t* in, std::uint32_t* out, std::index_sequence<K...>) noexcept
+    {
+        __m512i acc = _mm512_setzero_si512();
+        (pack_step<B, K>(in, out, acc), ...);
+    }
+
+    template <unsigned B, std::size_t K>
+    SIMDTL_BITPACK_INLINE void unpack_step(const std::uint32_t* in, std::uint32_t* out, __m512i& cur) noexcept
+    {
+        constexpr unsigned s = K * B % 32, w = K * B / 32;
+        __m512i v = cur;
+        if constexpr (s != 0) v = _mm512_maskz_srli_epi32(0xFFFF, v, s);
+        if constexpr (s + B >= 32 && w + 1 < B)
+        {
+            cur = load(in + (w + 1) * lanes);
+            if constexpr (s + B > 32) v = _mm512_or_si512(v, _mm512_maskz_slli_epi32(0xFFFF, cur, 32 - s));
+        }
+        if constexpr (B < 32) v = _mm512_and_si512(v, _mm512_set1_epi32(static_cast<int>(bit_mask(B))));
+        store(out + K * lanes, v);
+    }
+
+    template <unsigned B, std::size_t... K>
+    void unpack_block(const std::uint32_t* in, std::uint32_t* out, std::index_sequence<K...>) noexcept
+    {
+        __m512i cur = load(in);
+        (unpack_step<B, K>(in, out, cur), ...);
+    }
+
+    template <unsigned B>
+    void pack_blocks(const std::uint32_t* first, std::size_t blocks, std::uint32_t* out) noexcept
+    {
+        if constexpr (B > 0)
+            for (std::size_t b = 0; b < blocks; ++b)
+                pack_block<B>(first + b * block, out + b * lanes * B, std::make_index_sequence<32>{});
+    }
+
+    template <unsigned B>
+    void unpack_blocks(const std::uint32_t* in, std::size_t blocks, std::uint32_t* out) noexcept
+    {
+        if constexpr (B == 0)
+        {
+            for (std::size_t i = 0; i < blocks * block; i += lanes) store(out + i, _mm512_setzero_si512());
+        }
+        else
+        {
+            for (std::size_t b = 0; b < blocks; ++b)
+                unpack_block<B>(in + b * lanes * B, out + b * block, std::make_index_sequence<32>{});
+        }
+    }
+
+    using blocks_fn = void (*)(const std::uint32_t*, std::size_t, std::uint32_t*) noexcept;
+
+    template <unsigned... B>
+    constexpr auto pack_table(std::integer_sequence<unsigned, B...>) noexcept { return std::array<blocks_fn, 33>{&pack_blocks<B>...}; }
+    template <unsigned... B>
+    constexpr auto unpack_table(std::integer_sequence<unsigned, B...>) noexcept { return std::array<blocks_fn, 33>{&unpack_blocks<B>...}; }
+
+    void bitpack_avx512(const std::uint32_t* first, std::size_t blocks, unsigned bits, std::uint32_t* out) noexcept
+    {
+        static constexpr auto table = pack_table(std::make_integer_sequence<unsigned, 33>{});
+        table[bits](first, blocks, out);
+    }
+
+    void bitunpack_avx512(const std::uint32_t* in, std::size_t blocks, unsigned bits, std::uint32_t* out) noexcept
+    {
+        static constexpr auto table = unpack_table(std::make_integer_sequence<unsigned, 33>{});
+        table[bits](in, blocks, out);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_bitpack(isa_level::avx512, &bitpack_avx512);
+            register_bitunpack(isa_level::avx512, &bitunpack_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
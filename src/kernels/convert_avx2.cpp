@@ -0,0 +1,155 @@
+// ── Opt-in AVX2 conversion kernels (self-registering) ─────────────────────────
+// Saturating narrowing with the pack instructions: vpackssdw (int32 -> int16),
+// vpacksswb / vpackuswb (int16 -> int8 / uint8), and vpackssdw + vpackuswb for
+// int32 -> uint8. The packs work within 128-bit lanes, so the results come out
+// lane-interleaved and one vpermq / vpermd puts them back in order.
+// uint8 -> float: vpmovzxbd + vcvtdq2ps, eight at a time.
+// float -> int32 rounding: vcvtps2dq (nearest-even in the default MXCSR mode)
+// returns 0x80000000 for NaN and out-of-range lanes; NaN lanes are masked to 0
+// and lanes >= 2^31 flipped to INT32_MAX (below -2^31 it is already INT32_MIN).
+// float -> uint8 rounding clamps to [0, 255] first (vmaxps returns the 0 for
+// NaN), then converts and packs.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace
+{
+    // Same formulas as simdtl::detail::saturate_one, for the scalar tails.
+    template <class Out, class In>
+    inline Out clamp_to(In x) noexcept
+    {
+        constexpr In lo = static_cast<In>(std::numeric_limits<Out>::min());
+        constexpr In hi = static_cast<In>(std::numeric_limits<Out>::max());
+        return static_cast<Out>(x < lo ? lo : hi < x ? hi : x);
+    }
+
+    inline std::int32_t round_to_i32(float x) noexcept
+    {
+        if (!(x == x)) return 0;
+        const float r = std::rint(x);
+        if (r >= 2147483648.0f) return std::numeric_limits<std::int32_t>::max();
+        if (r < -2147483648.0f) return std::numeric_limits<std::int32_t>::min();
+        return static_cast<std::int32_t>(r);
+    }
+
+    inline std::uint8_t round_to_u8(float x) noexcept
+    {
+        x = x > 0.0f ? x : 0.0f;   // NaN -> 0
+        x = x < 255.0f ? x : 255.0f;
+        return static_cast<std::uint8_t>(std::rint(x));
+    }
+
+    inline __m256i load(const void* p) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+    inline void store(void* p, __m256i v) noexcept { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+
+    void convert_sat_i32_i16_avx2(const std::int32_t* first, std::size_t n, std::int16_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m256i r = _mm256_packs_epi32(load(first + i), load(first + i + 8));
+            store(out + i, _mm256_permute4x64_epi64(r, 0xD8));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = clamp_to<std::int16_t>(first[i]);
+    }
+
+    void convert_sat_i32_u8_avx2(const std::int32_t* first, std::size_t n, std::uint8_t* out) noexcept
+    {
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        const std::size_t body = n - n % 32;
+        for (std::size_t i = 0; i < body; i += 32)
+        {
+            const __m256i ab = _mm256_packs_epi32(load(first + i), load(first + i + 8));
+            const __m256i cd = _mm256_packs_epi32(load(first + i + 16), load(first + i + 24));
+            store(out + i, _mm256_permutevar8x32_epi32(_mm256_packus_epi16(ab, cd), order));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = clamp_to<std::uint8_t>(first[i]);
+    }
+
+    void convert_sat_i16_i8_avx2(const std::int16_t* first, std::size_t n, std::int8_t* out) noexcept
+    {
+        const std::size_t body = n - n % 32;
+        for (std::size_t i = 0; i < body; i += 32)
+        {
+            const __m256i r = _mm256_packs_epi16(load(first + i), load(first + i + 16));
+            store(out + i, _mm256_permute4x64_epi64(r, 0xD8));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = clamp_to<std::int8_t>(first[i]);
+    }
+
+    void convert_sat_i16_u8_avx2(const std::int16_t* first, std::size_t n, std::uint8_t* out) noexcept
+    {
+        const std::size_t body = n - n % 32;
+        for (std::size_t i = 0; i < body; i += 32)
+        {
+            const __m256i r = _mm256_packus_epi16(load(first + i), load(first + i + 16));
+            store(out + i, _mm256_permute4x64_epi64(r, 0xD8));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = clamp_to<std::uint8_t>(first[i]);
+    }
+
+    void convert_u8_f32_avx2(const std::uint8_t* first, std::size_t n, float* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+            _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(x)));
+            _mm256_storeu_ps(out + i + 8, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(x, 8))));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = static_cast<float>(first[i]);
+    }
+
+    inline __m256i round_i32(__m256 x) noexcept
+    {
+        const __m256i r = _mm256_cvtps_epi32(x);
+        const __m256 too_big = _mm256_cmp_ps(x, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+        const __m256 ordered = _mm256_cmp_ps(x, x, _CMP_ORD_Q);
+        return _mm256_and_si256(_mm256_xor_si256(r, _mm256_castps_si256(too_big)), _mm256_castps_si256(ordered));
+    }
+
+    void convert_round_f32_i32_avx2(const float* first, std::size_t n, std::int32_t* out) noexcept
+    {
+        const std::size_t body = n - n % 8;
+        for (std::size_t i = 0; i < body; i += 8) store(out + i, round_i32(_mm256_loadu_ps(first + i)));
+        for (std::size_t i = body; i < n; ++i) out[i] = round_to_i32(first[i]);
+    }
+
+    void convert_round_f32_u8_avx2(const float* first, std::size_t n, std::uint8_t* out) noexcept
+    {
+        const __m256 zero = _mm256_setzero_ps(), top = _mm256_set1_ps(255.0f);
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        auto in_range = [&](const float* p) {
+            return _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(p), zero), top));
+        };
+        const std::size_t body = n - n % 32;
+        for (std::size_t i = 0; i < body; i += 32)
+        {
+            const __m256i ab = _mm256_packs_epi32(in_range(first + i), in_range(first + i + 8));
+            const __m256i cd = _mm256_packs_epi32(in_range(first + i + 16), in_range(first + i + 24));
+            store(out + i, _mm256_permutevar8x32_epi32(_mm256_packus_epi16(ab, cd), order));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = round_to_u8(first[i]);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_convert_sat_i32_i16(isa_level::avx2, &convert_sat_i32_i16_avx2);
+            register_convert_sat_i32_u8(isa_level::avx2, &convert_sat_i32_u8_avx2);
+            register_convert_sat_i16_i8(isa_level::avx2, &convert_sat_i16_i8_avx2);
+            register_convert_sat_i16_u8(isa_level::avx2, &convert_sat_i16_u8_avx2);
+            register_convert_u8_f32(isa_level::avx2, &convert_u8_f32_avx2);
+            register_convert_round_f32_i32(isa_level::avx2, &convert_round_f32_i32_avx2);
+            register_convert_round_f32_u8(isa_level::avx2, &convert_round_f32_u8_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
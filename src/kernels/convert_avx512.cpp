@@ -0,0 +1,157 @@
+// ── Opt-in AVX-512 conversion kernels (self-registering) ──────────────────────
+// AVX-512 has saturating down-converts, so no lane fix-up is needed:
+// vpmovsdw (int32 -> int16), vpmovswb (int16 -> int8, AVX512BW), and for the
+// unsigned targets vpmaxs* against 0 followed by the unsigned-saturating
+// vpmovusdb / vpmovuswb. uint8 -> float: vpmovzxbd + vcvtdq2ps. float -> int32
+// rounding: vcvtps2dq plus two masked moves (>= 2^31 -> INT32_MAX, NaN -> 0);
+// float -> uint8 clamps to [0, 255] before converting. Tails are one masked
+// load / store. The all-ones zero-masked forms of the conversions and min / max
+// dodge GCC 12's -Wmaybe-uninitialized on the unmasked intrinsics.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    inline __mmask16 tail16(std::size_t r) noexcept { return static_cast<__mmask16>((1u << r) - 1u); }
+    inline __mmask32 tail32(std::size_t r) noexcept { return static_cast<__mmask32>((std::uint64_t{1} << r) - 1u); }
+
+    void convert_sat_i32_i16_avx512(const std::int32_t* first, std::size_t n, std::int16_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m512i v = _mm512_loadu_si512(first + i);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm512_maskz_cvtsepi32_epi16(0xFFFF, v));
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm512_mask_cvtsepi32_storeu_epi16(out + body, m, _mm512_maskz_loadu_epi32(m, first + body));
+        }
+    }
+
+    void convert_sat_i32_u8_avx512(const std::int32_t* first, std::size_t n, std::uint8_t* out) noexcept
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m512i v = _mm512_maskz_max_epi32(0xFFFF, _mm512_loadu_si512(first + i), zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm512_maskz_cvtusepi32_epi8(0xFFFF, v));
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            const __m512i v = _mm512_maskz_max_epi32(0xFFFF, _mm512_maskz_loadu_epi32(m, first + body), zero);
+            _mm512_mask_cvtusepi32_storeu_epi8(out + body, m, v);
+        }
+    }
+
+    void convert_sat_i16_i8_avx512(const std::int16_t* first, std::size_t n, std::int8_t* out) noexcept
+    {
+        const std::size_t body = n - n % 32;
+        for (std::size_t i = 0; i < body; i += 32)
+        {
+            const __m512i v = _mm512_loadu_si512(first + i);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm512_maskz_cvtsepi16_epi8(0xFFFFFFFFu, v));
+        }
+        if (body < n)
+        {
+            const __mmask32 m = tail32(n - body);
+            _mm512_mask_cvtsepi16_storeu_epi8(out + body, m, _mm512_maskz_loadu_epi16(m, first + body));
+        }
+    }
+
+    void convert_sat_i16_u8_avx512(const std::int16_t* first, std::size_t n, std::uint8_t* out) noexcept
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const std::size_t body = n - n % 32;
+        for (std::size_t i = 0; i < body; i += 32)
+        {
+            const __m512i v = _mm512_maskz_max_epi16(0xFFFFFFFFu, _mm512_loadu_si512(first + i), zero);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm512_maskz_cvtusepi16_epi8(0xFFFFFFFFu, v));
+        }
+        if (body < n)
+        {
+            const __mmask32 m = tail32(n - body);
+            const __m512i v = _mm512_maskz_max_epi16(0xFFFFFFFFu, _mm512_maskz_loadu_epi16(m, first + body), zero);
+            _mm512_mask_cvtusepi16_storeu_epi8(out + body, m, v);
+        }
+    }
+
+    void convert_u8_f32_avx512(const std::uint8_t* first, std::size_t n, float* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+            _mm512_storeu_ps(out + i, _mm512_maskz_cvtepi32_ps(0xFFFF, _mm512_maskz_cvtepu8_epi32(0xFFFF, x)));
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            const __m128i x = _mm_maskz_loadu_epi8(m, first + body);
+            _mm512_mask_storeu_ps(out + body, m, _mm512_maskz_cvtepi32_ps(0xFFFF, _mm512_maskz_cvtepu8_epi32(0xFFFF, x)));
+        }
+    }
+
+    inline __m512i round_i32(__m512 x) noexcept
+    {
+        __m512i r = _mm512_maskz_cvtps_epi32(0xFFFF, x);
+        r = _mm512_mask_mov_epi32(r, _mm512_cmp_ps_mask(x, _mm512_set1_ps(2147483648.0f), _CMP_GE_OQ),
+                                  _mm512_set1_epi32(0x7FFFFFFF));
+        return _mm512_maskz_mov_epi32(_mm512_cmp_ps_mask(x, x, _CMP_ORD_Q), r);
+    }
+
+    void convert_round_f32_i32_avx512(const float* first, std::size_t n, std::int32_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16) _mm512_storeu_si512(out + i, round_i32(_mm512_loadu_ps(first + i)));
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm512_mask_storeu_epi32(out + body, m, round_i32(_mm512_maskz_loadu_ps(m, first + body)));
+        }
+    }
+
+    inline __m512i round_u8_lanes(__m512 x) noexcept
+    {
+        // vmaxps returns its second operand (0) when x is NaN.
+        x = _mm512_maskz_min_ps(0xFFFF, _mm512_maskz_max_ps(0xFFFF, x, _mm512_setzero_ps()), _mm512_set1_ps(255.0f));
+        return _mm512_maskz_cvtps_epi32(0xFFFF, x);
+    }
+
+    void convert_round_f32_u8_avx512(const float* first, std::size_t n, std::uint8_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m512i v = round_u8_lanes(_mm512_loadu_ps(first + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm512_maskz_cvtusepi32_epi8(0xFFFF, v));
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm512_mask_cvtusepi32_storeu_epi8(out + body, m, round_u8_lanes(_mm512_maskz_loadu_ps(m, first + body)));
+        }
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_convert_sat_i32_i16(isa_level::avx512, &convert_sat_i32_i16_avx512);
+            register_convert_sat_i32_u8(isa_level::avx512, &convert_sat_i32_u8_avx512);
+            register_convert_sat_i16_i8(isa_level::avx512, &convert_sat_i16_i8_avx512);
+            register_convert_sat_i16_u8(isa_level::avx512, &convert_sat_i16_u8_avx512);
+            register_convert_u8_f32(isa_level::avx512, &convert_u8_f32_avx512);
+            register_convert_round_f32_i32(isa_level::avx512, &convert_round_f32_i32_avx512);
+            register_convert_round_f32_u8(isa_level::avx512, &convert_round_f32_u8_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -3,6 +3,35 @@
 //   remove_i16 : 8 shorts/iter, pshufb left-pack via a 256-entry word LUT.
 //   remove_i8  : 16 bytes/iter, two 8-byte pshufb left-packs via a 256-entry byte LUT.
 //   reverse_i32: reverse 8-lane blocks from both ends (vpermd) + scalar middle.
+//   unique_i*  : compare each register with itself shifted one lane (the previous
+//                register's last lane carried in — never re-read from memory, which
+//                the full-width stores may already have overwritten) and left-pack
+//                the lanes that differ with the same LUTs.
+//   expand_i32/64: inverse LUT (lane j <- rank of j among the set bits) + vpermd,
+//                then blend with the passthrough rows. Full dense loads are used
+//                only while 8 (4) elements remain, else vpmaskmov — never over-read.
+//   rle_encode_i*: unique's compare against the load one element back (the input
+//                is const, so no carried register); the predecessors of the
+//                differing lanes are left-packed with the same LUTs and their
+//                indices come straight from perm_lut[m] + base, 8 at a time.
+//   rle_decode_i*: vpbroadcast + full-width stores per run, overhanging into the
+//                next run while inside the output; the last runs fill exactly.
+//   compress_bits_i32/64: remove_i32's (unique_i64's) left-pack with the keep mask
+//                read from a row bitmap, one byte (nibble) per 8 (4) lanes;
+//                all-set words copy straight through.
+//   bitmap_to_indices: perm_lut[b] lists the set positions of byte b; adding the
+//                byte's base row gives 8 indices per store, of which popcnt(b)
+//                stick. Zero words and zero bytes are skipped.
+//   filter_<T>: copy_if / remove_if / count_if for the predicates.hpp vocabulary
+//                over every 1/2/4/8-byte integer and float / double. Up to 1024
+//                rows at a time are first compared into a row bitmap (vpcmpeq /
+//                vpcmpgt with the sign bit flipped for unsigned, vcmpps / vcmppd
+//                with ordered predicates for floats; int16 masks packed to bytes
+//                first), so the chunk's kept count is known up front. Each 64-row
+//                word is then left-packed with the same LUTs in whole-register
+//                stores while at least 64 kept rows of the chunk remain, and by a
+//                countr_zero loop after that — nothing past out[count) is written,
+//                which copy_if's contract needs.
 // In-place compaction is safe because the write cursor k never overtakes the read
 // cursor i (k <= i  =>  every store stays within [.., i+chunk)).
 #include "simdtl/platform/dispatch.hpp"
@@ -11,8 +40,10 @@
 #if defined(_MSC_VER)
 #  include <intrin.h>   // __popcnt
 #endif
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace
 {
@@ -25,12 +56,27 @@ namespace
 #endif
     }
 
+    inline unsigned popcnt64(std::uint64_t m) noexcept
+    {
+#if defined(_MSC_VER)
+        return static_cast<unsigned>(__popcnt64(m));
+#else
+        return static_cast<unsigned>(__builtin_popcountll(m));
+#endif
+    }
+
     // perm_lut[m][t] = index of the t-th set bit of m (rest zero) -> vpermd control.
     alignas(32) std::uint32_t perm_lut[256][8];
     // byte_lut[m]  : pshufb control compacting the kept bytes of an 8-bit group (low 8).
     alignas(16) std::uint8_t  byte_lut[256][16];
     // short_lut[m] : pshufb control compacting the kept shorts of an 8-short group.
     alignas(16) std::uint8_t  short_lut[256][16];
+    // quad_lut[m]  : vpermd control compacting the kept 64-bit lanes of a 4-lane group.
+    alignas(32) std::uint32_t quad_lut[16][8];
+    // expand_lut[m] / expand_quad_lut[m]: vpermd control sending the r-th dense
+    // element to the lane holding the r-th set bit of m (other lanes don't care).
+    alignas(32) std::uint32_t expand_lut[256][8];
+    alignas(32) std::uint32_t expand_quad_lut[16][8];
 
     void build_luts() noexcept
     {
@@ -52,6 +98,39 @@ namespace
                                     short_lut[m][ks++] = static_cast<std::uint8_t>(2 * b + 1); }
             for (; ks < 16; ++ks) short_lut[m][ks] = 0x80;
         }
+        for (int m = 0; m < 16; ++m)
+        {
+            int t = 0;
+            for (int b = 0; b < 4; ++b)
+                if (m & (1 << b)) { quad_lut[m][t++] = static_cast<std::uint32_t>(2 * b);
+                                    quad_lut[m][t++] = static_cast<std::uint32_t>(2 * b + 1); }
+            for (; t < 8; ++t) quad_lut[m][t] = 0;
+        }
+        for (int m = 0; m < 256; ++m)
+        {
+            std::uint32_t r = 0;
+            for (int b = 0; b < 8; ++b)
+                expand_lut[m][b] = (m & (1 << b)) ? r++ : 0;
+        }
+        for (int m = 0; m < 16; ++m)
+        {
+            std::uint32_t r = 0;
+            for (int b = 0; b < 4; ++b)
+            {
+                const std::uint32_t src = (m & (1 << b)) ? r++ : 0;
+                expand_quad_lut[m][2 * b]     = 2 * src;
+                expand_quad_lut[m][2 * b + 1] = 2 * src + 1;
+            }
+        }
+    }
+
+    // Selected rows among the first n of a bitmap.
+    std::size_t count_bits(const std::uint64_t* bits, std::size_t n) noexcept
+    {
+        std::size_t total = 0, w = 0;
+        for (; (w + 1) * 64 <= n; ++w) total += popcnt64(bits[w]);
+        if (n % 64) total += popcnt64(bits[w] & ((std::uint64_t{1} << (n % 64)) - 1));
+        return total;
     }
 
     std::size_t remove_i8_avx2(std::int8_t* a, std::size_t n, std::int8_t value) noexcept
@@ -134,6 +213,644 @@ namespace
         }
     }
 
+    std::size_t unique_i8_avx2(std::int8_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        __m128i prev = _mm_set1_epi8(a[0]);   // lane 15 = predecessor of a[1]
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i shifted = _mm_alignr_epi8(v, prev, 15);   // [prev15, v0..v14]
+            const unsigned keep = (~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, shifted)))) & 0xFFFFu;
+            const unsigned lo = keep & 0xFFu, hi = (keep >> 8) & 0xFFu;
+            const __m128i clo = _mm_shuffle_epi8(v, _mm_load_si128(reinterpret_cast<const __m128i*>(byte_lut[lo])));
+            const __m128i chi = _mm_shuffle_epi8(_mm_srli_si128(v, 8), _mm_load_si128(reinterpret_cast<const __m128i*>(byte_lut[hi])));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(a + k), clo); k += popcnt(lo);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(a + k), chi); k += popcnt(hi);
+            prev = v;
+        }
+        std::int8_t last = static_cast<std::int8_t>(_mm_extract_epi8(prev, 15));
+        for (; i < n; ++i)
+        {
+            const std::int8_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    std::size_t unique_i16_avx2(std::int16_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        __m128i prev = _mm_set1_epi16(a[0]);
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i eq = _mm_cmpeq_epi16(v, _mm_alignr_epi8(v, prev, 14));
+            const unsigned keep = (~static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(eq, eq)))) & 0xFFu;
+            const __m128i c = _mm_shuffle_epi8(v, _mm_load_si128(reinterpret_cast<const __m128i*>(short_lut[keep])));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(a + k), c);
+            k += popcnt(keep);
+            prev = v;
+        }
+        std::int16_t last = static_cast<std::int16_t>(_mm_extract_epi16(prev, 7));
+        for (; i < n; ++i)
+        {
+            const std::int16_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    std::size_t unique_i32_avx2(std::int32_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        __m256i prev = _mm256_set1_epi32(a[0]);
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            // [prev7, v0..v6]: bring prev's high half next to v's low half, then alignr.
+            const __m256i shifted = _mm256_alignr_epi8(v, _mm256_permute2x128_si256(prev, v, 0x21), 12);
+            const __m256i eq = _mm256_cmpeq_epi32(v, shifted);
+            const unsigned keep = (~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)))) & 0xFFu;
+            const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(perm_lut[keep]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + k), _mm256_permutevar8x32_epi32(v, idx));
+            k += popcnt(keep);
+            prev = v;
+        }
+        std::int32_t last = _mm256_extract_epi32(prev, 7);
+        for (; i < n; ++i)
+        {
+            const std::int32_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    std::size_t unique_i64_avx2(std::int64_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        __m256i prev = _mm256_set1_epi64x(a[0]);
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const __m256i shifted = _mm256_alignr_epi8(v, _mm256_permute2x128_si256(prev, v, 0x21), 8);
+            const __m256i eq = _mm256_cmpeq_epi64(v, shifted);
+            const unsigned keep = (~static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)))) & 0xFu;
+            const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(quad_lut[keep]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + k), _mm256_permutevar8x32_epi32(v, idx));
+            k += popcnt(keep);
+            prev = v;
+        }
+        std::int64_t last = _mm256_extract_epi64(prev, 3);
+        for (; i < n; ++i)
+        {
+            const std::int64_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    std::size_t expand_i32_avx2(const std::int32_t* first, std::size_t n, const std::uint64_t* bits,
+                                const std::int32_t* dense, std::int32_t* out) noexcept
+    {
+        const std::size_t total = count_bits(bits, n);
+        const __m256i lane_bit = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        std::size_t i = 0, k = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const unsigned m = static_cast<unsigned>(bits[i / 64] >> (i % 64)) & 0xFFu;
+            const unsigned c = popcnt(m);
+            const __m256i d = (k + 8 <= total)
+                ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dense + k))
+                : _mm256_maskload_epi32(reinterpret_cast<const int*>(dense + k),
+                                        _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(c)), iota));
+            const __m256i e   = _mm256_permutevar8x32_epi32(d, _mm256_load_si256(reinterpret_cast<const __m256i*>(expand_lut[m])));
+            const __m256i sel = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(m)), lane_bit), lane_bit);
+            const __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blendv_epi8(src, e, sel));
+            k += c;
+        }
+        for (; i < n; ++i)
+            out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+        return k;
+    }
+
+    std::size_t expand_i64_avx2(const std::int64_t* first, std::size_t n, const std::uint64_t* bits,
+                                const std::int64_t* dense, std::int64_t* out) noexcept
+    {
+        const std::size_t total = count_bits(bits, n);
+        const __m256i lane_bit = _mm256_setr_epi64x(1, 2, 4, 8);
+        const __m256i iota = _mm256_setr_epi64x(0, 1, 2, 3);
+        std::size_t i = 0, k = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const unsigned m = static_cast<unsigned>(bits[i / 64] >> (i % 64)) & 0xFu;
+            const unsigned c = popcnt(m);
+            const __m256i d = (k + 4 <= total)
+                ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dense + k))
+                : _mm256_maskload_epi64(reinterpret_cast<const long long*>(dense + k),
+                                        _mm256_cmpgt_epi64(_mm256_set1_epi64x(c), iota));
+            const __m256i e   = _mm256_permutevar8x32_epi32(d, _mm256_load_si256(reinterpret_cast<const __m256i*>(expand_quad_lut[m])));
+            const __m256i sel = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(m), lane_bit), lane_bit);
+            const __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blendv_epi8(src, e, sel));
+            k += c;
+        }
+        for (; i < n; ++i)
+            out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+        return k;
+    }
+
+    // Positions base + b of the set bits b of an 8-bit group (8 dwords stored;
+    // only popcnt(m) stick).
+    inline void put_ends8(std::uint32_t* ends, unsigned m, std::size_t base) noexcept
+    {
+        const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(perm_lut[m]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(ends),
+                            _mm256_add_epi32(idx, _mm256_set1_epi32(static_cast<int>(base))));
+    }
+
+    // Scalar tail shared by the rle encoders: boundaries in [i, n), then the last run.
+    template <class T>
+    std::size_t finish_runs(const T* a, std::size_t i, std::size_t n, T* values, std::uint32_t* ends, std::size_t k) noexcept
+    {
+        for (; i < n; ++i)
+            if (a[i] != a[i - 1]) { values[k] = a[i - 1]; ends[k++] = static_cast<std::uint32_t>(i); }
+        values[k] = a[n - 1];
+        ends[k++] = static_cast<std::uint32_t>(n);
+        return k;
+    }
+
+    std::size_t rle_encode_i8_avx2(const std::int8_t* a, std::size_t n, std::int8_t* values, std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 1));
+            const __m256i v    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const unsigned ne = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, prev)));
+            if (ne == 0) continue;
+            const __m128i half[2] = {_mm256_castsi256_si128(prev), _mm256_extracti128_si256(prev, 1)};
+            for (unsigned g = 0; g < 4; ++g)
+            {
+                const unsigned m = (ne >> (8 * g)) & 0xFFu;
+                if (m == 0) continue;
+                const __m128i src = (g & 1u) ? _mm_srli_si128(half[g / 2], 8) : half[g / 2];
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(values + k),
+                                 _mm_shuffle_epi8(src, _mm_load_si128(reinterpret_cast<const __m128i*>(byte_lut[m]))));
+                put_ends8(ends + k, m, i + 8 * g);
+                k += popcnt(m);
+            }
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    std::size_t rle_encode_i16_avx2(const std::int16_t* a, std::size_t n, std::int16_t* values, std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 1));
+            const __m256i eq   = _mm256_cmpeq_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), prev);
+            // 16 shorts -> 16 bytes (0xFF/0x00), then one bit per short.
+            const __m128i eq8 = _mm_packs_epi16(_mm256_castsi256_si128(eq), _mm256_extracti128_si256(eq, 1));
+            const unsigned ne = (~static_cast<unsigned>(_mm_movemask_epi8(eq8))) & 0xFFFFu;
+            if (ne == 0) continue;
+            const __m128i half[2] = {_mm256_castsi256_si128(prev), _mm256_extracti128_si256(prev, 1)};
+            for (unsigned g = 0; g < 2; ++g)
+            {
+                const unsigned m = (ne >> (8 * g)) & 0xFFu;
+                if (m == 0) continue;
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(values + k),
+                                 _mm_shuffle_epi8(half[g], _mm_load_si128(reinterpret_cast<const __m128i*>(short_lut[m]))));
+                put_ends8(ends + k, m, i + 8 * g);
+                k += popcnt(m);
+            }
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    std::size_t rle_encode_i32_avx2(const std::int32_t* a, std::size_t n, std::int32_t* values, std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 1));
+            const __m256i eq   = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), prev);
+            const unsigned ne = (~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)))) & 0xFFu;
+            if (ne == 0) continue;
+            const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(perm_lut[ne]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + k), _mm256_permutevar8x32_epi32(prev, idx));
+            put_ends8(ends + k, ne, i);
+            k += popcnt(ne);
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    std::size_t rle_encode_i64_avx2(const std::int64_t* a, std::size_t n, std::int64_t* values, std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 1));
+            const __m256i eq   = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), prev);
+            const unsigned ne = (~static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)))) & 0xFu;
+            if (ne == 0) continue;
+            const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(quad_lut[ne]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + k), _mm256_permutevar8x32_epi32(prev, idx));
+            const __m128i pos = _mm_load_si128(reinterpret_cast<const __m128i*>(perm_lut[ne]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(ends + k), _mm_add_epi32(pos, _mm_set1_epi32(static_cast<int>(i))));
+            k += popcnt(ne);
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    template <class T>
+    inline __m256i broadcast(T x) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>) return _mm256_castps_si256(_mm256_set1_ps(x));
+        else if constexpr (std::is_same_v<T, double>) return _mm256_castpd_si256(_mm256_set1_pd(x));
+        else if constexpr (sizeof(T) == 1) return _mm256_set1_epi8(static_cast<char>(x));
+        else if constexpr (sizeof(T) == 2) return _mm256_set1_epi16(static_cast<short>(x));
+        else if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(static_cast<int>(x));
+        else return _mm256_set1_epi64x(static_cast<long long>(x));
+    }
+
+    template <class T>
+    std::size_t rle_decode_avx2(const T* values, const std::uint32_t* lengths, std::size_t runs, std::size_t n, T* out) noexcept
+    {
+        constexpr std::size_t W = 32 / sizeof(T);
+        std::size_t p = 0, r = 0;
+        for (; r < runs && p + lengths[r] + W <= n; ++r)
+        {
+            const __m256i v = broadcast(values[r]);
+            const std::size_t len = lengths[r];
+            for (std::size_t j = 0; j < len; j += W) _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + p + j), v);
+            p += len;
+        }
+        for (; r < runs; ++r)
+            for (std::size_t e = p + lengths[r]; p < e; ++p) out[p] = values[r];
+        return p;
+    }
+
+    std::size_t compress_bits_i32_avx2(const std::int32_t* a, std::size_t words, const std::uint64_t* bits,
+                                       std::int32_t* out) noexcept
+    {
+        std::size_t k = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            const std::uint64_t x = bits[w];
+            const std::int32_t* src = a + w * 64;
+            if (x == ~std::uint64_t{0})
+            {
+                for (std::size_t j = 0; j < 64; j += 8)
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k + j),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + j)));
+                k += 64;
+                continue;
+            }
+            for (unsigned g = 0; g < 8 && x >> (8 * g) != 0; ++g)
+            {
+                const unsigned keep = static_cast<unsigned>(x >> (8 * g)) & 0xFFu;
+                const __m256i v    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 8 * g));
+                const __m256i idx  = _mm256_load_si256(reinterpret_cast<const __m256i*>(perm_lut[keep]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_permutevar8x32_epi32(v, idx));
+                k += popcnt(keep);
+            }
+        }
+        return k;
+    }
+
+    std::size_t compress_bits_i64_avx2(const std::int64_t* a, std::size_t words, const std::uint64_t* bits,
+                                       std::int64_t* out) noexcept
+    {
+        std::size_t k = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            const std::uint64_t x = bits[w];
+            const std::int64_t* src = a + w * 64;
+            if (x == ~std::uint64_t{0})
+            {
+                for (std::size_t j = 0; j < 64; j += 4)
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k + j),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + j)));
+                k += 64;
+                continue;
+            }
+            for (unsigned g = 0; g < 16 && x >> (4 * g) != 0; ++g)
+            {
+                const unsigned keep = static_cast<unsigned>(x >> (4 * g)) & 0xFu;
+                const __m256i v    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4 * g));
+                const __m256i idx  = _mm256_load_si256(reinterpret_cast<const __m256i*>(quad_lut[keep]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_permutevar8x32_epi32(v, idx));
+                k += popcnt(keep);
+            }
+        }
+        return k;
+    }
+
+    std::size_t bitmap_to_indices_avx2(const std::uint64_t* bits, std::size_t words, std::uint32_t base, std::uint32_t* out) noexcept
+    {
+        std::size_t k = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            const std::uint64_t x = bits[w];
+            if (x == 0) continue;
+            for (unsigned g = 0; g < 8; ++g)
+            {
+                const unsigned b = static_cast<unsigned>(x >> (8 * g)) & 0xFFu;
+                if (b == 0) continue;
+                const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(perm_lut[b]));
+                const __m256i row = _mm256_set1_epi32(static_cast<int>(base + w * 64 + 8 * g));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_add_epi32(idx, row));
+                k += popcnt(b);
+            }
+        }
+        return k;
+    }
+
+    // ---- filter_<T>: compare into a row bitmap, then left-pack ----------------
+
+    using simdtl::platform::cmp_op;
+    using simdtl::platform::filter_spec;
+
+    template <class T>
+    bool match(T x, const filter_spec<T>& s) noexcept
+    {
+        switch (s.op)
+        {
+        case cmp_op::eq: return x == s.lo;
+        case cmp_op::ne: return x != s.lo;
+        case cmp_op::lt: return x < s.lo;
+        case cmp_op::le: return x <= s.lo;
+        case cmp_op::gt: return x > s.lo;
+        case cmp_op::ge: return x >= s.lo;
+        case cmp_op::between: return s.lo <= x && x <= s.hi;
+        case cmp_op::in_set:
+            for (std::size_t j = 0; j < s.set_n; ++j)
+                if (x == s.set[j]) return true;
+            return false;
+        }
+        return false;
+    }
+
+    template <class T>
+    __m256i cmpeq(__m256i a, __m256i b) noexcept
+    {
+        if constexpr (sizeof(T) == 1) return _mm256_cmpeq_epi8(a, b);
+        else if constexpr (sizeof(T) == 2) return _mm256_cmpeq_epi16(a, b);
+        else if constexpr (sizeof(T) == 4) return _mm256_cmpeq_epi32(a, b);
+        else return _mm256_cmpeq_epi64(a, b);
+    }
+
+    // Signed a > b; unsigned operands arrive with the sign bit flipped.
+    template <class T>
+    __m256i cmpgt(__m256i a, __m256i b) noexcept
+    {
+        if constexpr (sizeof(T) == 1) return _mm256_cmpgt_epi8(a, b);
+        else if constexpr (sizeof(T) == 2) return _mm256_cmpgt_epi16(a, b);
+        else if constexpr (sizeof(T) == 4) return _mm256_cmpgt_epi32(a, b);
+        else return _mm256_cmpgt_epi64(a, b);
+    }
+
+    template <class T, int P>
+    __m256i cmpf(__m256i a, __m256i b) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), P));
+        else
+            return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), P));
+    }
+
+    template <class T>
+    struct consts
+    {
+        __m256i lo, hi;     // as given
+        __m256i lob, hib;   // sign-flipped for the unsigned ordered compares
+        __m256i flip;
+        const T* set;
+        std::size_t set_n;
+    };
+
+    // Integer ops that compute the complement (ne, le, ge, between) are flipped
+    // back on the finished bitmap words.
+    constexpr bool inverted(cmp_op op) noexcept
+    {
+        return op == cmp_op::ne || op == cmp_op::le || op == cmp_op::ge || op == cmp_op::between;
+    }
+
+    // One register of lanes: all-ones where Op holds (or, for integers, where
+    // its complement holds if inverted(Op)).
+    template <class T, cmp_op Op>
+    __m256i lanes(const T* p, const consts<T>& c) noexcept
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if constexpr (Op == cmp_op::eq) return cmpf<T, _CMP_EQ_OQ>(v, c.lo);
+            else if constexpr (Op == cmp_op::ne) return cmpf<T, _CMP_NEQ_UQ>(v, c.lo);
+            else if constexpr (Op == cmp_op::lt) return cmpf<T, _CMP_LT_OQ>(v, c.lo);
+            else if constexpr (Op == cmp_op::le) return cmpf<T, _CMP_LE_OQ>(v, c.lo);
+            else if constexpr (Op == cmp_op::gt) return cmpf<T, _CMP_GT_OQ>(v, c.lo);
+            else if constexpr (Op == cmp_op::ge) return cmpf<T, _CMP_GE_OQ>(v, c.lo);
+            else if constexpr (Op == cmp_op::between)
+                return _mm256_and_si256(cmpf<T, _CMP_GE_OQ>(v, c.lo), cmpf<T, _CMP_LE_OQ>(v, c.hi));
+            else
+            {
+                __m256i m = cmpf<T, _CMP_EQ_OQ>(v, broadcast(c.set[0]));
+                for (std::size_t j = 1; j < c.set_n; ++j) m = _mm256_or_si256(m, cmpf<T, _CMP_EQ_OQ>(v, broadcast(c.set[j])));
+                return m;
+            }
+        }
+        else
+        {
+            if constexpr (Op == cmp_op::eq || Op == cmp_op::ne) return cmpeq<T>(v, c.lo);
+            else if constexpr (Op == cmp_op::in_set)
+            {
+                __m256i m = cmpeq<T>(v, broadcast(c.set[0]));
+                for (std::size_t j = 1; j < c.set_n; ++j) m = _mm256_or_si256(m, cmpeq<T>(v, broadcast(c.set[j])));
+                return m;
+            }
+            else
+            {
+                const __m256i vb = std::is_unsigned_v<T> ? _mm256_xor_si256(v, c.flip) : v;
+                if constexpr (Op == cmp_op::lt || Op == cmp_op::ge) return cmpgt<T>(c.lob, vb);
+                else if constexpr (Op == cmp_op::gt || Op == cmp_op::le) return cmpgt<T>(vb, c.lob);
+                else return _mm256_or_si256(cmpgt<T>(c.lob, vb), cmpgt<T>(vb, c.hib));
+            }
+        }
+    }
+
+    // Row bitmap of 64 rows.
+    template <class T, cmp_op Op>
+    std::uint64_t word(const T* p, const consts<T>& c) noexcept
+    {
+        std::uint64_t w = 0;
+        if constexpr (sizeof(T) == 1)
+        {
+            for (std::size_t j = 0; j < 64; j += 32)
+                w |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(lanes<T, Op>(p + j, c)))} << j;
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            for (std::size_t j = 0; j < 64; j += 32)
+            {
+                const __m256i b = _mm256_packs_epi16(lanes<T, Op>(p + j, c), lanes<T, Op>(p + j + 16, c));
+                const __m256i ordered = _mm256_permute4x64_epi64(b, 0xD8);
+                w |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(ordered))} << j;
+            }
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            for (std::size_t j = 0; j < 64; j += 8)
+                w |= std::uint64_t{static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes<T, Op>(p + j, c))))} << j;
+        }
+        else
+        {
+            for (std::size_t j = 0; j < 64; j += 4)
+                w |= std::uint64_t{static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(lanes<T, Op>(p + j, c))))} << j;
+        }
+        return w;
+    }
+
+    template <class T, cmp_op Op>
+    std::size_t compare_words(const T* p, std::size_t words, const consts<T>& c, std::uint64_t flip,
+                              std::uint64_t* bits) noexcept
+    {
+        std::size_t kept = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            bits[w] = word<T, Op>(p + 64 * w, c) ^ flip;
+            kept += popcnt64(bits[w]);
+        }
+        return kept;
+    }
+
+    template <class T>
+    std::size_t compare_chunk(const T* p, std::size_t words, const filter_spec<T>& s, const consts<T>& c,
+                              std::uint64_t* bits) noexcept
+    {
+        const bool inv = !std::is_floating_point_v<T> && inverted(s.op);
+        const std::uint64_t flip = (inv != s.negate) ? ~std::uint64_t{0} : 0;
+        switch (s.op)
+        {
+        case cmp_op::eq: return compare_words<T, cmp_op::eq>(p, words, c, flip, bits);
+        case cmp_op::ne: return compare_words<T, cmp_op::ne>(p, words, c, flip, bits);
+        case cmp_op::lt: return compare_words<T, cmp_op::lt>(p, words, c, flip, bits);
+        case cmp_op::le: return compare_words<T, cmp_op::le>(p, words, c, flip, bits);
+        case cmp_op::gt: return compare_words<T, cmp_op::gt>(p, words, c, flip, bits);
+        case cmp_op::ge: return compare_words<T, cmp_op::ge>(p, words, c, flip, bits);
+        case cmp_op::between: return compare_words<T, cmp_op::between>(p, words, c, flip, bits);
+        case cmp_op::in_set: return compare_words<T, cmp_op::in_set>(p, words, c, flip, bits);
+        }
+        return 0;
+    }
+
+    // Left-pack the set rows of one 64-row word in whole-register stores; out
+    // needs room for 64.
+    template <class T>
+    std::size_t pack_word(const T* src, std::uint64_t m, T* out) noexcept
+    {
+        if (m == ~std::uint64_t{0})
+        {
+            for (std::size_t j = 0; j < 64 * sizeof(T); j += 32)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(reinterpret_cast<char*>(out) + j),
+                                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(reinterpret_cast<const char*>(src) + j)));
+            return 64;
+        }
+        std::size_t k = 0;
+        if constexpr (sizeof(T) == 8)
+        {
+            for (unsigned g = 0; g < 16 && (m >> (4 * g)) != 0; ++g)
+            {
+                const unsigned keep = static_cast<unsigned>(m >> (4 * g)) & 0xFu;
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4 * g));
+                const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(quad_lut[keep]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_permutevar8x32_epi32(v, idx));
+                k += popcnt(keep);
+            }
+        }
+        else
+        {
+            for (unsigned g = 0; g < 8 && (m >> (8 * g)) != 0; ++g)
+            {
+                const unsigned keep = static_cast<unsigned>(m >> (8 * g)) & 0xFFu;
+                if (keep == 0) continue;
+                if constexpr (sizeof(T) == 4)
+                {
+                    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 8 * g));
+                    const __m256i idx = _mm256_load_si256(reinterpret_cast<const __m256i*>(perm_lut[keep]));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_permutevar8x32_epi32(v, idx));
+                }
+                else if constexpr (sizeof(T) == 2)
+                {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8 * g));
+                    const __m128i c = _mm_shuffle_epi8(v, _mm_load_si128(reinterpret_cast<const __m128i*>(short_lut[keep])));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k), c);
+                }
+                else
+                {
+                    const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 8 * g));
+                    const __m128i c = _mm_shuffle_epi8(v, _mm_load_si128(reinterpret_cast<const __m128i*>(byte_lut[keep])));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + k), c);
+                }
+                k += popcnt(keep);
+            }
+        }
+        return k;
+    }
+
+    template <class T>
+    std::size_t filter_avx2(const T* a, std::size_t n, const filter_spec<T>& s, T* out) noexcept
+    {
+        consts<T> c{broadcast(s.lo), broadcast(s.hi), broadcast(s.lo), broadcast(s.hi),
+                    _mm256_setzero_si256(), s.set, s.set_n};
+        if constexpr (std::is_unsigned_v<T>)
+        {
+            c.flip = broadcast(static_cast<T>(T{1} << (8 * sizeof(T) - 1)));
+            c.lob = _mm256_xor_si256(c.lo, c.flip);
+            c.hib = _mm256_xor_si256(c.hi, c.flip);
+        }
+        std::uint64_t bits[16];
+        std::size_t i = 0, k = 0;
+        while (n - i >= 64)
+        {
+            const std::size_t words = (n - i) / 64 < 16 ? (n - i) / 64 : 16;
+            const std::size_t end = k + compare_chunk(a + i, words, s, c, bits);
+            if (out == nullptr) k = end;
+            else
+                for (std::size_t w = 0; w < words; ++w)
+                {
+                    const T* src = a + i + 64 * w;
+                    if (k + 64 <= end) k += pack_word(src, bits[w], out + k);
+                    else
+                        for (std::uint64_t x = bits[w]; x != 0; x &= x - 1)
+                            out[k++] = src[std::countr_zero(x)];
+                }
+            i += 64 * words;
+        }
+        for (; i < n; ++i)
+            if (match(a[i], s) != s.negate)
+            {
+                if (out != nullptr) out[k] = a[i];
+                ++k;
+            }
+        return k;
+    }
+
     struct registrar
     {
         registrar() noexcept
@@ -144,6 +861,33 @@ namespace
             register_remove_i16(isa_level::avx2, &remove_i16_avx2);
             register_remove_i32(isa_level::avx2, &remove_i32_avx2);
             register_reverse_i32(isa_level::avx2, &reverse_i32_avx2);
+            register_unique_i8 (isa_level::avx2, &unique_i8_avx2);
+            register_unique_i16(isa_level::avx2, &unique_i16_avx2);
+            register_unique_i32(isa_level::avx2, &unique_i32_avx2);
+            register_unique_i64(isa_level::avx2, &unique_i64_avx2);
+            register_expand_i32(isa_level::avx2, &expand_i32_avx2);
+            register_expand_i64(isa_level::avx2, &expand_i64_avx2);
+            register_rle_encode_i8 (isa_level::avx2, &rle_encode_i8_avx2);
+            register_rle_encode_i16(isa_level::avx2, &rle_encode_i16_avx2);
+            register_rle_encode_i32(isa_level::avx2, &rle_encode_i32_avx2);
+            register_rle_encode_i64(isa_level::avx2, &rle_encode_i64_avx2);
+            register_rle_decode_i8 (isa_level::avx2, &rle_decode_avx2<std::int8_t>);
+            register_rle_decode_i16(isa_level::avx2, &rle_decode_avx2<std::int16_t>);
+            register_rle_decode_i32(isa_level::avx2, &rle_decode_avx2<std::int32_t>);
+            register_rle_decode_i64(isa_level::avx2, &rle_decode_avx2<std::int64_t>);
+            register_compress_bits_i32(isa_level::avx2, &compress_bits_i32_avx2);
+            register_compress_bits_i64(isa_level::avx2, &compress_bits_i64_avx2);
+            register_bitmap_to_indices(isa_level::avx2, &bitmap_to_indices_avx2);
+            register_filter_i8 (isa_level::avx2, &filter_avx2<std::int8_t>);
+            register_filter_u8 (isa_level::avx2, &filter_avx2<std::uint8_t>);
+            register_filter_i16(isa_level::avx2, &filter_avx2<std::int16_t>);
+            register_filter_u16(isa_level::avx2, &filter_avx2<std::uint16_t>);
+            register_filter_i32(isa_level::avx2, &filter_avx2<std::int32_t>);
+            register_filter_u32(isa_level::avx2, &filter_avx2<std::uint32_t>);
+            register_filter_i64(isa_level::avx2, &filter_avx2<std::int64_t>);
+            register_filter_u64(isa_level::avx2, &filter_avx2<std::uint64_t>);
+            register_filter_f32(isa_level::avx2, &filter_avx2<float>);
+            register_filter_f64(isa_level::avx2, &filter_avx2<double>);
         }
     };
     const registrar g_registrar{};
@@ -0,0 +1,434 @@
+// ── Opt-in AVX-512 cross-lane kernels (self-registering; only stick on avx512) ─
+// Compaction here is compress-to-REGISTER (vpcompress{d,q,b,w} with a zeroing
+// mask) + a plain full-width storeu + popcount advance — never the memory form
+// vpcompress* [mem], which microcodes to ~40x slower on Zen4. In place that full
+// store is safe for the same reason as in the AVX2 kernels: the write cursor k
+// never passes the read cursor i.
+//   unique_i32/i64 : vpermt2{d,q} shifts the previous register's last lane in
+//                    (same cost as valign, which trips a GCC 12 -Wmaybe-uninitialized).
+//   unique_i8/i16  : vpermt2q + vpalignr do the same byte/word shift; the
+//                    byte/word compress needs AVX512_VBMI2, probed separately.
+// The scalar tail's predecessor is read from memory BEFORE the last store that
+// could overwrite it.
+//   expand_i*      : vpexpand{b,w,d,q} from a zero-masked prefix load of the dense
+//                    input (masked lanes never fault, so no over-read) merged into
+//                    the passthrough rows.
+//   rle_encode_i*  : compare with the load one element back; the predecessors of
+//                    the differing lanes and their indices (iota + i, 16 dwords
+//                    per group) are compressed side by side. i8/i16 need VBMI2.
+//   rle_decode_i*  : vpbroadcast + 64-byte stores per run, overhanging while
+//                    inside the output; the last runs end in one masked store.
+//   compress_bits_i32/64: vpcompressd (q) per 16 (8) rows with the mask taken
+//                    straight from the row bitmap.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#  include <intrin.h>   // __popcnt, __popcnt64
+#endif
+#include <cstddef>
+#include <cstdint>
+
+// MSVC exposes every intrinsic regardless of /arch; GCC/Clang need the VBMI2
+// functions tagged, since the TU itself is built for the avx512 tier only.
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_VBMI2 __attribute__((target("avx512vbmi2")))
+#else
+#  define SIMDTL_TARGET_VBMI2
+#endif
+
+namespace
+{
+    inline unsigned popcnt(unsigned m) noexcept
+    {
+#if defined(_MSC_VER)
+        return __popcnt(m);
+#else
+        return static_cast<unsigned>(__builtin_popcount(m));
+#endif
+    }
+
+    inline unsigned popcnt64(std::uint64_t m) noexcept
+    {
+#if defined(_MSC_VER)
+        return static_cast<unsigned>(__popcnt64(m));
+#else
+        return static_cast<unsigned>(__builtin_popcountll(m));
+#endif
+    }
+
+    // [prev's last 128-bit lane, v's lanes 0..2]: the companion vpalignr needs to
+    // shift one byte/word across 128-bit lane boundaries.
+    inline __m512i carry_lanes(__m512i v, __m512i prev) noexcept
+    {
+        return _mm512_permutex2var_epi64(prev, _mm512_setr_epi64(6, 7, 8, 9, 10, 11, 12, 13), v);
+    }
+
+    SIMDTL_TARGET_VBMI2 std::size_t unique_i8_avx512(std::int8_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        __m512i prev = _mm512_set1_epi8(a[0]);
+        std::int8_t last = a[0];
+        for (; i + 64 <= n; i += 64)
+        {
+            const __m512i v = _mm512_loadu_si512(a + i);
+            last = a[i + 63];
+            const __m512i shifted = _mm512_alignr_epi8(v, carry_lanes(v, prev), 15);
+            const __mmask64 keep = _mm512_cmpneq_epi8_mask(v, shifted);
+            _mm512_storeu_si512(a + k, _mm512_maskz_compress_epi8(keep, v));
+            k += popcnt64(keep);
+            prev = v;
+        }
+        for (; i < n; ++i)
+        {
+            const std::int8_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    SIMDTL_TARGET_VBMI2 std::size_t unique_i16_avx512(std::int16_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        __m512i prev = _mm512_set1_epi16(a[0]);
+        std::int16_t last = a[0];
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m512i v = _mm512_loadu_si512(a + i);
+            last = a[i + 31];
+            const __m512i shifted = _mm512_alignr_epi8(v, carry_lanes(v, prev), 14);
+            const __mmask32 keep = _mm512_cmpneq_epi16_mask(v, shifted);
+            _mm512_storeu_si512(a + k, _mm512_maskz_compress_epi16(keep, v));
+            k += popcnt(keep);
+            prev = v;
+        }
+        for (; i < n; ++i)
+        {
+            const std::int16_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    std::size_t unique_i32_avx512(std::int32_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        const __m512i shift1_d = _mm512_setr_epi32(15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30);
+        __m512i prev = _mm512_set1_epi32(a[0]);
+        std::int32_t last = a[0];
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m512i v = _mm512_loadu_si512(a + i);
+            last = a[i + 15];
+            const __mmask16 keep = _mm512_cmpneq_epi32_mask(v, _mm512_permutex2var_epi32(prev, shift1_d, v));
+            _mm512_storeu_si512(a + k, _mm512_maskz_compress_epi32(keep, v));
+            k += popcnt(keep);
+            prev = v;
+        }
+        for (; i < n; ++i)
+        {
+            const std::int32_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    std::size_t unique_i64_avx512(std::int64_t* a, std::size_t n) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 1;
+        const __m512i shift1_q = _mm512_setr_epi64(7, 8, 9, 10, 11, 12, 13, 14);
+        __m512i prev = _mm512_set1_epi64(a[0]);
+        std::int64_t last = a[0];
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m512i v = _mm512_loadu_si512(a + i);
+            last = a[i + 7];
+            const __mmask8 keep = _mm512_cmpneq_epi64_mask(v, _mm512_permutex2var_epi64(prev, shift1_q, v));
+            _mm512_storeu_si512(a + k, _mm512_maskz_compress_epi64(keep, v));
+            k += popcnt(keep);
+            prev = v;
+        }
+        for (; i < n; ++i)
+        {
+            const std::int64_t cur = a[i];
+            if (cur != last) a[k++] = cur;
+            last = cur;
+        }
+        return k;
+    }
+
+    inline std::uint64_t prefix(unsigned c) noexcept { return _bzhi_u64(~std::uint64_t{0}, c); }
+
+    SIMDTL_TARGET_VBMI2 std::size_t expand_i8_avx512(const std::int8_t* first, std::size_t n, const std::uint64_t* bits,
+                                                     const std::int8_t* dense, std::int8_t* out) noexcept
+    {
+        std::size_t i = 0, k = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            const std::uint64_t m = bits[i / 64];
+            const unsigned c = popcnt64(m);
+            const __m512i d = _mm512_maskz_loadu_epi8(prefix(c), dense + k);
+            _mm512_storeu_si512(out + i, _mm512_mask_expand_epi8(_mm512_loadu_si512(first + i), m, d));
+            k += c;
+        }
+        for (; i < n; ++i)
+            out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+        return k;
+    }
+
+    SIMDTL_TARGET_VBMI2 std::size_t expand_i16_avx512(const std::int16_t* first, std::size_t n, const std::uint64_t* bits,
+                                                      const std::int16_t* dense, std::int16_t* out) noexcept
+    {
+        std::size_t i = 0, k = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            const __mmask32 m = static_cast<__mmask32>(bits[i / 64] >> (i % 64));
+            const unsigned c = popcnt(m);
+            const __m512i d = _mm512_maskz_loadu_epi16(static_cast<__mmask32>(prefix(c)), dense + k);
+            _mm512_storeu_si512(out + i, _mm512_mask_expand_epi16(_mm512_loadu_si512(first + i), m, d));
+            k += c;
+        }
+        for (; i < n; ++i)
+            out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+        return k;
+    }
+
+    std::size_t expand_i32_avx512(const std::int32_t* first, std::size_t n, const std::uint64_t* bits,
+                                  const std::int32_t* dense, std::int32_t* out) noexcept
+    {
+        std::size_t i = 0, k = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            const __mmask16 m = static_cast<__mmask16>(bits[i / 64] >> (i % 64));
+            const unsigned c = popcnt(m);
+            const __m512i d = _mm512_maskz_loadu_epi32(static_cast<__mmask16>(prefix(c)), dense + k);
+            _mm512_storeu_si512(out + i, _mm512_mask_expand_epi32(_mm512_loadu_si512(first + i), m, d));
+            k += c;
+        }
+        for (; i < n; ++i)
+            out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+        return k;
+    }
+
+    std::size_t expand_i64_avx512(const std::int64_t* first, std::size_t n, const std::uint64_t* bits,
+                                  const std::int64_t* dense, std::int64_t* out) noexcept
+    {
+        std::size_t i = 0, k = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const __mmask8 m = static_cast<__mmask8>(bits[i / 64] >> (i % 64));
+            const unsigned c = popcnt(m);
+            const __m512i d = _mm512_maskz_loadu_epi64(static_cast<__mmask8>(prefix(c)), dense + k);
+            _mm512_storeu_si512(out + i, _mm512_mask_expand_epi64(_mm512_loadu_si512(first + i), m, d));
+            k += c;
+        }
+        for (; i < n; ++i)
+            out[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+        return k;
+    }
+
+    // Positions base + b of the set bits b of a 16-lane group.
+    inline unsigned put_ends16(std::uint32_t* ends, __mmask16 m, std::size_t base) noexcept
+    {
+        const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const __m512i pos  = _mm512_add_epi32(iota, _mm512_set1_epi32(static_cast<int>(base)));
+        _mm512_storeu_si512(ends, _mm512_maskz_compress_epi32(m, pos));
+        return popcnt(m);
+    }
+
+    template <class T>
+    std::size_t finish_runs(const T* a, std::size_t i, std::size_t n, T* values, std::uint32_t* ends, std::size_t k) noexcept
+    {
+        for (; i < n; ++i)
+            if (a[i] != a[i - 1]) { values[k] = a[i - 1]; ends[k++] = static_cast<std::uint32_t>(i); }
+        values[k] = a[n - 1];
+        ends[k++] = static_cast<std::uint32_t>(n);
+        return k;
+    }
+
+    SIMDTL_TARGET_VBMI2 std::size_t rle_encode_i8_avx512(const std::int8_t* a, std::size_t n, std::int8_t* values,
+                                                         std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            const __m512i prev = _mm512_loadu_si512(a + i - 1);
+            const __mmask64 ne = _mm512_cmpneq_epi8_mask(_mm512_loadu_si512(a + i), prev);
+            if (ne == 0) continue;
+            _mm512_storeu_si512(values + k, _mm512_maskz_compress_epi8(ne, prev));
+            std::size_t e = k;
+            for (unsigned g = 0; g < 4; ++g)
+                e += put_ends16(ends + e, static_cast<__mmask16>(ne >> (16 * g)), i + 16 * g);
+            k = e;
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    SIMDTL_TARGET_VBMI2 std::size_t rle_encode_i16_avx512(const std::int16_t* a, std::size_t n, std::int16_t* values,
+                                                          std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m512i prev = _mm512_loadu_si512(a + i - 1);
+            const __mmask32 ne = _mm512_cmpneq_epi16_mask(_mm512_loadu_si512(a + i), prev);
+            if (ne == 0) continue;
+            _mm512_storeu_si512(values + k, _mm512_maskz_compress_epi16(ne, prev));
+            k += put_ends16(ends + k, static_cast<__mmask16>(ne), i);
+            k += put_ends16(ends + k, static_cast<__mmask16>(ne >> 16), i + 16);
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    std::size_t rle_encode_i32_avx512(const std::int32_t* a, std::size_t n, std::int32_t* values, std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t i = 1, k = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m512i prev = _mm512_loadu_si512(a + i - 1);
+            const __mmask16 ne = _mm512_cmpneq_epi32_mask(_mm512_loadu_si512(a + i), prev);
+            if (ne == 0) continue;
+            _mm512_storeu_si512(values + k, _mm512_maskz_compress_epi32(ne, prev));
+            k += put_ends16(ends + k, ne, i);
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    std::size_t rle_encode_i64_avx512(const std::int64_t* a, std::size_t n, std::int64_t* values, std::uint32_t* ends) noexcept
+    {
+        if (n == 0) return 0;
+        const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        std::size_t i = 1, k = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m512i prev = _mm512_loadu_si512(a + i - 1);
+            const __mmask8 ne = _mm512_cmpneq_epi64_mask(_mm512_loadu_si512(a + i), prev);
+            if (ne == 0) continue;
+            _mm512_storeu_si512(values + k, _mm512_maskz_compress_epi64(ne, prev));
+            const __m256i pos = _mm256_add_epi32(iota, _mm256_set1_epi32(static_cast<int>(i)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(ends + k), _mm256_maskz_compress_epi32(ne, pos));
+            k += popcnt(ne);
+        }
+        return finish_runs(a, i, n, values, ends, k);
+    }
+
+    template <class T>
+    inline __m512i broadcast(T x) noexcept
+    {
+        if constexpr (sizeof(T) == 1) return _mm512_set1_epi8(x);
+        else if constexpr (sizeof(T) == 2) return _mm512_set1_epi16(x);
+        else if constexpr (sizeof(T) == 4) return _mm512_set1_epi32(x);
+        else return _mm512_set1_epi64(x);
+    }
+
+    // The first c (< 64 / sizeof(T)) lanes of v.
+    template <class T>
+    inline void store_prefix(T* p, std::size_t c, __m512i v) noexcept
+    {
+        const std::uint64_t m = prefix(static_cast<unsigned>(c));
+        if constexpr (sizeof(T) == 1) _mm512_mask_storeu_epi8(p, static_cast<__mmask64>(m), v);
+        else if constexpr (sizeof(T) == 2) _mm512_mask_storeu_epi16(p, static_cast<__mmask32>(m), v);
+        else if constexpr (sizeof(T) == 4) _mm512_mask_storeu_epi32(p, static_cast<__mmask16>(m), v);
+        else _mm512_mask_storeu_epi64(p, static_cast<__mmask8>(m), v);
+    }
+
+    template <class T>
+    std::size_t rle_decode_avx512(const T* values, const std::uint32_t* lengths, std::size_t runs, std::size_t n, T* out) noexcept
+    {
+        constexpr std::size_t W = 64 / sizeof(T);
+        std::size_t p = 0, r = 0;
+        for (; r < runs && p + lengths[r] + W <= n; ++r)
+        {
+            const __m512i v = broadcast(values[r]);
+            const std::size_t len = lengths[r];
+            for (std::size_t j = 0; j < len; j += W) _mm512_storeu_si512(out + p + j, v);
+            p += len;
+        }
+        for (; r < runs; ++r)
+        {
+            const __m512i v = broadcast(values[r]);
+            const std::size_t len = lengths[r];
+            std::size_t j = 0;
+            for (; j + W <= len; j += W) _mm512_storeu_si512(out + p + j, v);
+            if (j < len) store_prefix(out + p + j, len - j, v);
+            p += len;
+        }
+        return p;
+    }
+
+    std::size_t compress_bits_i32_avx512(const std::int32_t* a, std::size_t words, const std::uint64_t* bits,
+                                         std::int32_t* out) noexcept
+    {
+        std::size_t k = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            const std::uint64_t x = bits[w];
+            for (unsigned q = 0; q < 4 && x >> (16 * q) != 0; ++q)
+            {
+                const __mmask16 keep = static_cast<__mmask16>(x >> (16 * q));
+                const __m512i v = _mm512_loadu_si512(a + w * 64 + 16 * q);
+                _mm512_storeu_si512(out + k, _mm512_maskz_compress_epi32(keep, v));
+                k += popcnt(keep);
+            }
+        }
+        return k;
+    }
+
+    std::size_t compress_bits_i64_avx512(const std::int64_t* a, std::size_t words, const std::uint64_t* bits,
+                                         std::int64_t* out) noexcept
+    {
+        std::size_t k = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            const std::uint64_t x = bits[w];
+            for (unsigned q = 0; q < 8 && x >> (8 * q) != 0; ++q)
+            {
+                const __mmask8 keep = static_cast<__mmask8>(x >> (8 * q));
+                const __m512i v = _mm512_loadu_si512(a + w * 64 + 8 * q);
+                _mm512_storeu_si512(out + k, _mm512_maskz_compress_epi64(keep, v));
+                k += popcnt(keep);
+            }
+        }
+        return k;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_unique_i32(isa_level::avx512, &unique_i32_avx512);
+            register_unique_i64(isa_level::avx512, &unique_i64_avx512);
+            register_expand_i32(isa_level::avx512, &expand_i32_avx512);
+            register_expand_i64(isa_level::avx512, &expand_i64_avx512);
+            register_rle_encode_i32(isa_level::avx512, &rle_encode_i32_avx512);
+            register_rle_encode_i64(isa_level::avx512, &rle_encode_i64_avx512);
+            register_rle_decode_i8 (isa_level::avx512, &rle_decode_avx512<std::int8_t>);
+            register_rle_decode_i16(isa_level::avx512, &rle_decode_avx512<std::int16_t>);
+            register_rle_decode_i32(isa_level::avx512, &rle_decode_avx512<std::int32_t>);
+            register_rle_decode_i64(isa_level::avx512, &rle_decode_avx512<std::int64_t>);
+            register_compress_bits_i32(isa_level::avx512, &compress_bits_i32_avx512);
+            register_compress_bits_i64(isa_level::avx512, &compress_bits_i64_avx512);
+            if (detect_cpu_features().avx512vbmi2)
+            {
+                register_unique_i8 (isa_level::avx512, &unique_i8_avx512);
+                register_unique_i16(isa_level::avx512, &unique_i16_avx512);
+                register_expand_i8 (isa_level::avx512, &expand_i8_avx512);
+                register_expand_i16(isa_level::avx512, &expand_i16_avx512);
+                register_rle_encode_i8 (isa_level::avx512, &rle_encode_i8_avx512);
+                register_rle_encode_i16(isa_level::avx512, &rle_encode_i16_avx512);
+            }
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
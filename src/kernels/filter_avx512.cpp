@@ -0,0 +1,261 @@
+// ── Opt-in AVX-512 compare + compress filter kernels (self-registering) ───────
+//   filter_<T>: the AVX2 kernels' two-phase scheme (see crosslane_avx2.cpp) with the
+//   compares landing in k-registers directly (vpcmp{b,w,d,q} / vpcmpu*, vcmpps /
+//   vcmppd) and every 64-row word packed by vpcompress into a register plus a
+//   full storeu — never the memory form (see crosslane_avx512.cpp). 8/16-bit
+//   compress needs AVX512_VBMI2 (probed separately; the AVX2 kernels keep those
+//   slots otherwise).
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_VBMI2 __attribute__((target("avx512vbmi2")))
+#else
+#  define SIMDTL_TARGET_VBMI2
+#endif
+
+namespace
+{
+    using simdtl::platform::cmp_op;
+    using simdtl::platform::filter_spec;
+
+    template <class T>
+    bool match(T x, const filter_spec<T>& s) noexcept
+    {
+        switch (s.op)
+        {
+        case cmp_op::eq: return x == s.lo;
+        case cmp_op::ne: return x != s.lo;
+        case cmp_op::lt: return x < s.lo;
+        case cmp_op::le: return x <= s.lo;
+        case cmp_op::gt: return x > s.lo;
+        case cmp_op::ge: return x >= s.lo;
+        case cmp_op::between: return s.lo <= x && x <= s.hi;
+        case cmp_op::in_set:
+            for (std::size_t j = 0; j < s.set_n; ++j)
+                if (x == s.set[j]) return true;
+            return false;
+        }
+        return false;
+    }
+
+    template <class T>
+    __m512i broadcast(T x) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>) return _mm512_castps_si512(_mm512_set1_ps(x));
+        else if constexpr (std::is_same_v<T, double>) return _mm512_castpd_si512(_mm512_set1_pd(x));
+        else if constexpr (sizeof(T) == 1) return _mm512_set1_epi8(static_cast<char>(x));
+        else if constexpr (sizeof(T) == 2) return _mm512_set1_epi16(static_cast<short>(x));
+        else if constexpr (sizeof(T) == 4) return _mm512_set1_epi32(static_cast<int>(x));
+        else return _mm512_set1_epi64(static_cast<long long>(x));
+    }
+
+    // Lanes of a and b with a P b, P an _MM_CMPINT_* (integers) or _CMP_*
+    // (floats) predicate; bit j = lane j.
+    template <class T, int P>
+    std::uint64_t cmp(__m512i a, __m512i b) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>) return _mm512_cmp_ps_mask(_mm512_castsi512_ps(a), _mm512_castsi512_ps(b), P);
+        else if constexpr (std::is_same_v<T, double>) return _mm512_cmp_pd_mask(_mm512_castsi512_pd(a), _mm512_castsi512_pd(b), P);
+        else if constexpr (std::is_signed_v<T>)
+        {
+            if constexpr (sizeof(T) == 1) return _mm512_cmp_epi8_mask(a, b, P);
+            else if constexpr (sizeof(T) == 2) return _mm512_cmp_epi16_mask(a, b, P);
+            else if constexpr (sizeof(T) == 4) return _mm512_cmp_epi32_mask(a, b, P);
+            else return _mm512_cmp_epi64_mask(a, b, P);
+        }
+        else
+        {
+            if constexpr (sizeof(T) == 1) return _mm512_cmp_epu8_mask(a, b, P);
+            else if constexpr (sizeof(T) == 2) return _mm512_cmp_epu16_mask(a, b, P);
+            else if constexpr (sizeof(T) == 4) return _mm512_cmp_epu32_mask(a, b, P);
+            else return _mm512_cmp_epu64_mask(a, b, P);
+        }
+    }
+
+    template <class T>
+    struct preds;   // the integer and float spellings of each comparison
+
+    template <class T> requires std::is_integral_v<T>
+    struct preds<T>
+    {
+        static constexpr int eq = _MM_CMPINT_EQ, ne = _MM_CMPINT_NE, lt = _MM_CMPINT_LT;
+        static constexpr int le = _MM_CMPINT_LE, gt = _MM_CMPINT_NLE, ge = _MM_CMPINT_NLT;
+    };
+    template <class T> requires std::is_floating_point_v<T>
+    struct preds<T>
+    {
+        static constexpr int eq = _CMP_EQ_OQ, ne = _CMP_NEQ_UQ, lt = _CMP_LT_OQ;
+        static constexpr int le = _CMP_LE_OQ, gt = _CMP_GT_OQ, ge = _CMP_GE_OQ;
+    };
+
+    template <class T>
+    struct consts
+    {
+        __m512i lo, hi;
+        const T* set;
+        std::size_t set_n;
+    };
+
+    // Rows of one register where Op holds.
+    template <class T, cmp_op Op>
+    std::uint64_t lanes(const T* p, const consts<T>& c) noexcept
+    {
+        using P = preds<T>;
+        const __m512i v = _mm512_loadu_si512(p);
+        if constexpr (Op == cmp_op::eq) return cmp<T, P::eq>(v, c.lo);
+        else if constexpr (Op == cmp_op::ne) return cmp<T, P::ne>(v, c.lo);
+        else if constexpr (Op == cmp_op::lt) return cmp<T, P::lt>(v, c.lo);
+        else if constexpr (Op == cmp_op::le) return cmp<T, P::le>(v, c.lo);
+        else if constexpr (Op == cmp_op::gt) return cmp<T, P::gt>(v, c.lo);
+        else if constexpr (Op == cmp_op::ge) return cmp<T, P::ge>(v, c.lo);
+        else if constexpr (Op == cmp_op::between) return cmp<T, P::ge>(v, c.lo) & cmp<T, P::le>(v, c.hi);
+        else
+        {
+            std::uint64_t m = cmp<T, P::eq>(v, broadcast(c.set[0]));
+            for (std::size_t j = 1; j < c.set_n; ++j) m |= cmp<T, P::eq>(v, broadcast(c.set[j]));
+            return m;
+        }
+    }
+
+    template <class T, cmp_op Op>
+    std::size_t compare_words(const T* p, std::size_t words, const consts<T>& c, std::uint64_t flip,
+                              std::uint64_t* bits) noexcept
+    {
+        constexpr std::size_t L = 64 / sizeof(T);
+        std::size_t kept = 0;
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            std::uint64_t m = 0;
+            for (std::size_t j = 0; j < 64; j += L) m |= lanes<T, Op>(p + 64 * w + j, c) << j;
+            bits[w] = m ^ flip;
+            kept += static_cast<std::size_t>(_mm_popcnt_u64(bits[w]));
+        }
+        return kept;
+    }
+
+    template <class T>
+    std::size_t compare_chunk(const T* p, std::size_t words, const filter_spec<T>& s, const consts<T>& c,
+                              std::uint64_t* bits) noexcept
+    {
+        const std::uint64_t flip = s.negate ? ~std::uint64_t{0} : 0;
+        switch (s.op)
+        {
+        case cmp_op::eq: return compare_words<T, cmp_op::eq>(p, words, c, flip, bits);
+        case cmp_op::ne: return compare_words<T, cmp_op::ne>(p, words, c, flip, bits);
+        case cmp_op::lt: return compare_words<T, cmp_op::lt>(p, words, c, flip, bits);
+        case cmp_op::le: return compare_words<T, cmp_op::le>(p, words, c, flip, bits);
+        case cmp_op::gt: return compare_words<T, cmp_op::gt>(p, words, c, flip, bits);
+        case cmp_op::ge: return compare_words<T, cmp_op::ge>(p, words, c, flip, bits);
+        case cmp_op::between: return compare_words<T, cmp_op::between>(p, words, c, flip, bits);
+        case cmp_op::in_set: return compare_words<T, cmp_op::in_set>(p, words, c, flip, bits);
+        }
+        return 0;
+    }
+
+    // Left-pack the set rows of one 64-row word; out needs room for 64. Out of
+    // line for 8/16-bit: the VBMI2 compress cannot inline into the generic body.
+    SIMDTL_TARGET_VBMI2 std::size_t pack_word_b(const std::uint8_t* src, std::uint64_t m, std::uint8_t* out) noexcept
+    {
+        _mm512_storeu_si512(out, _mm512_maskz_compress_epi8(m, _mm512_loadu_si512(src)));
+        return static_cast<std::size_t>(_mm_popcnt_u64(m));
+    }
+
+    SIMDTL_TARGET_VBMI2 std::size_t pack_word_w(const std::uint16_t* src, std::uint64_t m, std::uint16_t* out) noexcept
+    {
+        const __mmask32 lo = static_cast<__mmask32>(m), hi = static_cast<__mmask32>(m >> 32);
+        _mm512_storeu_si512(out, _mm512_maskz_compress_epi16(lo, _mm512_loadu_si512(src)));
+        const std::size_t k = static_cast<std::size_t>(_mm_popcnt_u32(lo));
+        _mm512_storeu_si512(out + k, _mm512_maskz_compress_epi16(hi, _mm512_loadu_si512(src + 32)));
+        return k + static_cast<std::size_t>(_mm_popcnt_u32(hi));
+    }
+
+    template <class T>
+    std::size_t pack_word(const T* src, std::uint64_t m, T* out) noexcept
+    {
+        if constexpr (sizeof(T) == 1)
+            return pack_word_b(reinterpret_cast<const std::uint8_t*>(src), m, reinterpret_cast<std::uint8_t*>(out));
+        else if constexpr (sizeof(T) == 2)
+            return pack_word_w(reinterpret_cast<const std::uint16_t*>(src), m, reinterpret_cast<std::uint16_t*>(out));
+        else if constexpr (sizeof(T) == 4)
+        {
+            std::size_t k = 0;
+            for (unsigned q = 0; q < 4 && (m >> (16 * q)) != 0; ++q)
+            {
+                const __mmask16 keep = static_cast<__mmask16>(m >> (16 * q));
+                _mm512_storeu_si512(out + k, _mm512_maskz_compress_epi32(keep, _mm512_loadu_si512(src + 16 * q)));
+                k += static_cast<std::size_t>(_mm_popcnt_u32(keep));
+            }
+            return k;
+        }
+        else
+        {
+            std::size_t k = 0;
+            for (unsigned q = 0; q < 8 && (m >> (8 * q)) != 0; ++q)
+            {
+                const __mmask8 keep = static_cast<__mmask8>(m >> (8 * q));
+                _mm512_storeu_si512(out + k, _mm512_maskz_compress_epi64(keep, _mm512_loadu_si512(src + 8 * q)));
+                k += static_cast<std::size_t>(_mm_popcnt_u32(keep));
+            }
+            return k;
+        }
+    }
+
+    template <class T>
+    std::size_t filter_avx512(const T* a, std::size_t n, const filter_spec<T>& s, T* out) noexcept
+    {
+        const consts<T> c{broadcast(s.lo), broadcast(s.hi), s.set, s.set_n};
+        std::uint64_t bits[16];
+        std::size_t i = 0, k = 0;
+        while (n - i >= 64)
+        {
+            const std::size_t words = (n - i) / 64 < 16 ? (n - i) / 64 : 16;
+            const std::size_t end = k + compare_chunk(a + i, words, s, c, bits);
+            if (out == nullptr) k = end;
+            else
+                for (std::size_t w = 0; w < words; ++w)
+                {
+                    const T* src = a + i + 64 * w;
+                    if (k + 64 <= end) k += pack_word(src, bits[w], out + k);
+                    else
+                        for (std::uint64_t x = bits[w]; x != 0; x &= x - 1)
+                            out[k++] = src[std::countr_zero(x)];
+                }
+            i += 64 * words;
+        }
+        for (; i < n; ++i)
+            if (match(a[i], s) != s.negate)
+            {
+                if (out != nullptr) out[k] = a[i];
+                ++k;
+            }
+        return k;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_filter_i32(isa_level::avx512, &filter_avx512<std::int32_t>);
+            register_filter_u32(isa_level::avx512, &filter_avx512<std::uint32_t>);
+            register_filter_i64(isa_level::avx512, &filter_avx512<std::int64_t>);
+            register_filter_u64(isa_level::avx512, &filter_avx512<std::uint64_t>);
+            register_filter_f32(isa_level::avx512, &filter_avx512<float>);
+            register_filter_f64(isa_level::avx512, &filter_avx512<double>);
+            if (detect_cpu_features().avx512vbmi2)
+            {
+                register_filter_i8 (isa_level::avx512, &filter_avx512<std::int8_t>);
+                register_filter_u8 (isa_level::avx512, &filter_avx512<std::uint8_t>);
+                register_filter_i16(isa_level::avx512, &filter_avx512<std::int16_t>);
+                register_filter_u16(isa_level::avx512, &filter_avx512<std::uint16_t>);
+            }
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
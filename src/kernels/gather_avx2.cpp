@@ -0,0 +1,102 @@
+// ── Opt-in AVX2 take / sparse_dot over int32 indices (self-registering) ───────
+// Two vpgather per iteration so their element loads overlap. AVX2 has no
+// scatter instruction, so scatter stays on the portable path at this tier.
+// Registered only where gathers beat scalar loads (not Haswell / Zen1 / Zen2).
+// sparse_dot uses mul+add (FMA is not part of the avx2 tier's guarantees). The
+// all-lanes gathers use the mask form with a zero source: the plain form's
+// undefined source trips GCC 12's -Wmaybe-uninitialized.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    inline __m256i ones256() noexcept { return _mm256_set1_epi32(-1); }
+
+    void take_i32_avx2(const std::int32_t* values, const std::int32_t* idx, std::size_t m,
+                       std::int32_t* out) noexcept
+    {
+        const int* base = reinterpret_cast<const int*>(values);
+        std::size_t j = 0;
+        for (; j + 16 <= m; j += 16)
+        {
+            const __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j));
+            const __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j + 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j),     _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, i0, ones256(), 4));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j + 8), _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, i1, ones256(), 4));
+        }
+        for (; j < m; ++j) out[j] = values[idx[j]];
+    }
+
+    void take_i64_avx2(const std::int64_t* values, const std::int32_t* idx, std::size_t m,
+                       std::int64_t* out) noexcept
+    {
+        const long long* base = reinterpret_cast<const long long*>(values);
+        std::size_t j = 0;
+        for (; j + 8 <= m; j += 8)
+        {
+            const __m128i i0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + j));
+            const __m128i i1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + j + 4));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j),     _mm256_mask_i32gather_epi64(_mm256_setzero_si256(), base, i0, ones256(), 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j + 4), _mm256_mask_i32gather_epi64(_mm256_setzero_si256(), base, i1, ones256(), 8));
+        }
+        for (; j < m; ++j) out[j] = values[idx[j]];
+    }
+
+    float sparse_dot_f32_avx2(const float* dense, const std::int32_t* idx, const float* vals,
+                              std::size_t nnz) noexcept
+    {
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        std::size_t j = 0;
+        for (; j + 16 <= nnz; j += 16)
+        {
+            const __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j));
+            const __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j + 8));
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(vals + j),     _mm256_mask_i32gather_ps(_mm256_setzero_ps(), dense, i0, _mm256_castsi256_ps(ones256()), 4)));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(vals + j + 8), _mm256_mask_i32gather_ps(_mm256_setzero_ps(), dense, i1, _mm256_castsi256_ps(ones256()), 4)));
+        }
+        const __m256 acc = _mm256_add_ps(acc0, acc1);
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_movehdup_ps(s));
+        float r = _mm_cvtss_f32(s);
+        for (; j < nnz; ++j) r += vals[j] * dense[idx[j]];
+        return r;
+    }
+
+    double sparse_dot_f64_avx2(const double* dense, const std::int32_t* idx, const double* vals,
+                               std::size_t nnz) noexcept
+    {
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+        std::size_t j = 0;
+        for (; j + 8 <= nnz; j += 8)
+        {
+            const __m128i i0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + j));
+            const __m128i i1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + j + 4));
+            acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(vals + j),     _mm256_mask_i32gather_pd(_mm256_setzero_pd(), dense, i0, _mm256_castsi256_pd(ones256()), 8)));
+            acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(vals + j + 4), _mm256_mask_i32gather_pd(_mm256_setzero_pd(), dense, i1, _mm256_castsi256_pd(ones256()), 8)));
+        }
+        const __m256d acc = _mm256_add_pd(acc0, acc1);
+        __m128d s = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+        s = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+        double r = _mm_cvtsd_f64(s);
+        for (; j < nnz; ++j) r += vals[j] * dense[idx[j]];
+        return r;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            if (detect_cpu_features().slow_gather) return;
+            register_take_i32(isa_level::avx2, &take_i32_avx2);
+            register_take_i64(isa_level::avx2, &take_i64_avx2);
+            register_sparse_dot_f32(isa_level::avx2, &sparse_dot_f32_avx2);
+            register_sparse_dot_f64(isa_level::avx2, &sparse_dot_f64_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,138 @@
+// ── Opt-in AVX-512 take / sparse_dot over int32 indices (self-registering) ────
+// vpgatherd{d,q,ps,pd}; the tail is one masked gather fed by a zero-masked index
+// load, so there is no scalar epilogue. Registered only where gathers beat
+// scalar loads. No vpscatter kernel: on Sapphire Rapids it measured ~10% SLOWER
+// than scalar stores (random rows of an L2-resident table), so scatter stays
+// portable. The all-lanes gathers use the mask form with a zero source because
+// the plain form's undefined source trips GCC 12's -Wuninitialized.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    inline __mmask16 tail16(std::size_t r) noexcept { return static_cast<__mmask16>((1u << r) - 1u); }
+    inline __mmask8  tail8(std::size_t r)  noexcept { return static_cast<__mmask8>((1u << r) - 1u); }
+
+    // Horizontal sums kept in zmm with merge-masked shuffles: GCC 12 implements
+    // _mm512_reduce_add_* and even _mm512_castps512_ps128 as extracts through an
+    // undefined source, which trips -Wuninitialized.
+    inline float hsum(__m512 v) noexcept
+    {
+        v = _mm512_add_ps(v, _mm512_mask_shuffle_f32x4(v, 0xFFFF, v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+        v = _mm512_add_ps(v, _mm512_mask_shuffle_f32x4(v, 0xFFFF, v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        v = _mm512_add_ps(v, _mm512_mask_permute_ps(v, 0xFFFF, v, _MM_SHUFFLE(1, 0, 3, 2)));
+        v = _mm512_add_ps(v, _mm512_mask_permute_ps(v, 0xFFFF, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm512_cvtss_f32(v);
+    }
+
+    inline double hsum(__m512d v) noexcept
+    {
+        v = _mm512_add_pd(v, _mm512_mask_shuffle_f64x2(v, 0xFF, v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+        v = _mm512_add_pd(v, _mm512_mask_shuffle_f64x2(v, 0xFF, v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        v = _mm512_add_pd(v, _mm512_mask_permute_pd(v, 0xFF, v, 0x55));
+        return _mm512_cvtsd_f64(v);
+    }
+
+    void take_i32_avx512(const std::int32_t* values, const std::int32_t* idx, std::size_t m,
+                         std::int32_t* out) noexcept
+    {
+        std::size_t j = 0;
+        for (; j + 32 <= m; j += 32)
+        {
+            const __m512i i0 = _mm512_loadu_si512(idx + j);
+            const __m512i i1 = _mm512_loadu_si512(idx + j + 16);
+            _mm512_storeu_si512(out + j,      _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, i0, values, 4));
+            _mm512_storeu_si512(out + j + 16, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, i1, values, 4));
+        }
+        for (; j < m; j += 16)
+        {
+            const __mmask16 k = (m - j >= 16) ? __mmask16(0xFFFF) : tail16(m - j);
+            const __m512i i = _mm512_maskz_loadu_epi32(k, idx + j);
+            _mm512_mask_storeu_epi32(out + j, k, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), k, i, values, 4));
+        }
+    }
+
+    void take_i64_avx512(const std::int64_t* values, const std::int32_t* idx, std::size_t m,
+                         std::int64_t* out) noexcept
+    {
+        std::size_t j = 0;
+        for (; j + 16 <= m; j += 16)
+        {
+            const __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j));
+            const __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j + 8));
+            _mm512_storeu_si512(out + j,     _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), 0xFF, i0, values, 8));
+            _mm512_storeu_si512(out + j + 8, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), 0xFF, i1, values, 8));
+        }
+        for (; j < m; j += 8)
+        {
+            const __mmask8 k = (m - j >= 8) ? __mmask8(0xFF) : tail8(m - j);
+            const __m256i i = _mm256_maskz_loadu_epi32(k, idx + j);
+            _mm512_mask_storeu_epi64(out + j, k, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), k, i, values, 8));
+        }
+    }
+
+    float sparse_dot_f32_avx512(const float* dense, const std::int32_t* idx, const float* vals,
+                                std::size_t nnz) noexcept
+    {
+        __m512 acc0 = _mm512_setzero_ps(), acc1 = _mm512_setzero_ps();
+        std::size_t j = 0;
+        for (; j + 32 <= nnz; j += 32)
+        {
+            const __m512i i0 = _mm512_loadu_si512(idx + j);
+            const __m512i i1 = _mm512_loadu_si512(idx + j + 16);
+            acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(vals + j),
+                                   _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, i0, dense, 4), acc0);
+            acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(vals + j + 16),
+                                   _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, i1, dense, 4), acc1);
+        }
+        for (; j < nnz; j += 16)
+        {
+            const __mmask16 k = (nnz - j >= 16) ? __mmask16(0xFFFF) : tail16(nnz - j);
+            const __m512i i = _mm512_maskz_loadu_epi32(k, idx + j);
+            acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(k, vals + j),
+                                   _mm512_mask_i32gather_ps(_mm512_setzero_ps(), k, i, dense, 4), acc0);
+        }
+        return hsum(_mm512_add_ps(acc0, acc1));
+    }
+
+    double sparse_dot_f64_avx512(const double* dense, const std::int32_t* idx, const double* vals,
+                                 std::size_t nnz) noexcept
+    {
+        __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+        std::size_t j = 0;
+        for (; j + 16 <= nnz; j += 16)
+        {
+            const __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j));
+            const __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + j + 8));
+            acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(vals + j),
+                                   _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, i0, dense, 8), acc0);
+            acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(vals + j + 8),
+                                   _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, i1, dense, 8), acc1);
+        }
+        for (; j < nnz; j += 8)
+        {
+            const __mmask8 k = (nnz - j >= 8) ? __mmask8(0xFF) : tail8(nnz - j);
+            const __m256i i = _mm256_maskz_loadu_epi32(k, idx + j);
+            acc0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(k, vals + j),
+                                   _mm512_mask_i32gather_pd(_mm512_setzero_pd(), k, i, dense, 8), acc0);
+        }
+        return hsum(_mm512_add_pd(acc0, acc1));
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            if (detect_cpu_features().slow_gather) return;
+            register_take_i32(isa_level::avx512, &take_i32_avx512);
+            register_take_i64(isa_level::avx512, &take_i64_avx512);
+            register_sparse_dot_f32(isa_level::avx512, &sparse_dot_f32_avx512);
+            register_sparse_dot_f64(isa_level::avx512, &sparse_dot_f64_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,131 @@
+// ── Opt-in AVX2 / F16C half-precision conversion kernels (self-registering) ───
+// fp16: vcvtph2ps / vcvtps2ph (round-to-nearest-even immediate, so MXCSR is not
+// consulted), eight per instruction. F16C is not implied by AVX2, so those
+// functions are tagged for it and only registered when CPUID reports it.
+// bf16 -> f32 is vpmovzxwd + a 16-bit shift. f32 -> bf16 rounds in integer
+// arithmetic: x + 0x7FFF + (bit 16 of x), keeping the top half, with NaN lanes
+// replaced by their quieted top half; vpackusdw + vpermq narrow to 16 bits.
+#include "simdtl/platform/cpu.hpp"
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_F16C __attribute__((target("f16c")))
+#else
+#  define SIMDTL_TARGET_F16C
+#endif
+
+namespace
+{
+    // Same formulas as simdtl::detail::f16_to_f32_one / f32_to_f16_one /
+    // f32_to_bf16_one, for the scalar tails.
+    inline float f16_to_f32_one(std::uint16_t h) noexcept
+    {
+        const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+        const std::uint32_t em = h & 0x7FFFu;
+        std::uint32_t bits = (em << 13) + ((127u - 15u) << 23);
+        if (em >= 0x7C00u) bits = 0x7F800000u | (em & 0x3FFu) << 13 | (em > 0x7C00u ? 0x00400000u : 0u);
+        else if (em < 0x0400u) bits = std::bit_cast<std::uint32_t>(static_cast<float>(em) * 0x1p-24f);
+        return std::bit_cast<float>(bits | sign);
+    }
+
+    inline std::uint16_t f32_to_f16_one(float f) noexcept
+    {
+        std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+        const std::uint32_t sign = (x >> 16) & 0x8000u;
+        x &= 0x7FFFFFFFu;
+        std::uint32_t h;
+        if (x > 0x7F800000u) h = 0x7E00u | ((x >> 13) & 0x3FFu);
+        else if (x >= 0x477FF000u) h = 0x7C00u;
+        else if (x < 0x38800000u) h = std::bit_cast<std::uint32_t>(std::bit_cast<float>(x) + 0.5f) - 0x3F000000u;
+        else h = (x + 0xC8000FFFu + ((x >> 13) & 1u)) >> 13;
+        return static_cast<std::uint16_t>(h | sign);
+    }
+
+    inline std::uint16_t f32_to_bf16_one(float f) noexcept
+    {
+        const std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+        if ((x & 0x7FFFFFFFu) > 0x7F800000u) return static_cast<std::uint16_t>((x >> 16) | 0x40u);
+        return static_cast<std::uint16_t>((x + 0x7FFFu + ((x >> 16) & 1u)) >> 16);
+    }
+
+    SIMDTL_TARGET_F16C void f16_to_f32_avx2(const std::uint16_t* first, std::size_t n, float* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+            _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm256_castsi256_si128(h)));
+            _mm256_storeu_ps(out + i + 8, _mm256_cvtph_ps(_mm256_extracti128_si256(h, 1)));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = f16_to_f32_one(first[i]);
+    }
+
+    SIMDTL_TARGET_F16C void f32_to_f16_avx2(const float* first, std::size_t n, std::uint16_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m128i lo = _mm256_cvtps_ph(_mm256_loadu_ps(first + i), _MM_FROUND_TO_NEAREST_INT);
+            const __m128i hi = _mm256_cvtps_ph(_mm256_loadu_ps(first + i + 8), _MM_FROUND_TO_NEAREST_INT);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_set_m128i(hi, lo));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = f32_to_f16_one(first[i]);
+    }
+
+    void bf16_to_f32_avx2(const std::uint16_t* first, std::size_t n, float* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+            const __m256i lo = _mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(h)), 16);
+            const __m256i hi = _mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(h, 1)), 16);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), lo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 8), hi);
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = std::bit_cast<float>(static_cast<std::uint32_t>(first[i]) << 16);
+    }
+
+    // Eight floats -> eight bf16 bit patterns, one per 32-bit lane.
+    inline __m256i bf16_lanes(__m256i x) noexcept
+    {
+        const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+        const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(x, _mm256_set1_epi32(0x7FFF)), odd), 16);
+        const __m256i quiet = _mm256_or_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(0x40));
+        const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7FFFFFFF)), _mm256_set1_epi32(0x7F800000));
+        return _mm256_blendv_epi8(rounded, quiet, nan);
+    }
+
+    void f32_to_bf16_avx2(const float* first, std::size_t n, std::uint16_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m256i a = bf16_lanes(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i)));
+            const __m256i b = bf16_lanes(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i + 8)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = f32_to_bf16_one(first[i]);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            if (detect_cpu_features().f16c)
+            {
+                register_f16_to_f32(isa_level::avx2, &f16_to_f32_avx2);
+                register_f32_to_f16(isa_level::avx2, &f32_to_f16_avx2);
+            }
+            register_bf16_to_f32(isa_level::avx2, &bf16_to_f32_avx2);
+            register_f32_to_bf16(isa_level::avx2, &f32_to_bf16_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,135 @@
+// ── Opt-in AVX-512 half-precision conversion kernels (self-registering) ───────
+// fp16: the 512-bit vcvtph2ps / vcvtps2ph (AVX512F), sixteen per instruction.
+// bf16 -> f32: vpmovzxwd + shift. f32 -> bf16: vcvtneps2bf16 when AVX512_BF16
+// is present, else the integer round-half-even of the AVX2 kernel narrowed
+// with vpmovdw. vcvtneps2bf16 rounds like the portable code and quiets NaNs
+// the same way, but flushes subnormal inputs to +-0; those lanes (rare, and
+// tested for once per vector) are patched from the integer path. Tails are a
+// masked load / store; the zero-masked forms dodge GCC 12's
+// -Wmaybe-uninitialized on the unmasked intrinsics.
+#include "simdtl/platform/cpu.hpp"
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_BF16 __attribute__((target("avx512bf16")))
+#else
+#  define SIMDTL_TARGET_BF16
+#endif
+
+namespace
+{
+    inline __mmask16 tail16(std::size_t r) noexcept { return static_cast<__mmask16>((1u << r) - 1u); }
+
+    void f16_to_f32_avx512(const std::uint16_t* first, std::size_t n, float* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+            _mm512_storeu_ps(out + i, _mm512_maskz_cvtph_ps(0xFFFF, h));
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm512_mask_storeu_ps(out + body, m, _mm512_maskz_cvtph_ps(0xFFFF, _mm256_maskz_loadu_epi16(m, first + body)));
+        }
+    }
+
+    void f32_to_f16_avx512(const float* first, std::size_t n, std::uint16_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m256i h = _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(first + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), h);
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            const __m256i h = _mm512_maskz_cvtps_ph(0xFFFF, _mm512_maskz_loadu_ps(m, first + body), _MM_FROUND_TO_NEAREST_INT);
+            _mm256_mask_storeu_epi16(out + body, m, h);
+        }
+    }
+
+    inline __m512i bf16_widen(__m256i h) noexcept
+    {
+        return _mm512_maskz_slli_epi32(0xFFFF, _mm512_maskz_cvtepu16_epi32(0xFFFF, h), 16);
+    }
+
+    void bf16_to_f32_avx512(const std::uint16_t* first, std::size_t n, float* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+            _mm512_storeu_si512(out + i, bf16_widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i))));
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm512_mask_storeu_epi32(out + body, m, bf16_widen(_mm256_maskz_loadu_epi16(m, first + body)));
+        }
+    }
+
+    // Sixteen floats -> sixteen bf16 bit patterns: x + 0x7FFF + (bit 16 of x),
+    // top half kept; NaN lanes take their quieted top half.
+    inline __m256i bf16_round(__m512i x) noexcept
+    {
+        const __m512i top = _mm512_maskz_srli_epi32(0xFFFF, x, 16);
+        const __m512i odd = _mm512_and_si512(top, _mm512_set1_epi32(1));
+        __m512i r = _mm512_maskz_srli_epi32(0xFFFF, _mm512_add_epi32(_mm512_add_epi32(x, _mm512_set1_epi32(0x7FFF)), odd), 16);
+        const __mmask16 nan = _mm512_cmpgt_epu32_mask(_mm512_and_si512(x, _mm512_set1_epi32(0x7FFFFFFF)),
+                                                      _mm512_set1_epi32(0x7F800000));
+        r = _mm512_mask_or_epi32(r, nan, top, _mm512_set1_epi32(0x40));
+        return _mm512_maskz_cvtepi32_epi16(0xFFFF, r);
+    }
+
+    void f32_to_bf16_avx512(const float* first, std::size_t n, std::uint16_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), bf16_round(_mm512_loadu_si512(first + i)));
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm256_mask_storeu_epi16(out + body, m, bf16_round(_mm512_maskz_loadu_epi32(m, first + body)));
+        }
+    }
+
+    // vcvtneps2bf16, with subnormal-input lanes redone by bf16_round.
+    SIMDTL_TARGET_BF16 inline __m256i bf16_native(__m512i x) noexcept
+    {
+        const __m256i h = reinterpret_cast<__m256i>(_mm512_maskz_cvtneps_pbh(0xFFFF, _mm512_castsi512_ps(x)));
+        const __mmask16 sub = _mm512_testn_epi32_mask(x, _mm512_set1_epi32(0x7F800000)) &
+                              _mm512_test_epi32_mask(x, _mm512_set1_epi32(0x007FFFFF));
+        if (sub == 0) return h;
+        return _mm256_mask_blend_epi16(sub, h, bf16_round(x));
+    }
+
+    SIMDTL_TARGET_BF16 void f32_to_bf16_avx512bf16(const float* first, std::size_t n, std::uint16_t* out) noexcept
+    {
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), bf16_native(_mm512_loadu_si512(first + i)));
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm256_mask_storeu_epi16(out + body, m, bf16_native(_mm512_maskz_loadu_epi32(m, first + body)));
+        }
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_f16_to_f32(isa_level::avx512, &f16_to_f32_avx512);
+            register_f32_to_f16(isa_level::avx512, &f32_to_f16_avx512);
+            register_bf16_to_f32(isa_level::avx512, &bf16_to_f32_avx512);
+            register_f32_to_bf16(isa_level::avx512, detect_cpu_features().avx512bf16 ? &f32_to_bf16_avx512bf16
+                                                                                     : &f32_to_bf16_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
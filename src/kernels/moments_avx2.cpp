@@ -0,0 +1,141 @@
+// ── Opt-in AVX2 (+FMA3) one-pass moments kernels (self-registering) ───────────
+// The header's per-lane Welford recurrence with explicit ymm accumulators:
+// S = 4 vectors of lanes for mean / M2 (so four mean -> delta -> mean chains
+// overlap), S = 2 when M3 / M4 are tracked too (eight accumulators + temporaries
+// fit the 16 registers). Every lane sees the same count k, so 1/k and the
+// count-only factors are computed once per step as scalars and broadcast.
+// Lane states are stored as [mean L][M2 L][M3 L][M4 L] for the header to merge.
+// FMA3 is not implied by AVX2, so everything here is tagged for it and only
+// registered when CPUID reports it.
+#include "simdtl/platform/cpu.hpp"
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_FMA __attribute__((target("fma")))
+#else
+#  define SIMDTL_TARGET_FMA
+#endif
+
+namespace
+{
+    struct f32_ops
+    {
+        using T = float;
+        using V = __m256;
+        static constexpr std::size_t W = 8;
+        SIMDTL_TARGET_FMA static V load(const T* p) noexcept { return _mm256_loadu_ps(p); }
+        SIMDTL_TARGET_FMA static void store(T* p, V v) noexcept { _mm256_storeu_ps(p, v); }
+        SIMDTL_TARGET_FMA static V set1(T x) noexcept { return _mm256_set1_ps(x); }
+        SIMDTL_TARGET_FMA static V zero() noexcept { return _mm256_setzero_ps(); }
+        SIMDTL_TARGET_FMA static V add(V a, V b) noexcept { return _mm256_add_ps(a, b); }
+        SIMDTL_TARGET_FMA static V sub(V a, V b) noexcept { return _mm256_sub_ps(a, b); }
+        SIMDTL_TARGET_FMA static V mul(V a, V b) noexcept { return _mm256_mul_ps(a, b); }
+        SIMDTL_TARGET_FMA static V fmadd(V a, V b, V c) noexcept { return _mm256_fmadd_ps(a, b, c); }    // a*b + c
+        SIMDTL_TARGET_FMA static V fnmadd(V a, V b, V c) noexcept { return _mm256_fnmadd_ps(a, b, c); }  // c - a*b
+    };
+
+    struct f64_ops
+    {
+        using T = double;
+        using V = __m256d;
+        static constexpr std::size_t W = 4;
+        SIMDTL_TARGET_FMA static V load(const T* p) noexcept { return _mm256_loadu_pd(p); }
+        SIMDTL_TARGET_FMA static void store(T* p, V v) noexcept { _mm256_storeu_pd(p, v); }
+        SIMDTL_TARGET_FMA static V set1(T x) noexcept { return _mm256_set1_pd(x); }
+        SIMDTL_TARGET_FMA static V zero() noexcept { return _mm256_setzero_pd(); }
+        SIMDTL_TARGET_FMA static V add(V a, V b) noexcept { return _mm256_add_pd(a, b); }
+        SIMDTL_TARGET_FMA static V sub(V a, V b) noexcept { return _mm256_sub_pd(a, b); }
+        SIMDTL_TARGET_FMA static V mul(V a, V b) noexcept { return _mm256_mul_pd(a, b); }
+        SIMDTL_TARGET_FMA static V fmadd(V a, V b, V c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+        SIMDTL_TARGET_FMA static V fnmadd(V a, V b, V c) noexcept { return _mm256_fnmadd_pd(a, b, c); }
+    };
+
+    // Same recurrence as simdtl::detail::moments_lanes_portable.
+    template <class Ops, std::size_t S, bool Fourth>
+    SIMDTL_TARGET_FMA std::size_t welford(const typename Ops::T* first, std::size_t n, typename Ops::T* lanes) noexcept
+    {
+        using T = typename Ops::T;
+        using V = typename Ops::V;
+        constexpr std::size_t W = Ops::W, L = S * W;
+        const std::size_t steps = n / L;
+        if (steps == 0) return 0;
+        V mean[S], m2[S], m3[S], m4[S];
+        for (std::size_t s = 0; s < S; ++s) mean[s] = m2[s] = m3[s] = m4[s] = Ops::zero();
+        const V three = Ops::set1(T(3)), four = Ops::set1(T(4)), six = Ops::set1(T(6));
+        for (std::size_t k = 1; k <= steps; ++k)
+        {
+            const T nk = static_cast<T>(k);
+            const V inv = Ops::set1(T(1) / nk);
+            const T* p = first + (k - 1) * L;
+            if constexpr (Fourth)
+            {
+                const V c1 = Ops::set1(nk - 1), c2 = Ops::set1(nk * nk - 3 * nk + 3), c3 = Ops::set1(nk - 2);
+                for (std::size_t s = 0; s < S; ++s)
+                {
+                    const V delta = Ops::sub(Ops::load(p + s * W), mean[s]);
+                    const V dn = Ops::mul(delta, inv), dn2 = Ops::mul(dn, dn);
+                    const V t1 = Ops::mul(Ops::mul(delta, dn), c1);
+                    // m4 += t1 dn2 c2 + 6 dn2 m2 - 4 dn m3
+                    V d4 = Ops::mul(Ops::mul(t1, dn2), c2);
+                    d4 = Ops::fmadd(Ops::mul(six, dn2), m2[s], d4);
+                    d4 = Ops::fnmadd(Ops::mul(four, dn), m3[s], d4);
+                    m4[s] = Ops::add(m4[s], d4);
+                    // m3 += t1 dn c3 - 3 dn m2
+                    V d3 = Ops::mul(Ops::mul(t1, dn), c3);
+                    d3 = Ops::fnmadd(Ops::mul(three, dn), m2[s], d3);
+                    m3[s] = Ops::add(m3[s], d3);
+                    m2[s] = Ops::add(m2[s], t1);
+                    mean[s] = Ops::add(mean[s], dn);
+                }
+            }
+            else
+            {
+                for (std::size_t s = 0; s < S; ++s)
+                {
+                    const V x = Ops::load(p + s * W);
+                    const V delta = Ops::sub(x, mean[s]);
+                    mean[s] = Ops::fmadd(delta, inv, mean[s]);
+                    m2[s] = Ops::fmadd(delta, Ops::sub(x, mean[s]), m2[s]);
+                }
+            }
+        }
+        for (std::size_t s = 0; s < S; ++s)
+        {
+            Ops::store(lanes + s * W, mean[s]);
+            Ops::store(lanes + L + s * W, m2[s]);
+            if constexpr (Fourth)
+            {
+                Ops::store(lanes + 2 * L + s * W, m3[s]);
+                Ops::store(lanes + 3 * L + s * W, m4[s]);
+            }
+        }
+        return L;
+    }
+
+    SIMDTL_TARGET_FMA std::size_t moments_f32_avx2(const float* first, std::size_t n, bool fourth, float* lanes) noexcept
+    {
+        return fourth ? welford<f32_ops, 2, true>(first, n, lanes) : welford<f32_ops, 4, false>(first, n, lanes);
+    }
+
+    SIMDTL_TARGET_FMA std::size_t moments_f64_avx2(const double* first, std::size_t n, bool fourth, double* lanes) noexcept
+    {
+        return fourth ? welford<f64_ops, 2, true>(first, n, lanes) : welford<f64_ops, 4, false>(first, n, lanes);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            if (detect_cpu_features().fma)
+            {
+                register_moments_f32(isa_level::avx2, &moments_f32_avx2);
+                register_moments_f64(isa_level::avx2, &moments_f64_avx2);
+            }
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
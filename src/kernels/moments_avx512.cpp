@@ -0,0 +1,127 @@
+// ── Opt-in AVX-512 one-pass moments kernels (self-registering) ────────────────
+// The AVX2 kernels at twice the width (FMA is part of AVX512F): S = 4 vectors
+// of per-lane Welford state for mean / M2, S = 2 with M3 / M4, 1/k and the
+// count-only factors broadcast once per step. Lane states are stored as
+// [mean L][M2 L][M3 L][M4 L] (L = 64 / 32 floats, 32 / 16 doubles).
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+
+namespace
+{
+    struct f32_ops
+    {
+        using T = float;
+        using V = __m512;
+        static constexpr std::size_t W = 16;
+        static V load(const T* p) noexcept { return _mm512_loadu_ps(p); }
+        static void store(T* p, V v) noexcept { _mm512_storeu_ps(p, v); }
+        static V set1(T x) noexcept { return _mm512_set1_ps(x); }
+        static V zero() noexcept { return _mm512_setzero_ps(); }
+        static V add(V a, V b) noexcept { return _mm512_add_ps(a, b); }
+        static V sub(V a, V b) noexcept { return _mm512_sub_ps(a, b); }
+        static V mul(V a, V b) noexcept { return _mm512_mul_ps(a, b); }
+        static V fmadd(V a, V b, V c) noexcept { return _mm512_fmadd_ps(a, b, c); }    // a*b + c
+        static V fnmadd(V a, V b, V c) noexcept { return _mm512_fnmadd_ps(a, b, c); }  // c - a*b
+    };
+
+    struct f64_ops
+    {
+        using T = double;
+        using V = __m512d;
+        static constexpr std::size_t W = 8;
+        static V load(const T* p) noexcept { return _mm512_loadu_pd(p); }
+        static void store(T* p, V v) noexcept { _mm512_storeu_pd(p, v); }
+        static V set1(T x) noexcept { return _mm512_set1_pd(x); }
+        static V zero() noexcept { return _mm512_setzero_pd(); }
+        static V add(V a, V b) noexcept { return _mm512_add_pd(a, b); }
+        static V sub(V a, V b) noexcept { return _mm512_sub_pd(a, b); }
+        static V mul(V a, V b) noexcept { return _mm512_mul_pd(a, b); }
+        static V fmadd(V a, V b, V c) noexcept { return _mm512_fmadd_pd(a, b, c); }
+        static V fnmadd(V a, V b, V c) noexcept { return _mm512_fnmadd_pd(a, b, c); }
+    };
+
+    // Same recurrence as simdtl::detail::moments_lanes_portable.
+    template <class Ops, std::size_t S, bool Fourth>
+    std::size_t welford(const typename Ops::T* first, std::size_t n, typename Ops::T* lanes) noexcept
+    {
+        using T = typename Ops::T;
+        using V = typename Ops::V;
+        constexpr std::size_t W = Ops::W, L = S * W;
+        const std::size_t steps = n / L;
+        if (steps == 0) return 0;
+        V mean[S], m2[S], m3[S], m4[S];
+        for (std::size_t s = 0; s < S; ++s) mean[s] = m2[s] = m3[s] = m4[s] = Ops::zero();
+        const V three = Ops::set1(T(3)), four = Ops::set1(T(4)), six = Ops::set1(T(6));
+        for (std::size_t k = 1; k <= steps; ++k)
+        {
+            const T nk = static_cast<T>(k);
+            const V inv = Ops::set1(T(1) / nk);
+            const T* p = first + (k - 1) * L;
+            if constexpr (Fourth)
+            {
+                const V c1 = Ops::set1(nk - 1), c2 = Ops::set1(nk * nk - 3 * nk + 3), c3 = Ops::set1(nk - 2);
+                for (std::size_t s = 0; s < S; ++s)
+                {
+                    const V delta = Ops::sub(Ops::load(p + s * W), mean[s]);
+                    const V dn = Ops::mul(delta, inv), dn2 = Ops::mul(dn, dn);
+                    const V t1 = Ops::mul(Ops::mul(delta, dn), c1);
+                    // m4 += t1 dn2 c2 + 6 dn2 m2 - 4 dn m3
+                    V d4 = Ops::mul(Ops::mul(t1, dn2), c2);
+                    d4 = Ops::fmadd(Ops::mul(six, dn2), m2[s], d4);
+                    d4 = Ops::fnmadd(Ops::mul(four, dn), m3[s], d4);
+                    m4[s] = Ops::add(m4[s], d4);
+                    // m3 += t1 dn c3 - 3 dn m2
+                    V d3 = Ops::mul(Ops::mul(t1, dn), c3);
+                    d3 = Ops::fnmadd(Ops::mul(three, dn), m2[s], d3);
+                    m3[s] = Ops::add(m3[s], d3);
+                    m2[s] = Ops::add(m2[s], t1);
+                    mean[s] = Ops::add(mean[s], dn);
+                }
+            }
+            else
+            {
+                for (std::size_t s = 0; s < S; ++s)
+                {
+                    const V x = Ops::load(p + s * W);
+                    const V delta = Ops::sub(x, mean[s]);
+                    mean[s] = Ops::fmadd(delta, inv, mean[s]);
+                    m2[s] = Ops::fmadd(delta, Ops::sub(x, mean[s]), m2[s]);
+                }
+            }
+        }
+        for (std::size_t s = 0; s < S; ++s)
+        {
+            Ops::store(lanes + s * W, mean[s]);
+            Ops::store(lanes + L + s * W, m2[s]);
+            if constexpr (Fourth)
+            {
+                Ops::store(lanes + 2 * L + s * W, m3[s]);
+                Ops::store(lanes + 3 * L + s * W, m4[s]);
+            }
+        }
+        return L;
+    }
+
+    std::size_t moments_f32_avx512(const float* first, std::size_t n, bool fourth, float* lanes) noexcept
+    {
+        return fourth ? welford<f32_ops, 2, true>(first, n, lanes) : welford<f32_ops, 4, false>(first, n, lanes);
+    }
+
+    std::size_t moments_f64_avx512(const double* first, std::size_t n, bool fourth, double* lanes) noexcept
+    {
+        return fourth ? welford<f64_ops, 2, true>(first, n, lanes) : welford<f64_ops, 4, false>(first, n, lanes);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_moments_f32(isa_level::avx512, &moments_f32_avx512);
+            register_moments_f64(isa_level::avx512, &moments_f64_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,97 @@
+// ── Opt-in AVX2 quantize / dequantize kernels (self-registering) ──────────────
+// quantize, 32 floats per iteration: vmulps by 1 / scale, NaN lanes zeroed
+// (vcmpps ord + vandps), clamp to [min - zp, max - zp] with vmaxps / vminps,
+// vcvtps2dq (nearest-even in the default MXCSR mode), vpaddd zero_point, then
+// vpackssdw + vpacksswb / vpackuswb and one vpermd to undo the in-lane packs.
+// The clamp keeps every lane in range, so the packs never saturate.
+// dequantize: vpmovsxbd / vpmovzxbd, vpsubd zero_point, vcvtdq2ps, vmulps.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+    // Same formulas as simdtl::detail::quantize_op / dequantize_op, for the
+    // scalar tails.
+    template <class Out>
+    inline Out quantize_one(float x, float inv_scale, float zp) noexcept
+    {
+        const float lo = static_cast<float>(std::numeric_limits<Out>::min()) - zp;
+        const float hi = static_cast<float>(std::numeric_limits<Out>::max()) - zp;
+        float t = x * inv_scale;
+        if (!(t == t)) t = 0.0f;
+        t = t < lo ? lo : hi < t ? hi : t;
+        return static_cast<Out>(std::rint(t) + zp);
+    }
+
+    struct quantize_consts
+    {
+        __m256 inv, lo, hi;
+        __m256i zp;
+    };
+
+    inline __m256i quantize_lanes(__m256 x, const quantize_consts& c) noexcept
+    {
+        __m256 t = _mm256_mul_ps(x, c.inv);
+        t = _mm256_and_ps(t, _mm256_cmp_ps(t, t, _CMP_ORD_Q));
+        t = _mm256_min_ps(_mm256_max_ps(t, c.lo), c.hi);
+        return _mm256_add_epi32(_mm256_cvtps_epi32(t), c.zp);
+    }
+
+    template <class Out>
+    void quantize_avx2(const float* first, std::size_t n, float inv_scale, std::int32_t zero_point, Out* out) noexcept
+    {
+        const float zp = static_cast<float>(zero_point);
+        const quantize_consts c{_mm256_set1_ps(inv_scale),
+                                _mm256_set1_ps(static_cast<float>(std::numeric_limits<Out>::min()) - zp),
+                                _mm256_set1_ps(static_cast<float>(std::numeric_limits<Out>::max()) - zp),
+                                _mm256_set1_epi32(zero_point)};
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        const std::size_t body = n - n % 32;
+        for (std::size_t i = 0; i < body; i += 32)
+        {
+            const __m256i a = quantize_lanes(_mm256_loadu_ps(first + i), c);
+            const __m256i b = quantize_lanes(_mm256_loadu_ps(first + i + 8), c);
+            const __m256i d = quantize_lanes(_mm256_loadu_ps(first + i + 16), c);
+            const __m256i e = quantize_lanes(_mm256_loadu_ps(first + i + 24), c);
+            const __m256i ab = _mm256_packs_epi32(a, b), de = _mm256_packs_epi32(d, e);
+            const __m256i r = std::is_signed_v<Out> ? _mm256_packs_epi16(ab, de) : _mm256_packus_epi16(ab, de);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permutevar8x32_epi32(r, order));
+        }
+        for (std::size_t i = body; i < n; ++i) out[i] = quantize_one<Out>(first[i], inv_scale, zp);
+    }
+
+    template <class In>
+    void dequantize_avx2(const In* first, std::size_t n, float scale, std::int32_t zero_point, float* out) noexcept
+    {
+        const __m256 s = _mm256_set1_ps(scale);
+        const __m256i zp = _mm256_set1_epi32(zero_point);
+        const std::size_t body = n - n % 8;
+        for (std::size_t i = 0; i < body; i += 8)
+        {
+            const __m128i q = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(first + i));
+            const __m256i w = std::is_signed_v<In> ? _mm256_cvtepi8_epi32(q) : _mm256_cvtepu8_epi32(q);
+            _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(w, zp)), s));
+        }
+        for (std::size_t i = body; i < n; ++i)
+            out[i] = static_cast<float>(static_cast<std::int32_t>(first[i]) - zero_point) * scale;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_quantize_i8(isa_level::avx2, &quantize_avx2<std::int8_t>);
+            register_quantize_u8(isa_level::avx2, &quantize_avx2<std::uint8_t>);
+            register_dequantize_i8(isa_level::avx2, &dequantize_avx2<std::int8_t>);
+            register_dequantize_u8(isa_level::avx2, &dequantize_avx2<std::uint8_t>);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,92 @@
+// ── Opt-in AVX-512 quantize / dequantize kernels (self-registering) ───────────
+// Sixteen lanes per step with the AVX2 kernel's formula: vmulps, NaN lanes
+// zeroed by a zero-masked move, vmaxps / vminps clamp, vcvtps2dq, vpaddd, and a
+// plain truncating vpmovdb (every lane is already in range). dequantize is
+// vpmovsxbd / vpmovzxbd, vpsubd, vcvtdq2ps, vmulps. Tails are one masked load /
+// store; the zero-masked forms dodge GCC 12's -Wmaybe-uninitialized on the
+// unmasked intrinsics.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+    inline __mmask16 tail16(std::size_t r) noexcept { return static_cast<__mmask16>((1u << r) - 1u); }
+
+    struct quantize_consts
+    {
+        __m512 inv, lo, hi;
+        __m512i zp;
+    };
+
+    inline __m512i quantize_lanes(__m512 x, const quantize_consts& c) noexcept
+    {
+        __m512 t = _mm512_mul_ps(x, c.inv);
+        t = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(t, t, _CMP_ORD_Q), t);
+        t = _mm512_maskz_min_ps(0xFFFF, _mm512_maskz_max_ps(0xFFFF, t, c.lo), c.hi);
+        return _mm512_add_epi32(_mm512_maskz_cvtps_epi32(0xFFFF, t), c.zp);
+    }
+
+    template <class Out>
+    void quantize_avx512(const float* first, std::size_t n, float inv_scale, std::int32_t zero_point, Out* out) noexcept
+    {
+        const float zp = static_cast<float>(zero_point);
+        const quantize_consts c{_mm512_set1_ps(inv_scale),
+                                _mm512_set1_ps(static_cast<float>(std::numeric_limits<Out>::min()) - zp),
+                                _mm512_set1_ps(static_cast<float>(std::numeric_limits<Out>::max()) - zp),
+                                _mm512_set1_epi32(zero_point)};
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m512i q = quantize_lanes(_mm512_loadu_ps(first + i), c);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm512_maskz_cvtepi32_epi8(0xFFFF, q));
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm512_mask_cvtepi32_storeu_epi8(out + body, m, quantize_lanes(_mm512_maskz_loadu_ps(m, first + body), c));
+        }
+    }
+
+    template <class In>
+    inline __m512 dequantize_lanes(__m128i q, __m512i zp, __m512 s) noexcept
+    {
+        const __m512i w = std::is_signed_v<In> ? _mm512_maskz_cvtepi8_epi32(0xFFFF, q) : _mm512_maskz_cvtepu8_epi32(0xFFFF, q);
+        return _mm512_mul_ps(_mm512_maskz_cvtepi32_ps(0xFFFF, _mm512_sub_epi32(w, zp)), s);
+    }
+
+    template <class In>
+    void dequantize_avx512(const In* first, std::size_t n, float scale, std::int32_t zero_point, float* out) noexcept
+    {
+        const __m512 s = _mm512_set1_ps(scale);
+        const __m512i zp = _mm512_set1_epi32(zero_point);
+        const std::size_t body = n - n % 16;
+        for (std::size_t i = 0; i < body; i += 16)
+        {
+            const __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+            _mm512_storeu_ps(out + i, dequantize_lanes<In>(q, zp, s));
+        }
+        if (body < n)
+        {
+            const __mmask16 m = tail16(n - body);
+            _mm512_mask_storeu_ps(out + body, m, dequantize_lanes<In>(_mm_maskz_loadu_epi8(m, first + body), zp, s));
+        }
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_quantize_i8(isa_level::avx512, &quantize_avx512<std::int8_t>);
+            register_quantize_u8(isa_level::avx512, &quantize_avx512<std::uint8_t>);
+            register_dequantize_i8(isa_level::avx512, &dequantize_avx512<std::int8_t>);
+            register_dequantize_u8(isa_level::avx512, &dequantize_avx512<std::uint8_t>);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
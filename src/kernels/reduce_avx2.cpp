@@ -0,0 +1,201 @@
+// ── Opt-in AVX2 widening-sum and dot kernels (self-registering) ───────────────
+// Bytes: vpsadbw against zero sums each group of 8 bytes into a 64-bit lane,
+// so the accumulator can never overflow; int8 is XORed with 0x80 (= x + 128 as
+// unsigned) and the bias subtracted once at the end. 16-bit: vpmaddwd by 1 adds
+// adjacent pairs into int32 lanes (|pair| <= 2^16), flushed to int64 lanes every
+// kFlush steps, long before 2^31; uint16 is biased the same way as int8.
+// float -> double: vcvtps2pd on each half, four accumulators to cover latency.
+// Dot products: vfmadd into four accumulators (two loads per FMA, so loads are
+// the limit, not FMA latency). FMA3 is not implied by AVX2, so those functions
+// are tagged for it and only registered when CPUID reports it.
+#include "simdtl/platform/cpu.hpp"
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+// MSVC exposes every intrinsic regardless of /arch; GCC/Clang need the FMA
+// functions tagged, since the TU itself is built for AVX2 only.
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_FMA __attribute__((target("fma")))
+#else
+#  define SIMDTL_TARGET_FMA
+#endif
+
+namespace
+{
+    // 16-element vpmaddwd steps per flush: 2^14 * 2^16 = 2^30 < 2^31.
+    constexpr std::size_t kFlush = std::size_t{1} << 14;
+
+    inline std::int64_t hsum64(__m256i v) noexcept
+    {
+        const __m128i s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+    }
+
+    inline double hsum(__m256d v) noexcept
+    {
+        __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        s = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+        return _mm_cvtsd_f64(s);
+    }
+
+    // Sum of (bytes XOR flip) over the first `done` bytes, done a multiple of 32.
+    inline std::uint64_t sad_sum(const std::uint8_t* p, std::size_t n, __m256i flip, std::size_t& done) noexcept
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i a0 = zero, a1 = zero;
+        std::size_t i = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            const __m256i x0 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), flip);
+            const __m256i x1 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 32)), flip);
+            a0 = _mm256_add_epi64(a0, _mm256_sad_epu8(x0, zero));
+            a1 = _mm256_add_epi64(a1, _mm256_sad_epu8(x1, zero));
+        }
+        if (i + 32 <= n)
+        {
+            const __m256i x0 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), flip);
+            a0 = _mm256_add_epi64(a0, _mm256_sad_epu8(x0, zero));
+            i += 32;
+        }
+        done = i;
+        return static_cast<std::uint64_t>(hsum64(_mm256_add_epi64(a0, a1)));
+    }
+
+    std::uint64_t reduce_wide_u8_avx2(const std::uint8_t* first, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        std::uint64_t s = sad_sum(first, n, _mm256_setzero_si256(), i);
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    std::int64_t reduce_wide_i8_avx2(const std::int8_t* first, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        const std::uint64_t biased = sad_sum(reinterpret_cast<const std::uint8_t*>(first), n, _mm256_set1_epi8(-128), i);
+        std::int64_t s = static_cast<std::int64_t>(biased) - 128 * static_cast<std::int64_t>(i);
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    // Sum of (int16 lanes XOR flip) over the first `done` elements, done a multiple of 16.
+    inline std::int64_t madd_sum(const std::int16_t* p, std::size_t n, __m256i flip, std::size_t& done) noexcept
+    {
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i wide = _mm256_setzero_si256();
+        std::size_t i = 0;
+        while (i + 16 <= n)
+        {
+            __m256i a32 = _mm256_setzero_si256();
+            const std::size_t steps = (n - i) / 16 < kFlush ? (n - i) / 16 : kFlush;
+            for (std::size_t k = 0; k < steps; ++k, i += 16)
+            {
+                const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), flip);
+                a32 = _mm256_add_epi32(a32, _mm256_madd_epi16(x, ones));
+            }
+            wide = _mm256_add_epi64(wide, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(a32)));
+            wide = _mm256_add_epi64(wide, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a32, 1)));
+        }
+        done = i;
+        return hsum64(wide);
+    }
+
+    std::int64_t reduce_wide_i16_avx2(const std::int16_t* first, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        std::int64_t s = madd_sum(first, n, _mm256_setzero_si256(), i);
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    std::uint64_t reduce_wide_u16_avx2(const std::uint16_t* first, std::size_t n) noexcept
+    {
+        // x ^ 0x8000 read as int16 is x - 32768.
+        std::size_t i = 0;
+        const std::int64_t biased = madd_sum(reinterpret_cast<const std::int16_t*>(first), n, _mm256_set1_epi16(-32768), i);
+        std::uint64_t s = static_cast<std::uint64_t>(biased + 32768 * static_cast<std::int64_t>(i));
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    double reduce_wide_f32_avx2(const float* first, std::size_t n) noexcept
+    {
+        __m256d a0 = _mm256_setzero_pd(), a1 = a0, a2 = a0, a3 = a0;
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            a0 = _mm256_add_pd(a0, _mm256_cvtps_pd(_mm_loadu_ps(first + i)));
+            a1 = _mm256_add_pd(a1, _mm256_cvtps_pd(_mm_loadu_ps(first + i + 4)));
+            a2 = _mm256_add_pd(a2, _mm256_cvtps_pd(_mm_loadu_ps(first + i + 8)));
+            a3 = _mm256_add_pd(a3, _mm256_cvtps_pd(_mm_loadu_ps(first + i + 12)));
+        }
+        for (; i + 4 <= n; i += 4) a0 = _mm256_add_pd(a0, _mm256_cvtps_pd(_mm_loadu_ps(first + i)));
+        double s = hsum(_mm256_add_pd(_mm256_add_pd(a0, a1), _mm256_add_pd(a2, a3)));
+        for (; i < n; ++i) s += static_cast<double>(first[i]);
+        return s;
+    }
+
+    inline float hsum(__m256 v) noexcept
+    {
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+        return _mm_cvtss_f32(s);
+    }
+
+    SIMDTL_TARGET_FMA float dot_f32_avx2(const float* a, const float* b, std::size_t n) noexcept
+    {
+        __m256 s0 = _mm256_setzero_ps(), s1 = s0, s2 = s0, s3 = s0;
+        std::size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            s0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), s0);
+            s1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), s1);
+            s2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 16), _mm256_loadu_ps(b + i + 16), s2);
+            s3 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 24), _mm256_loadu_ps(b + i + 24), s3);
+        }
+        for (; i + 8 <= n; i += 8) s0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), s0);
+        float s = hsum(_mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+        for (; i < n; ++i) s += a[i] * b[i];
+        return s;
+    }
+
+    SIMDTL_TARGET_FMA double dot_f64_avx2(const double* a, const double* b, std::size_t n) noexcept
+    {
+        __m256d s0 = _mm256_setzero_pd(), s1 = s0, s2 = s0, s3 = s0;
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), s0);
+            s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), s1);
+            s2 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 8), _mm256_loadu_pd(b + i + 8), s2);
+            s3 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 12), _mm256_loadu_pd(b + i + 12), s3);
+        }
+        for (; i + 4 <= n; i += 4) s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), s0);
+        double s = hsum(_mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+        for (; i < n; ++i) s += a[i] * b[i];
+        return s;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_reduce_wide_i8(isa_level::avx2, &reduce_wide_i8_avx2);
+            register_reduce_wide_u8(isa_level::avx2, &reduce_wide_u8_avx2);
+            register_reduce_wide_i16(isa_level::avx2, &reduce_wide_i16_avx2);
+            register_reduce_wide_u16(isa_level::avx2, &reduce_wide_u16_avx2);
+            register_reduce_wide_f32(isa_level::avx2, &reduce_wide_f32_avx2);
+            if (detect_cpu_features().fma)
+            {
+                register_dot_f32(isa_level::avx2, &dot_f32_avx2);
+                register_dot_f64(isa_level::avx2, &dot_f64_avx2);
+            }
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,188 @@
+// ── Opt-in AVX-512 widening-sum and dot kernels (self-registering) ─────────────
+// The AVX2 scheme at twice the width (vpsadbw / vpmaddwd are AVX512BW): bytes
+// through vpsadbw into u64 lanes, 16-bit through vpmaddwd into int32 lanes
+// flushed to int64 every kFlush steps, float through vcvtps2pd. Horizontal
+// sums go through memory (_mm512_reduce_add_* trips GCC 12's
+// -Wmaybe-uninitialized, and they run once per call); the all-ones zero-masked
+// forms of vcvtps2pd and the 64-bit shifts dodge the same warning.
+// Dot products: vfmadd (part of AVX512F) into four accumulators, then one
+// zero-masked FMA step for the tail.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    // 32-element vpmaddwd steps per flush: 2^14 * 2^16 = 2^30 < 2^31.
+    constexpr std::size_t kFlush = std::size_t{1} << 14;
+
+    inline std::int64_t hsum64(__m512i v) noexcept
+    {
+        alignas(64) std::int64_t t[8];
+        _mm512_store_si512(t, v);
+        return ((t[0] + t[1]) + (t[2] + t[3])) + ((t[4] + t[5]) + (t[6] + t[7]));
+    }
+
+    inline double hsum(__m512d v) noexcept
+    {
+        alignas(64) double t[8];
+        _mm512_store_pd(t, v);
+        return ((t[0] + t[1]) + (t[2] + t[3])) + ((t[4] + t[5]) + (t[6] + t[7]));
+    }
+
+    inline std::uint64_t sad_sum(const std::uint8_t* p, std::size_t n, __m512i flip, std::size_t& done) noexcept
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        __m512i a0 = zero, a1 = zero;
+        std::size_t i = 0;
+        for (; i + 128 <= n; i += 128)
+        {
+            a0 = _mm512_add_epi64(a0, _mm512_sad_epu8(_mm512_xor_si512(_mm512_loadu_si512(p + i), flip), zero));
+            a1 = _mm512_add_epi64(a1, _mm512_sad_epu8(_mm512_xor_si512(_mm512_loadu_si512(p + i + 64), flip), zero));
+        }
+        if (i + 64 <= n)
+        {
+            a0 = _mm512_add_epi64(a0, _mm512_sad_epu8(_mm512_xor_si512(_mm512_loadu_si512(p + i), flip), zero));
+            i += 64;
+        }
+        done = i;
+        return static_cast<std::uint64_t>(hsum64(_mm512_add_epi64(a0, a1)));
+    }
+
+    std::uint64_t reduce_wide_u8_avx512(const std::uint8_t* first, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        std::uint64_t s = sad_sum(first, n, _mm512_setzero_si512(), i);
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    std::int64_t reduce_wide_i8_avx512(const std::int8_t* first, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        const std::uint64_t biased = sad_sum(reinterpret_cast<const std::uint8_t*>(first), n, _mm512_set1_epi8(-128), i);
+        std::int64_t s = static_cast<std::int64_t>(biased) - 128 * static_cast<std::int64_t>(i);
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    inline std::int64_t madd_sum(const std::int16_t* p, std::size_t n, __m512i flip, std::size_t& done) noexcept
+    {
+        const __m512i ones = _mm512_set1_epi16(1);
+        __m512i wide = _mm512_setzero_si512();
+        std::size_t i = 0;
+        while (i + 32 <= n)
+        {
+            __m512i a32 = _mm512_setzero_si512();
+            const std::size_t steps = (n - i) / 32 < kFlush ? (n - i) / 32 : kFlush;
+            for (std::size_t k = 0; k < steps; ++k, i += 32)
+                a32 = _mm512_add_epi32(a32, _mm512_madd_epi16(_mm512_xor_si512(_mm512_loadu_si512(p + i), flip), ones));
+            // Sign-extend the int32 lanes in place: low halves via shift pair, high via arithmetic shift.
+            wide = _mm512_add_epi64(wide, _mm512_maskz_srai_epi64(0xFF, _mm512_maskz_slli_epi64(0xFF, a32, 32), 32));
+            wide = _mm512_add_epi64(wide, _mm512_maskz_srai_epi64(0xFF, a32, 32));
+        }
+        done = i;
+        return hsum64(wide);
+    }
+
+    std::int64_t reduce_wide_i16_avx512(const std::int16_t* first, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        std::int64_t s = madd_sum(first, n, _mm512_setzero_si512(), i);
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    std::uint64_t reduce_wide_u16_avx512(const std::uint16_t* first, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        const std::int64_t biased = madd_sum(reinterpret_cast<const std::int16_t*>(first), n, _mm512_set1_epi16(-32768), i);
+        std::uint64_t s = static_cast<std::uint64_t>(biased + 32768 * static_cast<std::int64_t>(i));
+        for (; i < n; ++i) s += first[i];
+        return s;
+    }
+
+    double reduce_wide_f32_avx512(const float* first, std::size_t n) noexcept
+    {
+        __m512d a0 = _mm512_setzero_pd(), a1 = a0, a2 = a0, a3 = a0;
+        std::size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            a0 = _mm512_add_pd(a0, _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(first + i)));
+            a1 = _mm512_add_pd(a1, _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(first + i + 8)));
+            a2 = _mm512_add_pd(a2, _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(first + i + 16)));
+            a3 = _mm512_add_pd(a3, _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(first + i + 24)));
+        }
+        for (; i + 8 <= n; i += 8) a0 = _mm512_add_pd(a0, _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(first + i)));
+        double s = hsum(_mm512_add_pd(_mm512_add_pd(a0, a1), _mm512_add_pd(a2, a3)));
+        for (; i < n; ++i) s += static_cast<double>(first[i]);
+        return s;
+    }
+
+    inline float hsum(__m512 v) noexcept
+    {
+        alignas(64) float t[16];
+        _mm512_store_ps(t, v);
+        for (std::size_t j = 0; j < 8; ++j) t[j] += t[j + 8];
+        for (std::size_t j = 0; j < 4; ++j) t[j] += t[j + 4];
+        return (t[0] + t[2]) + (t[1] + t[3]);
+    }
+
+    float dot_f32_avx512(const float* a, const float* b, std::size_t n) noexcept
+    {
+        __m512 s0 = _mm512_setzero_ps(), s1 = s0, s2 = s0, s3 = s0;
+        std::size_t i = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            s0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), s0);
+            s1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), s1);
+            s2 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 32), _mm512_loadu_ps(b + i + 32), s2);
+            s3 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 48), _mm512_loadu_ps(b + i + 48), s3);
+        }
+        for (; i + 16 <= n; i += 16) s0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), s0);
+        if (i < n)
+        {
+            const __mmask16 m = static_cast<__mmask16>((1u << (n - i)) - 1u);
+            s1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, a + i), _mm512_maskz_loadu_ps(m, b + i), s1);
+        }
+        return hsum(_mm512_add_ps(_mm512_add_ps(s0, s1), _mm512_add_ps(s2, s3)));
+    }
+
+    double dot_f64_avx512(const double* a, const double* b, std::size_t n) noexcept
+    {
+        __m512d s0 = _mm512_setzero_pd(), s1 = s0, s2 = s0, s3 = s0;
+        std::size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            s0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), s0);
+            s1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 8), _mm512_loadu_pd(b + i + 8), s1);
+            s2 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 16), _mm512_loadu_pd(b + i + 16), s2);
+            s3 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 24), _mm512_loadu_pd(b + i + 24), s3);
+        }
+        for (; i + 8 <= n; i += 8) s0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), s0);
+        if (i < n)
+        {
+            const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1u);
+            s1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, a + i), _mm512_maskz_loadu_pd(m, b + i), s1);
+        }
+        return hsum(_mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_reduce_wide_i8(isa_level::avx512, &reduce_wide_i8_avx512);
+            register_reduce_wide_u8(isa_level::avx512, &reduce_wide_u8_avx512);
+            register_reduce_wide_i16(isa_level::avx512, &reduce_wide_i16_avx512);
+            register_reduce_wide_u16(isa_level::avx512, &reduce_wide_u16_avx512);
+            register_reduce_wide_f32(isa_level::avx512, &reduce_wide_f32_avx512);
+            register_dot_f32(isa_level::avx512, &dot_f32_avx512);
+            register_dot_f64(isa_level::avx512, &dot_f64_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
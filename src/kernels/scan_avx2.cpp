@@ -0,0 +1,132 @@
+// ── Opt-in AVX2 prefix-sum kernels (self-registering) ─────────────────────────
+// Same scheme as the SSE2 kernels: log-step scan inside each 128-bit lane
+// (vpslldq + add), then the low lane's total is carried into the high lane
+// (broadcast within the lane + vperm2i128 with a zeroed low half), then the
+// running carry is added. Exclusive shifts the local scan one element across
+// the whole register (vpermd / vpermq + blend with zero).
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    // 32-bit lanes on the integer side; floats reuse these shuffles via casts.
+    inline __m256i local32(__m256i x, __m256i (*add)(__m256i, __m256i)) noexcept
+    {
+        x = add(x, _mm256_slli_si256(x, 4));
+        x = add(x, _mm256_slli_si256(x, 8));
+        const __m256i lo_total = _mm256_shuffle_epi32(x, 0xFF);
+        return add(x, _mm256_permute2x128_si256(lo_total, lo_total, 0x08));
+    }
+
+    inline __m256i local64(__m256i x, __m256i (*add)(__m256i, __m256i)) noexcept
+    {
+        x = add(x, _mm256_slli_si256(x, 8));
+        const __m256i lo_total = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 1, 0, 0));
+        return add(x, _mm256_blend_epi32(_mm256_setzero_si256(), lo_total, 0xF0));
+    }
+
+    inline __m256i shift1_32(__m256i x) noexcept
+    {
+        const __m256i p = _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+        return _mm256_blend_epi32(p, _mm256_setzero_si256(), 0x01);
+    }
+
+    inline __m256i shift1_64(__m256i x) noexcept
+    {
+        return _mm256_blend_epi32(_mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 0)), _mm256_setzero_si256(), 0x03);
+    }
+
+    inline __m256i add_i32(__m256i a, __m256i b) noexcept { return _mm256_add_epi32(a, b); }
+    inline __m256i add_i64(__m256i a, __m256i b) noexcept { return _mm256_add_epi64(a, b); }
+    inline __m256i add_f32(__m256i a, __m256i b) noexcept
+    { return _mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+    inline __m256i add_f64(__m256i a, __m256i b) noexcept
+    { return _mm256_castpd_si256(_mm256_add_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b))); }
+
+    // Values travel as __m256i bit patterns; T only matters for loads and the tail.
+    template <class T> struct ops;
+    template <> struct ops<std::int32_t>
+    {
+        static constexpr std::size_t W = 8;
+        static __m256i add(__m256i a, __m256i b) noexcept { return add_i32(a, b); }
+        static __m256i local(__m256i x) noexcept { return local32(x, &add_i32); }
+        static __m256i shift1(__m256i x) noexcept { return shift1_32(x); }
+        static __m256i last(__m256i x) noexcept { return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7)); }
+        static __m256i set1(std::int32_t v) noexcept { return _mm256_set1_epi32(v); }
+        static std::int32_t first(__m256i x) noexcept { return _mm_cvtsi128_si32(_mm256_castsi256_si128(x)); }
+    };
+    template <> struct ops<std::int64_t>
+    {
+        static constexpr std::size_t W = 4;
+        static __m256i add(__m256i a, __m256i b) noexcept { return add_i64(a, b); }
+        static __m256i local(__m256i x) noexcept { return local64(x, &add_i64); }
+        static __m256i shift1(__m256i x) noexcept { return shift1_64(x); }
+        static __m256i last(__m256i x) noexcept { return _mm256_permute4x64_epi64(x, 0xFF); }
+        static __m256i set1(std::int64_t v) noexcept { return _mm256_set1_epi64x(v); }
+        static std::int64_t first(__m256i x) noexcept { return _mm_cvtsi128_si64(_mm256_castsi256_si128(x)); }
+    };
+    template <> struct ops<float>
+    {
+        static constexpr std::size_t W = 8;
+        static __m256i add(__m256i a, __m256i b) noexcept { return add_f32(a, b); }
+        static __m256i local(__m256i x) noexcept { return local32(x, &add_f32); }
+        static __m256i shift1(__m256i x) noexcept { return shift1_32(x); }
+        static __m256i last(__m256i x) noexcept { return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7)); }
+        static __m256i set1(float v) noexcept { return _mm256_castps_si256(_mm256_set1_ps(v)); }
+        static float first(__m256i x) noexcept { return _mm256_cvtss_f32(_mm256_castsi256_ps(x)); }
+    };
+    template <> struct ops<double>
+    {
+        static constexpr std::size_t W = 4;
+        static __m256i add(__m256i a, __m256i b) noexcept { return add_f64(a, b); }
+        static __m256i local(__m256i x) noexcept { return local64(x, &add_f64); }
+        static __m256i shift1(__m256i x) noexcept { return shift1_64(x); }
+        static __m256i last(__m256i x) noexcept { return _mm256_permute4x64_epi64(x, 0xFF); }
+        static __m256i set1(double v) noexcept { return _mm256_castpd_si256(_mm256_set1_pd(v)); }
+        static double first(__m256i x) noexcept { return _mm256_cvtsd_f64(_mm256_castsi256_pd(x)); }
+    };
+
+    template <class T, bool Exclusive>
+    void scan(const T* in, std::size_t n, T* out, T init) noexcept
+    {
+        using O = ops<T>;
+        __m256i carry = O::set1(init);
+        std::size_t i = 0;
+        for (; i + O::W <= n; i += O::W)
+        {
+            const __m256i x = O::local(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), O::add(carry, Exclusive ? O::shift1(x) : x));
+            carry = O::add(carry, O::last(x));
+        }
+        T acc = O::first(carry);
+        for (; i < n; ++i)
+        {
+            const T x = in[i];
+            if constexpr (Exclusive) { out[i] = acc; acc += x; }
+            else                     { acc += x; out[i] = acc; }
+        }
+    }
+
+    template <class T>
+    void scan_avx2(const T* in, std::size_t n, T* out, T init, bool exclusive) noexcept
+    {
+        if (exclusive) scan<T, true>(in, n, out, init);
+        else           scan<T, false>(in, n, out, init);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_scan_i32(isa_level::avx2, &scan_avx2<std::int32_t>);
+            register_scan_i64(isa_level::avx2, &scan_avx2<std::int64_t>);
+            register_scan_f32(isa_level::avx2, &scan_avx2<float>);
+            register_scan_f64(isa_level::avx2, &scan_avx2<double>);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,119 @@
+// ── Opt-in AVX-512 prefix-sum kernels (self-registering) ──────────────────────
+// Log-step in-register scan across the whole zmm: step s adds the register
+// shifted up by s lanes, built with a zero-masked vpermd/vpermq (lanes < s
+// zeroed) — 4 steps for 16 x 32-bit, 3 for 8 x 64-bit. Then + running carry.
+// The tail is the same step on a zero-masked load with a masked store, so there
+// is no scalar epilogue. (valign would do the shifts but trips GCC 12's
+// -Wmaybe-uninitialized; all permutes here are masked forms for the same reason.)
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    // idx[s] = lane j reads lane j - s (lanes below s are masked to zero).
+    inline __m512i up_idx32(int s) noexcept
+    {
+        return _mm512_sub_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(s));
+    }
+    inline __m512i up_idx64(int s) noexcept
+    {
+        return _mm512_sub_epi64(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7), _mm512_set1_epi64(s));
+    }
+
+    template <class T> struct ops;
+    template <> struct ops<std::int32_t>
+    {
+        static constexpr std::size_t W = 16;
+        using V = __m512i;
+        static V add(V a, V b) noexcept { return _mm512_add_epi32(a, b); }
+        static V up(V x, __m512i idx, int s) noexcept { return _mm512_maskz_permutexvar_epi32(static_cast<__mmask16>(0xFFFFu << s), idx, x); }
+        static V bcast_last(V x) noexcept { return _mm512_maskz_permutexvar_epi32(0xFFFF, _mm512_set1_epi32(15), x); }
+        static V set1(std::int32_t v) noexcept { return _mm512_set1_epi32(v); }
+        static V load(const std::int32_t* p, std::size_t r) noexcept { return _mm512_maskz_loadu_epi32(static_cast<__mmask16>((1u << r) - 1u), p); }
+        static void store(std::int32_t* p, std::size_t r, V v) noexcept { _mm512_mask_storeu_epi32(p, static_cast<__mmask16>((1u << r) - 1u), v); }
+    };
+    template <> struct ops<std::int64_t>
+    {
+        static constexpr std::size_t W = 8;
+        using V = __m512i;
+        static V add(V a, V b) noexcept { return _mm512_add_epi64(a, b); }
+        static V up(V x, __m512i idx, int s) noexcept { return _mm512_maskz_permutexvar_epi64(static_cast<__mmask8>(0xFFu << s), idx, x); }
+        static V bcast_last(V x) noexcept { return _mm512_maskz_permutexvar_epi64(0xFF, _mm512_set1_epi64(7), x); }
+        static V set1(std::int64_t v) noexcept { return _mm512_set1_epi64(v); }
+        static V load(const std::int64_t* p, std::size_t r) noexcept { return _mm512_maskz_loadu_epi64(static_cast<__mmask8>((1u << r) - 1u), p); }
+        static void store(std::int64_t* p, std::size_t r, V v) noexcept { _mm512_mask_storeu_epi64(p, static_cast<__mmask8>((1u << r) - 1u), v); }
+    };
+    template <> struct ops<float>
+    {
+        static constexpr std::size_t W = 16;
+        using V = __m512;
+        static V add(V a, V b) noexcept { return _mm512_add_ps(a, b); }
+        static V up(V x, __m512i idx, int s) noexcept { return _mm512_maskz_permutexvar_ps(static_cast<__mmask16>(0xFFFFu << s), idx, x); }
+        static V bcast_last(V x) noexcept { return _mm512_maskz_permutexvar_ps(0xFFFF, _mm512_set1_epi32(15), x); }
+        static V set1(float v) noexcept { return _mm512_set1_ps(v); }
+        static V load(const float* p, std::size_t r) noexcept { return _mm512_maskz_loadu_ps(static_cast<__mmask16>((1u << r) - 1u), p); }
+        static void store(float* p, std::size_t r, V v) noexcept { _mm512_mask_storeu_ps(p, static_cast<__mmask16>((1u << r) - 1u), v); }
+    };
+    template <> struct ops<double>
+    {
+        static constexpr std::size_t W = 8;
+        using V = __m512d;
+        static V add(V a, V b) noexcept { return _mm512_add_pd(a, b); }
+        static V up(V x, __m512i idx, int s) noexcept { return _mm512_maskz_permutexvar_pd(static_cast<__mmask8>(0xFFu << s), idx, x); }
+        static V bcast_last(V x) noexcept { return _mm512_maskz_permutexvar_pd(0xFF, _mm512_set1_epi64(7), x); }
+        static V set1(double v) noexcept { return _mm512_set1_pd(v); }
+        static V load(const double* p, std::size_t r) noexcept { return _mm512_maskz_loadu_pd(static_cast<__mmask8>((1u << r) - 1u), p); }
+        static void store(double* p, std::size_t r, V v) noexcept { _mm512_mask_storeu_pd(p, static_cast<__mmask8>((1u << r) - 1u), v); }
+    };
+
+    template <class T, bool Exclusive>
+    void scan(const T* in, std::size_t n, T* out, T init) noexcept
+    {
+        using O = ops<T>;
+        using V = typename O::V;
+        constexpr bool wide = sizeof(T) == 4;
+        const __m512i i1 = wide ? up_idx32(1) : up_idx64(1);
+        const __m512i i2 = wide ? up_idx32(2) : up_idx64(2);
+        const __m512i i4 = wide ? up_idx32(4) : up_idx64(4);
+        const __m512i i8 = up_idx32(8);   // used by the 16-lane (32-bit) scans only
+        auto local = [&](V x) noexcept {
+            x = O::add(x, O::up(x, i1, 1));
+            x = O::add(x, O::up(x, i2, 2));
+            x = O::add(x, O::up(x, i4, 4));
+            if constexpr (wide) x = O::add(x, O::up(x, i8, 8));
+            return x;
+        };
+        auto step = [&](std::size_t i, std::size_t r, V& carry) noexcept {
+            const V x = local(O::load(in + i, r));
+            O::store(out + i, r, O::add(carry, Exclusive ? O::up(x, i1, 1) : x));
+            carry = O::add(carry, O::bcast_last(x));
+        };
+        V carry = O::set1(init);
+        std::size_t i = 0;
+        for (; i + O::W <= n; i += O::W) step(i, O::W, carry);   // constant all-ones masks
+        if (i < n) step(i, n - i, carry);
+    }
+
+    template <class T>
+    void scan_avx512(const T* in, std::size_t n, T* out, T init, bool exclusive) noexcept
+    {
+        if (exclusive) scan<T, true>(in, n, out, init);
+        else           scan<T, false>(in, n, out, init);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_scan_i32(isa_level::avx512, &scan_avx512<std::int32_t>);
+            register_scan_i64(isa_level::avx512, &scan_avx512<std::int64_t>);
+            register_scan_f32(isa_level::avx512, &scan_avx512<float>);
+            register_scan_f64(isa_level::avx512, &scan_avx512<double>);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,112 @@
+// ── Opt-in SSE2 prefix-sum kernels (self-registering) ─────────────────────────
+// Per register: a log-step in-register scan (pslldq by 1, 2 lanes + add), then
+// the running carry — a broadcast of the previous register's last sum — is
+// added. Only that one add per register is serial; the log-steps of successive
+// registers overlap. Exclusive = the local scan shifted one lane, then + carry.
+// Built without extra /arch flags: SSE2 is the x86-64 baseline.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <emmintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    template <class T> struct ops;
+    template <> struct ops<std::int32_t>
+    {
+        using T = std::int32_t; using V = __m128i; static constexpr std::size_t W = 4;
+        static V load(const T* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const V*>(p)); }
+        static void store(T* p, V v) noexcept { _mm_storeu_si128(reinterpret_cast<V*>(p), v); }
+        static V set1(T x) noexcept { return _mm_set1_epi32(x); }
+        static V add(V a, V b) noexcept { return _mm_add_epi32(a, b); }
+        static V local(V x) noexcept { x = add(x, _mm_slli_si128(x, 4)); return add(x, _mm_slli_si128(x, 8)); }
+        static V shift1(V x) noexcept { return _mm_slli_si128(x, 4); }
+        static V last(V x) noexcept { return _mm_shuffle_epi32(x, 0xFF); }
+        static T first(V x) noexcept { return _mm_cvtsi128_si32(x); }
+    };
+
+    template <> struct ops<std::int64_t>
+    {
+        using T = std::int64_t; using V = __m128i; static constexpr std::size_t W = 2;
+        static V load(const T* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const V*>(p)); }
+        static void store(T* p, V v) noexcept { _mm_storeu_si128(reinterpret_cast<V*>(p), v); }
+        static V set1(T x) noexcept { return _mm_set1_epi64x(x); }
+        static V add(V a, V b) noexcept { return _mm_add_epi64(a, b); }
+        static V local(V x) noexcept { return add(x, _mm_slli_si128(x, 8)); }
+        static V shift1(V x) noexcept { return _mm_slli_si128(x, 8); }
+        static V last(V x) noexcept { return _mm_shuffle_epi32(x, 0xEE); }
+        static T first(V x) noexcept { return _mm_cvtsi128_si64(x); }
+    };
+
+    template <> struct ops<float>
+    {
+        using T = float; using V = __m128; static constexpr std::size_t W = 4;
+        static V load(const T* p) noexcept { return _mm_loadu_ps(p); }
+        static void store(T* p, V v) noexcept { _mm_storeu_ps(p, v); }
+        static V set1(T x) noexcept { return _mm_set1_ps(x); }
+        static V add(V a, V b) noexcept { return _mm_add_ps(a, b); }
+        static V local(V x) noexcept
+        {
+            x = add(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+            return add(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+        }
+        static V shift1(V x) noexcept { return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)); }
+        static V last(V x) noexcept { return _mm_shuffle_ps(x, x, 0xFF); }
+        static T first(V x) noexcept { return _mm_cvtss_f32(x); }
+    };
+
+    template <> struct ops<double>
+    {
+        using T = double; using V = __m128d; static constexpr std::size_t W = 2;
+        static V load(const T* p) noexcept { return _mm_loadu_pd(p); }
+        static void store(T* p, V v) noexcept { _mm_storeu_pd(p, v); }
+        static V set1(T x) noexcept { return _mm_set1_pd(x); }
+        static V add(V a, V b) noexcept { return _mm_add_pd(a, b); }
+        static V local(V x) noexcept { return add(x, shift1(x)); }
+        static V shift1(V x) noexcept { return _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(x), 8)); }
+        static V last(V x) noexcept { return _mm_unpackhi_pd(x, x); }
+        static T first(V x) noexcept { return _mm_cvtsd_f64(x); }
+    };
+
+    template <class T, bool Exclusive>
+    void scan(const T* in, std::size_t n, T* out, T init) noexcept
+    {
+        using O = ops<T>;
+        auto carry = O::set1(init);
+        std::size_t i = 0;
+        for (; i + O::W <= n; i += O::W)
+        {
+            const auto x = O::local(O::load(in + i));
+            O::store(out + i, O::add(carry, Exclusive ? O::shift1(x) : x));
+            carry = O::add(carry, O::last(x));
+        }
+        T acc = O::first(carry);
+        for (; i < n; ++i)
+        {
+            const T x = in[i];
+            if constexpr (Exclusive) { out[i] = acc; acc += x; }
+            else                     { acc += x; out[i] = acc; }
+        }
+    }
+
+    template <class T>
+    void scan_sse2(const T* in, std::size_t n, T* out, T init, bool exclusive) noexcept
+    {
+        if (exclusive) scan<T, true>(in, n, out, init);
+        else           scan<T, false>(in, n, out, init);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_scan_i32(isa_level::sse2, &scan_sse2<std::int32_t>);
+            register_scan_i64(isa_level::sse2, &scan_sse2<std::int64_t>);
+            register_scan_f32(isa_level::sse2, &scan_sse2<float>);
+            register_scan_f64(isa_level::sse2, &scan_sse2<double>);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,76 @@
+// ── Opt-in AVX2 batched lower_bound for int32 (self-registering) ──────────────
+// 32 keys (four registers) descend the array in lockstep: each halving round is
+// four vpgatherdd probes, signed compares, and masked adds of `half` to the
+// positions — no branches, and 32 independent misses in flight per round.
+// Gather indices are 32-bit, so arrays longer than INT32_MAX take the scalar path.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    std::size_t lower_bound_scalar(const std::int32_t* a, std::size_t n, std::int32_t key) noexcept
+    {
+        if (n == 0) return 0;
+        std::size_t base = 0, len = n;
+        while (len > 1)
+        {
+            const std::size_t half = len / 2;
+            base += (a[base + half] < key) ? half : 0;
+            len -= half;
+        }
+        return base + ((a[base] < key) ? 1 : 0);
+    }
+
+    void lower_bound_many_i32_avx2(const std::int32_t* a, std::size_t n, const std::int32_t* keys,
+                                   std::size_t m, std::size_t* out) noexcept
+    {
+        std::size_t j = 0;
+        if (n != 0 && n <= static_cast<std::size_t>(INT32_MAX))
+        {
+            const int* base = reinterpret_cast<const int*>(a);
+            constexpr int R = 4;                       // registers (x8 keys) per group
+            for (; j + 8 * R <= m; j += 8 * R)
+            {
+                __m256i k[R], p[R];
+                for (int r = 0; r < R; ++r)
+                {
+                    k[r] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + j + 8 * r));
+                    p[r] = _mm256_setzero_si256();
+                }
+                for (std::size_t len = n; len > 1;)
+                {
+                    const std::size_t half = len / 2;
+                    const __m256i h = _mm256_set1_epi32(static_cast<int>(half));
+                    for (int r = 0; r < R; ++r)
+                    {
+                        const __m256i v = _mm256_i32gather_epi32(base, _mm256_add_epi32(p[r], h), 4);
+                        p[r] = _mm256_add_epi32(p[r], _mm256_and_si256(_mm256_cmpgt_epi32(k[r], v), h));
+                    }
+                    len -= half;
+                }
+                alignas(32) std::int32_t pos[8 * R];
+                for (int r = 0; r < R; ++r)
+                {
+                    // Last step: +1 where the surviving element is still < key (cmpgt = -1).
+                    p[r] = _mm256_sub_epi32(p[r], _mm256_cmpgt_epi32(k[r], _mm256_i32gather_epi32(base, p[r], 4)));
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(pos + 8 * r), p[r]);
+                }
+                for (int t = 0; t < 8 * R; ++t) out[j + t] = static_cast<std::size_t>(pos[t]);
+            }
+        }
+        for (; j < m; ++j) out[j] = lower_bound_scalar(a, n, keys[j]);
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_lower_bound_many_i32(isa_level::avx2, &lower_bound_many_i32_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,286 @@
+// ── Opt-in AVX2 batched-similarity kernels (self-registering) ─────────────────
+// One query against a row-major block, four rows at a time: each query vector
+// is loaded once and reused for four rows. float: vfmadd, with the dim loop
+// unrolled twice for dot / L2² (eight accumulator chains cover the FMA
+// latency; cosine already has eight, dot + row norm). int8: vpmovsxbw to int16,
+// then vpmaddwd (the product pairs, or the squared int16 differences) into
+// int32 lanes, summed into int64 every kFlush elements (32768 * 255² < 2^31)
+// so any dim is exact. Functions using FMA are tagged for it
+// and registered only when CPUID reports FMA3; the int8 ones need plain AVX2.
+#include "simdtl/platform/cpu.hpp"
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_FMA __attribute__((target("fma")))
+#else
+#  define SIMDTL_TARGET_FMA
+#endif
+
+namespace
+{
+    enum class metric { dot, l2sq, cosine };
+
+    // int8 elements per int32 partial sum; same bound as simdtl::detail::i8_flush.
+    constexpr std::size_t kFlush = 32768;
+
+    inline float hsum(__m256 v) noexcept
+    {
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+        return _mm_cvtss_f32(s);
+    }
+
+    inline std::int32_t hsum(__m256i v) noexcept
+    {
+        __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+        return _mm_cvtsi128_si32(s);
+    }
+
+    // Same formulas as simdtl::detail::cosine_finish.
+    inline float cosine_finish(float d, float qq, float rr) noexcept
+    {
+        return qq > 0.0f && rr > 0.0f ? d / (std::sqrt(qq) * std::sqrt(rr)) : 0.0f;
+    }
+
+    inline float cosine_finish(std::int64_t d, std::int64_t qq, std::int64_t rr) noexcept
+    {
+        return qq > 0 && rr > 0 ? static_cast<float>(double(d) / std::sqrt(double(qq) * double(rr))) : 0.0f;
+    }
+
+    // ---- float ----------------------------------------------------------------
+
+    template <metric M>
+    SIMDTL_TARGET_FMA inline void step(__m256 q, __m256 r, __m256& acc, __m256& nrm) noexcept
+    {
+        if constexpr (M == metric::l2sq)
+        {
+            const __m256 d = _mm256_sub_ps(r, q);
+            acc = _mm256_fmadd_ps(d, d, acc);
+        }
+        else
+        {
+            acc = _mm256_fmadd_ps(q, r, acc);
+            if constexpr (M == metric::cosine) nrm = _mm256_fmadd_ps(r, r, nrm);
+        }
+    }
+
+    template <metric M>
+    inline void step(float q, float r, float& acc, float& nrm) noexcept
+    {
+        if constexpr (M == metric::l2sq) acc += (r - q) * (r - q);
+        else
+        {
+            acc += q * r;
+            if constexpr (M == metric::cosine) nrm += r * r;
+        }
+    }
+
+    template <metric M>
+    inline float finish(float acc, float nrm, float qq) noexcept
+    {
+        if constexpr (M == metric::cosine) return cosine_finish(acc, qq, nrm);
+        else return acc;
+    }
+
+    SIMDTL_TARGET_FMA float self_dot(const float* q, std::size_t dim) noexcept
+    {
+        __m256 a = _mm256_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 8 <= dim; i += 8)
+        {
+            const __m256 v = _mm256_loadu_ps(q + i);
+            a = _mm256_fmadd_ps(v, v, a);
+        }
+        float s = hsum(a);
+        for (; i < dim; ++i) s += q[i] * q[i];
+        return s;
+    }
+
+    template <metric M>
+    SIMDTL_TARGET_FMA void many_f32(const float* q, const float* base, std::size_t rows, std::size_t dim, float* out) noexcept
+    {
+        const float qq = M == metric::cosine ? self_dot(q, dim) : 0.0f;
+        std::size_t r = 0;
+        for (; r + 4 <= rows; r += 4)
+        {
+            const float* p0 = base + r * dim;
+            const float* p1 = p0 + dim;
+            const float* p2 = p1 + dim;
+            const float* p3 = p2 + dim;
+            const __m256 z = _mm256_setzero_ps();
+            __m256 a0 = z, a1 = z, a2 = z, a3 = z, n0 = z, n1 = z, n2 = z, n3 = z;
+            std::size_t i = 0;
+            if constexpr (M != metric::cosine)
+            {
+                // Second accumulator set (n*) for the odd half of each 16-wide step.
+                for (; i + 16 <= dim; i += 16)
+                {
+                    const __m256 qa = _mm256_loadu_ps(q + i), qb = _mm256_loadu_ps(q + i + 8);
+                    step<M>(qa, _mm256_loadu_ps(p0 + i), a0, n0);
+                    step<M>(qa, _mm256_loadu_ps(p1 + i), a1, n1);
+                    step<M>(qa, _mm256_loadu_ps(p2 + i), a2, n2);
+                    step<M>(qa, _mm256_loadu_ps(p3 + i), a3, n3);
+                    step<M>(qb, _mm256_loadu_ps(p0 + i + 8), n0, a0);
+                    step<M>(qb, _mm256_loadu_ps(p1 + i + 8), n1, a1);
+                    step<M>(qb, _mm256_loadu_ps(p2 + i + 8), n2, a2);
+                    step<M>(qb, _mm256_loadu_ps(p3 + i + 8), n3, a3);
+                }
+                a0 = _mm256_add_ps(a0, n0); a1 = _mm256_add_ps(a1, n1);
+                a2 = _mm256_add_ps(a2, n2); a3 = _mm256_add_ps(a3, n3);
+            }
+            for (; i + 8 <= dim; i += 8)
+            {
+                const __m256 qv = _mm256_loadu_ps(q + i);
+                step<M>(qv, _mm256_loadu_ps(p0 + i), a0, n0);
+                step<M>(qv, _mm256_loadu_ps(p1 + i), a1, n1);
+                step<M>(qv, _mm256_loadu_ps(p2 + i), a2, n2);
+                step<M>(qv, _mm256_loadu_ps(p3 + i), a3, n3);
+            }
+            float s0 = hsum(a0), s1 = hsum(a1), s2 = hsum(a2), s3 = hsum(a3);
+            float m0 = hsum(n0), m1 = hsum(n1), m2 = hsum(n2), m3 = hsum(n3);
+            for (; i < dim; ++i)
+            {
+                step<M>(q[i], p0[i], s0, m0);
+                step<M>(q[i], p1[i], s1, m1);
+                step<M>(q[i], p2[i], s2, m2);
+                step<M>(q[i], p3[i], s3, m3);
+            }
+            out[r]     = finish<M>(s0, m0, qq);
+            out[r + 1] = finish<M>(s1, m1, qq);
+            out[r + 2] = finish<M>(s2, m2, qq);
+            out[r + 3] = finish<M>(s3, m3, qq);
+        }
+        for (; r < rows; ++r)
+        {
+            const float* p = base + r * dim;
+            __m256 a = _mm256_setzero_ps(), n = a;
+            std::size_t i = 0;
+            for (; i + 8 <= dim; i += 8) step<M>(_mm256_loadu_ps(q + i), _mm256_loadu_ps(p + i), a, n);
+            float s = hsum(a), m = hsum(n);
+            for (; i < dim; ++i) step<M>(q[i], p[i], s, m);
+            out[r] = finish<M>(s, m, qq);
+        }
+    }
+
+    // ---- int8 -----------------------------------------------------------------
+
+    inline __m256i widen(const std::int8_t* p) noexcept
+    {
+        return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    template <metric M>
+    inline void step(__m256i q, __m256i r, __m256i& acc, __m256i& nrm) noexcept
+    {
+        if constexpr (M == metric::l2sq)
+        {
+            const __m256i d = _mm256_sub_epi16(r, q);
+            acc = _mm256_add_epi32(acc, _mm256_madd_epi16(d, d));
+        }
+        else
+        {
+            acc = _mm256_add_epi32(acc, _mm256_madd_epi16(q, r));
+            if constexpr (M == metric::cosine) nrm = _mm256_add_epi32(nrm, _mm256_madd_epi16(r, r));
+        }
+    }
+
+    template <metric M>
+    inline void step(std::int32_t q, std::int32_t r, std::int64_t& acc, std::int64_t& nrm) noexcept
+    {
+        if constexpr (M == metric::l2sq) acc += (r - q) * (r - q);
+        else
+        {
+            acc += q * r;
+            if constexpr (M == metric::cosine) nrm += r * r;
+        }
+    }
+
+    template <metric M, class Out>
+    void many_i8(const std::int8_t* q, const std::int8_t* base, std::size_t rows, std::size_t dim, Out* out) noexcept
+    {
+        const std::size_t body = dim - dim % 16;
+        std::int64_t qq = 0;
+        if constexpr (M == metric::cosine)
+            for (std::size_t i = 0; i < dim; ++i) qq += q[i] * q[i];
+        auto put = [&](std::size_t r, std::int64_t s, std::int64_t m) {
+            if constexpr (M == metric::cosine) out[r] = cosine_finish(s, qq, m);
+            else out[r] = s;
+        };
+        std::size_t r = 0;
+        for (; r + 4 <= rows; r += 4)
+        {
+            const std::int8_t* p0 = base + r * dim;
+            const std::int8_t* p1 = p0 + dim;
+            const std::int8_t* p2 = p1 + dim;
+            const std::int8_t* p3 = p2 + dim;
+            std::int64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0, m0 = 0, m1 = 0, m2 = 0, m3 = 0;
+            std::size_t i = 0;
+            while (i < body)
+            {
+                const std::size_t end = body - i < kFlush ? body : i + kFlush;
+                const __m256i z = _mm256_setzero_si256();
+                __m256i a0 = z, a1 = z, a2 = z, a3 = z, n0 = z, n1 = z, n2 = z, n3 = z;
+                for (; i < end; i += 16)
+                {
+                    const __m256i qv = widen(q + i);
+                    step<M>(qv, widen(p0 + i), a0, n0);
+                    step<M>(qv, widen(p1 + i), a1, n1);
+                    step<M>(qv, widen(p2 + i), a2, n2);
+                    step<M>(qv, widen(p3 + i), a3, n3);
+                }
+                s0 += hsum(a0); s1 += hsum(a1); s2 += hsum(a2); s3 += hsum(a3);
+                m0 += hsum(n0); m1 += hsum(n1); m2 += hsum(n2); m3 += hsum(n3);
+            }
+            for (; i < dim; ++i)
+            {
+                step<M>(q[i], p0[i], s0, m0);
+                step<M>(q[i], p1[i], s1, m1);
+                step<M>(q[i], p2[i], s2, m2);
+                step<M>(q[i], p3[i], s3, m3);
+            }
+            put(r, s0, m0); put(r + 1, s1, m1); put(r + 2, s2, m2); put(r + 3, s3, m3);
+        }
+        for (; r < rows; ++r)
+        {
+            const std::int8_t* p = base + r * dim;
+            std::int64_t s = 0, m = 0;
+            std::size_t i = 0;
+            while (i < body)
+            {
+                const std::size_t end = body - i < kFlush ? body : i + kFlush;
+                __m256i a = _mm256_setzero_si256(), n = a;
+                for (; i < end; i += 16) step<M>(widen(q + i), widen(p + i), a, n);
+                s += hsum(a);
+                m += hsum(n);
+            }
+            for (; i < dim; ++i) step<M>(q[i], p[i], s, m);
+            put(r, s, m);
+        }
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            if (detect_cpu_features().fma)
+            {
+                register_dot_many_f32(isa_level::avx2, &many_f32<metric::dot>);
+                register_l2sq_many_f32(isa_level::avx2, &many_f32<metric::l2sq>);
+                register_cosine_many_f32(isa_level::avx2, &many_f32<metric::cosine>);
+            }
+            register_dot_many_i8(isa_level::avx2, &many_i8<metric::dot, std::int64_t>);
+            register_l2sq_many_i8(isa_level::avx2, &many_i8<metric::l2sq, std::int64_t>);
+            register_cosine_many_i8(isa_level::avx2, &many_i8<metric::cosine, float>);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
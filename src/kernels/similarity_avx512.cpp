@@ -0,0 +1,278 @@
+// ── Opt-in AVX-512 batched-similarity kernels (self-registering) ──────────────
+// The AVX2 scheme at twice the width: four rows per query load, vfmadd for
+// float (dim loop unrolled twice for dot / L2²), vpmovsxbw + vpmaddwd for int8
+// (AVX512BW), flushed into int64 every kFlush elements as in the AVX2 TU.
+// The dim tail is one zero-masked step — zero lanes add nothing
+// to any of the three metrics — instead of a scalar loop. float cosine is
+// not registered here: with two FMA chains per row it measured ~20% slower
+// than the AVX2 kernel, which keeps that slot.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    enum class metric { dot, l2sq, cosine };
+
+    // int8 elements per int32 partial sum; same bound as simdtl::detail::i8_flush.
+    constexpr std::size_t kFlush = 32768;
+
+    // In registers, not through memory as in the other AVX-512 TUs: these run
+    // once per row, not once per call. (All-ones masked extracts for both
+    // halves: GCC 12 spells the 512->256 casts as extracts that trip its
+    // -Wmaybe-uninitialized.)
+    inline float hsum(__m512 v) noexcept
+    {
+        const __m256 h = _mm256_add_ps(_mm512_maskz_extractf32x8_ps(0xFF, v, 0), _mm512_maskz_extractf32x8_ps(0xFF, v, 1));
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+        return _mm_cvtss_f32(s);
+    }
+
+    inline std::int32_t hsum(__m512i v) noexcept
+    {
+        const __m256i h = _mm256_add_epi32(_mm512_maskz_extracti32x8_epi32(0xFF, v, 0), _mm512_maskz_extracti32x8_epi32(0xFF, v, 1));
+        __m128i s = _mm_add_epi32(_mm256_castsi256_si128(h), _mm256_extracti128_si256(h, 1));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+        s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+        return _mm_cvtsi128_si32(s);
+    }
+
+    // Same formulas as simdtl::detail::cosine_finish.
+    inline float cosine_finish(float d, float qq, float rr) noexcept
+    {
+        return qq > 0.0f && rr > 0.0f ? d / (std::sqrt(qq) * std::sqrt(rr)) : 0.0f;
+    }
+
+    inline float cosine_finish(std::int64_t d, std::int64_t qq, std::int64_t rr) noexcept
+    {
+        return qq > 0 && rr > 0 ? static_cast<float>(double(d) / std::sqrt(double(qq) * double(rr))) : 0.0f;
+    }
+
+    // ---- float ----------------------------------------------------------------
+
+    template <metric M>
+    inline void step(__m512 q, __m512 r, __m512& acc, __m512& nrm) noexcept
+    {
+        if constexpr (M == metric::l2sq)
+        {
+            const __m512 d = _mm512_sub_ps(r, q);
+            acc = _mm512_fmadd_ps(d, d, acc);
+        }
+        else
+        {
+            acc = _mm512_fmadd_ps(q, r, acc);
+            if constexpr (M == metric::cosine) nrm = _mm512_fmadd_ps(r, r, nrm);
+        }
+    }
+
+    template <metric M>
+    inline float finish(float acc, float nrm, float qq) noexcept
+    {
+        if constexpr (M == metric::cosine) return cosine_finish(acc, qq, nrm);
+        else return acc;
+    }
+
+    inline __mmask16 tail_mask16(std::size_t left) noexcept
+    {
+        return static_cast<__mmask16>((1u << left) - 1u);
+    }
+
+    float self_dot(const float* q, std::size_t dim) noexcept
+    {
+        __m512 a = _mm512_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 16 <= dim; i += 16)
+        {
+            const __m512 v = _mm512_loadu_ps(q + i);
+            a = _mm512_fmadd_ps(v, v, a);
+        }
+        if (i < dim)
+        {
+            const __m512 v = _mm512_maskz_loadu_ps(tail_mask16(dim - i), q + i);
+            a = _mm512_fmadd_ps(v, v, a);
+        }
+        return hsum(a);
+    }
+
+    template <metric M>
+    void many_f32(const float* q, const float* base, std::size_t rows, std::size_t dim, float* out) noexcept
+    {
+        const float qq = M == metric::cosine ? self_dot(q, dim) : 0.0f;
+        std::size_t r = 0;
+        for (; r + 4 <= rows; r += 4)
+        {
+            const float* p0 = base + r * dim;
+            const float* p1 = p0 + dim;
+            const float* p2 = p1 + dim;
+            const float* p3 = p2 + dim;
+            const __m512 z = _mm512_setzero_ps();
+            __m512 a0 = z, a1 = z, a2 = z, a3 = z, n0 = z, n1 = z, n2 = z, n3 = z;
+            std::size_t i = 0;
+            if constexpr (M != metric::cosine)
+            {
+                // Second accumulator set (n*) for the odd half of each 32-wide step.
+                for (; i + 32 <= dim; i += 32)
+                {
+                    const __m512 qa = _mm512_loadu_ps(q + i), qb = _mm512_loadu_ps(q + i + 16);
+                    step<M>(qa, _mm512_loadu_ps(p0 + i), a0, n0);
+                    step<M>(qa, _mm512_loadu_ps(p1 + i), a1, n1);
+                    step<M>(qa, _mm512_loadu_ps(p2 + i), a2, n2);
+                    step<M>(qa, _mm512_loadu_ps(p3 + i), a3, n3);
+                    step<M>(qb, _mm512_loadu_ps(p0 + i + 16), n0, a0);
+                    step<M>(qb, _mm512_loadu_ps(p1 + i + 16), n1, a1);
+                    step<M>(qb, _mm512_loadu_ps(p2 + i + 16), n2, a2);
+                    step<M>(qb, _mm512_loadu_ps(p3 + i + 16), n3, a3);
+                }
+                a0 = _mm512_add_ps(a0, n0); a1 = _mm512_add_ps(a1, n1);
+                a2 = _mm512_add_ps(a2, n2); a3 = _mm512_add_ps(a3, n3);
+            }
+            for (; i + 16 <= dim; i += 16)
+            {
+                const __m512 qv = _mm512_loadu_ps(q + i);
+                step<M>(qv, _mm512_loadu_ps(p0 + i), a0, n0);
+                step<M>(qv, _mm512_loadu_ps(p1 + i), a1, n1);
+                step<M>(qv, _mm512_loadu_ps(p2 + i), a2, n2);
+                step<M>(qv, _mm512_loadu_ps(p3 + i), a3, n3);
+            }
+            if (i < dim)
+            {
+                const __mmask16 m = tail_mask16(dim - i);
+                const __m512 qv = _mm512_maskz_loadu_ps(m, q + i);
+                step<M>(qv, _mm512_maskz_loadu_ps(m, p0 + i), a0, n0);
+                step<M>(qv, _mm512_maskz_loadu_ps(m, p1 + i), a1, n1);
+                step<M>(qv, _mm512_maskz_loadu_ps(m, p2 + i), a2, n2);
+                step<M>(qv, _mm512_maskz_loadu_ps(m, p3 + i), a3, n3);
+            }
+            out[r]     = finish<M>(hsum(a0), hsum(n0), qq);
+            out[r + 1] = finish<M>(hsum(a1), hsum(n1), qq);
+            out[r + 2] = finish<M>(hsum(a2), hsum(n2), qq);
+            out[r + 3] = finish<M>(hsum(a3), hsum(n3), qq);
+        }
+        for (; r < rows; ++r)
+        {
+            const float* p = base + r * dim;
+            __m512 a = _mm512_setzero_ps(), n = a;
+            std::size_t i = 0;
+            for (; i + 16 <= dim; i += 16) step<M>(_mm512_loadu_ps(q + i), _mm512_loadu_ps(p + i), a, n);
+            if (i < dim)
+            {
+                const __mmask16 m = tail_mask16(dim - i);
+                step<M>(_mm512_maskz_loadu_ps(m, q + i), _mm512_maskz_loadu_ps(m, p + i), a, n);
+            }
+            out[r] = finish<M>(hsum(a), hsum(n), qq);
+        }
+    }
+
+    // ---- int8 -----------------------------------------------------------------
+
+    inline __m512i widen(const std::int8_t* p) noexcept
+    {
+        return _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    }
+
+    inline __m512i widen(const std::int8_t* p, __mmask32 m) noexcept
+    {
+        return _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(m, p));
+    }
+
+    template <metric M>
+    inline void step(__m512i q, __m512i r, __m512i& acc, __m512i& nrm) noexcept
+    {
+        if constexpr (M == metric::l2sq)
+        {
+            const __m512i d = _mm512_sub_epi16(r, q);
+            acc = _mm512_add_epi32(acc, _mm512_madd_epi16(d, d));
+        }
+        else
+        {
+            acc = _mm512_add_epi32(acc, _mm512_madd_epi16(q, r));
+            if constexpr (M == metric::cosine) nrm = _mm512_add_epi32(nrm, _mm512_madd_epi16(r, r));
+        }
+    }
+
+    template <metric M, class Out>
+    void many_i8(const std::int8_t* q, const std::int8_t* base, std::size_t rows, std::size_t dim, Out* out) noexcept
+    {
+        const std::size_t body = dim - dim % 32;
+        const __mmask32 tail = static_cast<__mmask32>((std::uint64_t{1} << (dim - body)) - 1u);
+        std::int64_t qq = 0;
+        if constexpr (M == metric::cosine)
+            for (std::size_t i = 0; i < dim; ++i) qq += q[i] * q[i];
+        auto put = [&](std::size_t r, std::int64_t s, std::int64_t m) {
+            if constexpr (M == metric::cosine) out[r] = cosine_finish(s, qq, m);
+            else out[r] = s;
+        };
+        std::size_t r = 0;
+        for (; r + 4 <= rows; r += 4)
+        {
+            const std::int8_t* p0 = base + r * dim;
+            const std::int8_t* p1 = p0 + dim;
+            const std::int8_t* p2 = p1 + dim;
+            const std::int8_t* p3 = p2 + dim;
+            const __m512i z = _mm512_setzero_si512();
+            __m512i a0 = z, a1 = z, a2 = z, a3 = z, n0 = z, n1 = z, n2 = z, n3 = z;
+            std::int64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0, m0 = 0, m1 = 0, m2 = 0, m3 = 0;
+            auto flush = [&] {
+                s0 += hsum(a0); s1 += hsum(a1); s2 += hsum(a2); s3 += hsum(a3);
+                m0 += hsum(n0); m1 += hsum(n1); m2 += hsum(n2); m3 += hsum(n3);
+                a0 = a1 = a2 = a3 = n0 = n1 = n2 = n3 = z;
+            };
+            for (std::size_t i = 0; i < body; i += 32)
+            {
+                const __m512i qv = widen(q + i);
+                step<M>(qv, widen(p0 + i), a0, n0);
+                step<M>(qv, widen(p1 + i), a1, n1);
+                step<M>(qv, widen(p2 + i), a2, n2);
+                step<M>(qv, widen(p3 + i), a3, n3);
+                if ((i + 32) % kFlush == 0) flush();
+            }
+            if (body < dim)
+            {
+                const __m512i qv = widen(q + body, tail);
+                step<M>(qv, widen(p0 + body, tail), a0, n0);
+                step<M>(qv, widen(p1 + body, tail), a1, n1);
+                step<M>(qv, widen(p2 + body, tail), a2, n2);
+                step<M>(qv, widen(p3 + body, tail), a3, n3);
+            }
+            flush();
+            put(r, s0, m0); put(r + 1, s1, m1); put(r + 2, s2, m2); put(r + 3, s3, m3);
+        }
+        for (; r < rows; ++r)
+        {
+            const std::int8_t* p = base + r * dim;
+            const __m512i z = _mm512_setzero_si512();
+            __m512i a = z, n = z;
+            std::int64_t s = 0, m = 0;
+            for (std::size_t i = 0; i < body; i += 32)
+            {
+                step<M>(widen(q + i), widen(p + i), a, n);
+                if ((i + 32) % kFlush == 0)
+                {
+                    s += hsum(a); m += hsum(n);
+                    a = n = z;
+                }
+            }
+            if (body < dim) step<M>(widen(q + body, tail), widen(p + body, tail), a, n);
+            put(r, s + hsum(a), m + hsum(n));
+        }
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            register_dot_many_f32(isa_level::avx512, &many_f32<metric::dot>);
+            register_l2sq_many_f32(isa_level::avx512, &many_f32<metric::l2sq>);
+            register_dot_many_i8(isa_level::avx512, &many_i8<metric::dot, std::int64_t>);
+            register_l2sq_many_i8(isa_level::avx512, &many_i8<metric::l2sq, std::int64_t>);
+            register_cosine_many_i8(isa_level::avx512, &many_i8<metric::cosine, float>);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
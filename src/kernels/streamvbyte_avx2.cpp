@@ -0,0 +1,129 @@
+// ── Opt-in AVX2 StreamVByte kernels (self-registering) ────────────────────────
+// Two quads (8 values, 2 control bytes) per step, as in streamvbyte.hpp's layout.
+//   encode: the codes of 8 lanes come from three vpsrld / vpcmpeqd against zero
+//           (3 + the number of zero high parts), two vpackus gather them into
+//           bytes, and one multiply folds a quad's four codes into its control
+//           byte. enc_lut[key] is the pshufb control compacting the quad's used
+//           bytes to the front; each half is stored 16 bytes wide and the cursor
+//           advances by len_lut[key].
+//   decode: dec_lut[key] sends the 4..16 data bytes of a quad to their dword
+//           lanes (0x80 zero-fills the high bytes); the two quads' 16-byte loads
+//           are joined so one vpshufb decodes 8 values.
+// Same control-byte tables as the crosslane LUTs: built once by the registrar.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    // dec_lut[k] : pshufb control, output byte 4j+b <- data byte (offset of value j) + b.
+    alignas(16) std::uint8_t dec_lut[256][16];
+    // enc_lut[k] : pshufb control, data byte t <- the t-th used byte of the quad.
+    alignas(16) std::uint8_t enc_lut[256][16];
+    // len_lut[k] : data bytes of a quad with control byte k (4..16).
+    std::uint8_t len_lut[256];
+
+    void build_luts() noexcept
+    {
+        for (int k = 0; k < 256; ++k)
+        {
+            int off = 0;
+            for (int j = 0; j < 4; ++j)
+            {
+                const int len = ((k >> (2 * j)) & 3) + 1;
+                for (int b = 0; b < 4; ++b)
+                {
+                    dec_lut[k][4 * j + b] = b < len ? static_cast<std::uint8_t>(off + b) : 0x80;
+                    if (b < len) enc_lut[k][off + b] = static_cast<std::uint8_t>(4 * j + b);
+                }
+                off += len;
+            }
+            for (int t = off; t < 16; ++t) enc_lut[k][t] = 0x80;
+            len_lut[k] = static_cast<std::uint8_t>(off);
+        }
+    }
+
+    inline __m128i load16(const void* p) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+    inline void store16(void* p, __m128i v) noexcept { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+
+    // Four 2-bit codes in bytes 0..3 of x -> one control byte. The multiply
+    // lands byte j at bit 24 + 2j; the partial products below bit 24 sum to
+    // less than 2^24, so nothing carries in.
+    inline unsigned fold_codes(std::uint32_t x) noexcept { return (x * 0x01041040u) >> 24; }
+
+    inline std::uint8_t* put_quad(__m128i v, unsigned key, std::uint8_t* ctrl, std::uint8_t* data) noexcept
+    {
+        *ctrl = static_cast<std::uint8_t>(key);
+        store16(data, _mm_shuffle_epi8(v, _mm_load_si128(reinterpret_cast<const __m128i*>(enc_lut[key]))));
+        return data + len_lut[key];
+    }
+
+    std::uint8_t* svb_encode_avx2(const std::uint32_t* first, std::size_t quads,
+                                  std::uint8_t* ctrl, std::uint8_t* data) noexcept
+    {
+        const __m256i zero = _mm256_setzero_si256(), three = _mm256_set1_epi32(3);
+        std::size_t q = 0;
+        for (; q + 2 <= quads; q += 2)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + 4 * q));
+            __m256i c = _mm256_add_epi32(three, _mm256_cmpeq_epi32(_mm256_srli_epi32(v, 8), zero));
+            c = _mm256_add_epi32(c, _mm256_cmpeq_epi32(_mm256_srli_epi32(v, 16), zero));
+            c = _mm256_add_epi32(c, _mm256_cmpeq_epi32(_mm256_srli_epi32(v, 24), zero));
+            const __m256i b = _mm256_packus_epi16(_mm256_packus_epi32(c, zero), zero);   // per lane: 4 code bytes
+            const unsigned k0 = fold_codes(static_cast<std::uint32_t>(_mm256_cvtsi256_si32(b)));
+            const unsigned k1 = fold_codes(static_cast<std::uint32_t>(_mm256_extract_epi32(b, 4)));
+            data = put_quad(_mm256_castsi256_si128(v), k0, ctrl + q, data);
+            data = put_quad(_mm256_extracti128_si256(v, 1), k1, ctrl + q + 1, data);
+        }
+        if (q < quads)
+        {
+            const __m128i v = load16(first + 4 * q), z = _mm_setzero_si128();
+            __m128i c = _mm_add_epi32(_mm_set1_epi32(3), _mm_cmpeq_epi32(_mm_srli_epi32(v, 8), z));
+            c = _mm_add_epi32(c, _mm_cmpeq_epi32(_mm_srli_epi32(v, 16), z));
+            c = _mm_add_epi32(c, _mm_cmpeq_epi32(_mm_srli_epi32(v, 24), z));
+            const __m128i b = _mm_packus_epi16(_mm_packus_epi32(c, z), z);
+            data = put_quad(v, fold_codes(static_cast<std::uint32_t>(_mm_cvtsi128_si32(b))), ctrl + q, data);
+        }
+        return data;
+    }
+
+    const std::uint8_t* svb_decode_avx2(const std::uint8_t* ctrl, const std::uint8_t* data,
+                                        std::size_t quads, std::uint32_t* out) noexcept
+    {
+        std::size_t q = 0;
+        for (; q + 2 <= quads; q += 2)
+        {
+            const unsigned k0 = ctrl[q], k1 = ctrl[q + 1];
+            const __m128i lo = load16(data);
+            data += len_lut[k0];
+            const __m128i hi = load16(data);
+            data += len_lut[k1];
+            const __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            const __m256i m = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(dec_lut[k0]))),
+                _mm_load_si128(reinterpret_cast<const __m128i*>(dec_lut[k1])), 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4 * q), _mm256_shuffle_epi8(v, m));
+        }
+        if (q < quads)
+        {
+            const unsigned k = ctrl[q];
+            store16(out + 4 * q, _mm_shuffle_epi8(load16(data), _mm_load_si128(reinterpret_cast<const __m128i*>(dec_lut[k]))));
+            data += len_lut[k];
+        }
+        return data;
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            build_luts();
+            using namespace simdtl::platform;
+            register_svb_encode(isa_level::avx2, &svb_encode_avx2);
+            register_svb_decode(isa_level::avx2, &svb_decode_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
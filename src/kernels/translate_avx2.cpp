@@ -0,0 +1,160 @@
+// ── Opt-in AVX2 byte translation / dictionary decode (self-registering) ──────
+//   translate_u8 : 256-entry table as two 128-entry halves. Each half is 8
+//                  pshufb lookups on x - 16c (c = 0..7, x = the index's low 7
+//                  bits): the lane is looked up only while 16c <= x (bit 7 of
+//                  x - 16c clear) and its low nibble is unchanged, so XOR-ing
+//                  the results against tables pre-XOR-ed with their predecessor
+//                  chunk leaves exactly chunk x / 16. Bit 7 of the index then
+//                  picks the half with one vpblendvb. 32 bytes per step.
+//   dict_decode_u32: up to 8 entries one vpermd, up to 16 two vpermd + a blend
+//                  on code bit 3, else vpgatherdd (scalar where gathers are slow).
+//   dict_decode_u64: up to 4 entries vpermd on (2c, 2c + 1) pairs, up to 8 two
+//                  of those + a blend on code bit 2, else vpgatherdq (scalar
+//                  where gathers are slow).
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    bool g_fast_gather = true;
+
+    void translate_u8_avx2(const std::uint8_t* first, std::size_t n, const std::uint8_t* table,
+                           std::uint8_t* out) noexcept
+    {
+        // t[h][c]: chunk c of half h, XOR-ed with chunk c - 1, in both lanes.
+        alignas(32) std::uint8_t t[2][8][32];
+        for (std::size_t h = 0; h < 2; ++h)
+            for (std::size_t c = 0; c < 8; ++c)
+                for (std::size_t j = 0; j < 16; ++j)
+                {
+                    const std::uint8_t* half = table + 128 * h;
+                    const std::uint8_t v = static_cast<std::uint8_t>(half[16 * c + j] ^ (c ? half[16 * (c - 1) + j] : 0u));
+                    t[h][c][j] = t[h][c][j + 16] = v;
+                }
+        __m256i lo[8], hi[8];
+        for (std::size_t c = 0; c < 8; ++c)
+        {
+            lo[c] = _mm256_load_si256(reinterpret_cast<const __m256i*>(t[0][c]));
+            hi[c] = _mm256_load_si256(reinterpret_cast<const __m256i*>(t[1][c]));
+        }
+        const __m256i low7 = _mm256_set1_epi8(0x7F);
+        const __m256i step = _mm256_set1_epi8(16);
+        std::size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+            __m256i x = _mm256_and_si256(idx, low7);
+            __m256i a = _mm256_shuffle_epi8(lo[0], x);
+            __m256i b = _mm256_shuffle_epi8(hi[0], x);
+            for (std::size_t c = 1; c < 8; ++c)
+            {
+                x = _mm256_sub_epi8(x, step);
+                a = _mm256_xor_si256(a, _mm256_shuffle_epi8(lo[c], x));
+                b = _mm256_xor_si256(b, _mm256_shuffle_epi8(hi[c], x));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blendv_epi8(a, b, idx));
+        }
+        for (; i < n; ++i) out[i] = table[first[i]];
+    }
+
+    inline __m256i codes8(const std::uint8_t* p) noexcept
+    {
+        return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    void dict_decode_u32_avx2(const std::uint8_t* codes, std::size_t n, const std::uint32_t* dict, std::size_t dict_n,
+                              std::uint32_t* out) noexcept
+    {
+        std::size_t i = 0;
+        if (dict_n <= 16)
+        {
+            alignas(32) std::uint32_t d[16] = {};
+            for (std::size_t j = 0; j < dict_n; ++j) d[j] = dict[j];
+            const __m256i d0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(d));
+            const __m256i d1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(d + 8));
+            for (; i + 8 <= n; i += 8)
+            {
+                const __m256i c = codes8(codes + i);
+                __m256i v = _mm256_permutevar8x32_epi32(d0, c);
+                if (dict_n > 8)
+                    v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(v),
+                                                             _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(d1, c)),
+                                                             _mm256_castsi256_ps(_mm256_slli_epi32(c, 28))));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+            }
+        }
+        else if (g_fast_gather)
+        {
+            const int* base = reinterpret_cast<const int*>(dict);
+            const __m256i ones = _mm256_set1_epi32(-1);
+            for (; i + 8 <= n; i += 8)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                                    _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, codes8(codes + i), ones, 4));
+        }
+        for (; i < n; ++i) out[i] = dict[codes[i]];
+    }
+
+    // Four codes -> vpermd controls selecting the 32-bit halves (2c, 2c + 1).
+    inline __m256i pair_index(const std::uint8_t* p) noexcept
+    {
+        std::int32_t four;
+        std::memcpy(&four, p, 4);
+        const __m256i c = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(four));
+        const __m256i t = _mm256_slli_epi64(c, 1);
+        return _mm256_or_si256(_mm256_or_si256(t, _mm256_slli_epi64(t, 32)), _mm256_set1_epi64x(std::int64_t{1} << 32));
+    }
+
+    void dict_decode_u64_avx2(const std::uint8_t* codes, std::size_t n, const std::uint64_t* dict, std::size_t dict_n,
+                              std::uint64_t* out) noexcept
+    {
+        std::size_t i = 0;
+        if (dict_n <= 8)
+        {
+            alignas(32) std::uint64_t d[8] = {};
+            for (std::size_t j = 0; j < dict_n; ++j) d[j] = dict[j];
+            const __m256i d0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(d));
+            const __m256i d1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(d + 4));
+            for (; i + 4 <= n; i += 4)
+            {
+                const __m256i p = pair_index(codes + i);   // 2c | (2c + 1) << 32: bit 3 of each half is c's bit 2
+                __m256i v = _mm256_permutevar8x32_epi32(d0, p);
+                if (dict_n > 4)
+                    v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(v),
+                                                             _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(d1, p)),
+                                                             _mm256_castsi256_ps(_mm256_slli_epi32(p, 28))));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+            }
+        }
+        else if (g_fast_gather)
+        {
+            const long long* base = reinterpret_cast<const long long*>(dict);
+            const __m256i ones = _mm256_set1_epi64x(-1);
+            for (; i + 4 <= n; i += 4)
+            {
+                std::int32_t four;
+                std::memcpy(&four, codes + i, 4);
+                const __m128i c = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(four));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                                    _mm256_mask_i32gather_epi64(_mm256_setzero_si256(), base, c, ones, 8));
+            }
+        }
+        for (; i < n; ++i) out[i] = dict[codes[i]];
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            g_fast_gather = !detect_cpu_features().slow_gather;
+            register_translate_u8(isa_level::avx2, &translate_u8_avx2);
+            register_dict_decode_u32(isa_level::avx2, &dict_decode_u32_avx2);
+            register_dict_decode_u64(isa_level::avx2, &dict_decode_u64_avx2);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
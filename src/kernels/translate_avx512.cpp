@@ -0,0 +1,171 @@
+// ── Opt-in AVX-512 byte translation / dictionary decode (self-registering) ───
+//   translate_u8 : with AVX512_VBMI (probed separately), two vpermi2b lookups
+//                  into the table's 128-byte halves and a byte blend on index
+//                  bit 7 — 64 bytes in four instructions. Without it, the AVX2
+//                  kernel's XOR-cascaded pshufb chunks (see translate_avx2.cpp)
+//                  on zmm with a k-mask blend.
+//   dict_decode_u32: up to 16 entries one vpermd, up to 32 one vpermi2d, else
+//                  vpgatherdd (scalar where gathers are slow).
+//   dict_decode_u64: up to 8 entries one vpermq, up to 16 one vpermi2q, else
+//                  vpgatherdq (scalar where gathers are slow).
+// The dictionaries are loaded with zero-masked loads, never past dict_n. The
+// widening and single-source permutes use their all-lanes maskz forms: the plain
+// ones' undefined passthrough trips GCC 12's -Wmaybe-uninitialized.
+#include "simdtl/platform/dispatch.hpp"
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#  define SIMDTL_TARGET_VBMI __attribute__((target("avx512vbmi")))
+#else
+#  define SIMDTL_TARGET_VBMI
+#endif
+
+namespace
+{
+    bool g_fast_gather = true;
+
+    SIMDTL_TARGET_VBMI
+    void translate_u8_avx512vbmi(const std::uint8_t* first, std::size_t n, const std::uint8_t* table,
+                                 std::uint8_t* out) noexcept
+    {
+        const __m512i t0 = _mm512_loadu_si512(table);
+        const __m512i t1 = _mm512_loadu_si512(table + 64);
+        const __m512i t2 = _mm512_loadu_si512(table + 128);
+        const __m512i t3 = _mm512_loadu_si512(table + 192);
+        std::size_t i = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            const __m512i idx = _mm512_loadu_si512(first + i);
+            const __m512i a = _mm512_permutex2var_epi8(t0, idx, t1);
+            const __m512i b = _mm512_permutex2var_epi8(t2, idx, t3);
+            _mm512_storeu_si512(out + i, _mm512_mask_blend_epi8(_mm512_movepi8_mask(idx), a, b));
+        }
+        for (; i < n; ++i) out[i] = table[first[i]];
+    }
+
+    void translate_u8_avx512(const std::uint8_t* first, std::size_t n, const std::uint8_t* table,
+                             std::uint8_t* out) noexcept
+    {
+        // t[h][c]: chunk c of half h, XOR-ed with chunk c - 1, in all four lanes.
+        alignas(64) std::uint8_t t[2][8][64];
+        for (std::size_t h = 0; h < 2; ++h)
+            for (std::size_t c = 0; c < 8; ++c)
+                for (std::size_t j = 0; j < 16; ++j)
+                {
+                    const std::uint8_t* half = table + 128 * h;
+                    const std::uint8_t v = static_cast<std::uint8_t>(half[16 * c + j] ^ (c ? half[16 * (c - 1) + j] : 0u));
+                    for (std::size_t l = 0; l < 4; ++l) t[h][c][16 * l + j] = v;
+                }
+        __m512i lo[8], hi[8];
+        for (std::size_t c = 0; c < 8; ++c)
+        {
+            lo[c] = _mm512_load_si512(t[0][c]);
+            hi[c] = _mm512_load_si512(t[1][c]);
+        }
+        const __m512i low7 = _mm512_set1_epi8(0x7F);
+        const __m512i step = _mm512_set1_epi8(16);
+        std::size_t i = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            const __m512i idx = _mm512_loadu_si512(first + i);
+            __m512i x = _mm512_and_si512(idx, low7);
+            __m512i a = _mm512_shuffle_epi8(lo[0], x);
+            __m512i b = _mm512_shuffle_epi8(hi[0], x);
+            for (std::size_t c = 1; c < 8; ++c)
+            {
+                x = _mm512_sub_epi8(x, step);
+                a = _mm512_xor_si512(a, _mm512_shuffle_epi8(lo[c], x));
+                b = _mm512_xor_si512(b, _mm512_shuffle_epi8(hi[c], x));
+            }
+            _mm512_storeu_si512(out + i, _mm512_mask_blend_epi8(_mm512_movepi8_mask(idx), a, b));
+        }
+        for (; i < n; ++i) out[i] = table[first[i]];
+    }
+
+    // The first `count` (<= 16) dwords / (<= 8) qwords of p, zeros above.
+    inline __m512i load_dwords(const std::uint32_t* p, std::size_t count) noexcept
+    {
+        return _mm512_maskz_loadu_epi32(static_cast<__mmask16>((1u << count) - 1u), p);
+    }
+    inline __m512i load_qwords(const std::uint64_t* p, std::size_t count) noexcept
+    {
+        return _mm512_maskz_loadu_epi64(static_cast<__mmask8>((1u << count) - 1u), p);
+    }
+
+    // 16 codes as dwords / 8 codes as qwords.
+    inline __m512i codes_d(const std::uint8_t* p) noexcept
+    {
+        return _mm512_maskz_cvtepu8_epi32(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+    inline __m512i codes_q(const std::uint8_t* p) noexcept
+    {
+        return _mm512_maskz_cvtepu8_epi64(0xFF, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    void dict_decode_u32_avx512(const std::uint8_t* codes, std::size_t n, const std::uint32_t* dict, std::size_t dict_n,
+                                std::uint32_t* out) noexcept
+    {
+        std::size_t i = 0;
+        if (dict_n <= 32)
+        {
+            const __m512i d0 = load_dwords(dict, dict_n < 16 ? dict_n : 16);
+            const __m512i d1 = load_dwords(dict + 16, dict_n > 16 ? dict_n - 16 : 0);
+            for (; i + 16 <= n; i += 16)
+            {
+                const __m512i c = codes_d(codes + i);
+                _mm512_storeu_si512(out + i, dict_n <= 16 ? _mm512_maskz_permutexvar_epi32(0xFFFF, c, d0)
+                                                          : _mm512_permutex2var_epi32(d0, c, d1));
+            }
+        }
+        else if (g_fast_gather)
+        {
+            for (; i + 16 <= n; i += 16)
+                _mm512_storeu_si512(out + i,
+                                    _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, codes_d(codes + i), dict, 4));
+        }
+        for (; i < n; ++i) out[i] = dict[codes[i]];
+    }
+
+    void dict_decode_u64_avx512(const std::uint8_t* codes, std::size_t n, const std::uint64_t* dict, std::size_t dict_n,
+                                std::uint64_t* out) noexcept
+    {
+        std::size_t i = 0;
+        if (dict_n <= 16)
+        {
+            const __m512i d0 = load_qwords(dict, dict_n < 8 ? dict_n : 8);
+            const __m512i d1 = load_qwords(dict + 8, dict_n > 8 ? dict_n - 8 : 0);
+            for (; i + 8 <= n; i += 8)
+            {
+                const __m512i c = codes_q(codes + i);
+                _mm512_storeu_si512(out + i, dict_n <= 8 ? _mm512_maskz_permutexvar_epi64(0xFF, c, d0)
+                                                         : _mm512_permutex2var_epi64(d0, c, d1));
+            }
+        }
+        else if (g_fast_gather)
+        {
+            for (; i + 8 <= n; i += 8)
+            {
+                const __m256i c = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(codes + i)));
+                _mm512_storeu_si512(out + i, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), 0xFF, c, dict, 8));
+            }
+        }
+        for (; i < n; ++i) out[i] = dict[codes[i]];
+    }
+
+    struct registrar
+    {
+        registrar() noexcept
+        {
+            using namespace simdtl::platform;
+            const cpu_features f = detect_cpu_features();
+            g_fast_gather = !f.slow_gather;
+            register_translate_u8(isa_level::avx512, f.avx512vbmi ? &translate_u8_avx512vbmi : &translate_u8_avx512);
+            register_dict_decode_u32(isa_level::avx512, &dict_decode_u32_avx512);
+            register_dict_decode_u64(isa_level::avx512, &dict_decode_u64_avx512);
+        }
+    };
+    const registrar g_registrar{};
+} // namespace
@@ -0,0 +1,171 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+
+// Reference bitmap: bit i of word i / 64 = pred(v[i]), nothing past n.
+template <class T, class Pred>
+static std::vector<std::uint64_t> ref_bitmap(const std::vector<T>& v, Pred pred)
+{
+    std::vector<std::uint64_t> bits(simdtl::bitmap_words(v.size()), 0);
+    for (std::size_t i = 0; i < v.size(); ++i)
+        if (pred(v[i])) bits[i / 64] |= std::uint64_t{1} << (i % 64);
+    return bits;
+}
+
+template <class T>
+static void check_select(unsigned seed)
+{
+    std::mt19937 gen(seed);
+    for (std::size_t n : kEdgeSizes)
+    {
+        std::vector<T> v(n);
+        for (auto& x : v) x = static_cast<T>(gen() % 100);
+        const auto pred = [](auto x) { return x < decltype(x)(37); };
+        const auto want = ref_bitmap(v, pred);
+        std::vector<std::uint64_t> bits(want.size() + 1, ~std::uint64_t{0});
+        const std::size_t count = simdtl::select_bitmap(v.data(), n, pred, bits.data());
+        std::size_t want_count = 0;
+        bool ok = bits.back() == ~std::uint64_t{0};   // nothing written past the last word
+        for (std::size_t w = 0; w < want.size(); ++w)
+        {
+            ok &= bits[w] == want[w];
+            want_count += static_cast<std::size_t>(std::popcount(want[w]));
+        }
+        CHECK_MESSAGE(ok, "n=" << n);
+        CHECK_MESSAGE(count == want_count, "n=" << n);
+    }
+}
+
+TEST_CASE("select_bitmap against a scalar reference")
+{
+    check_select<std::int8_t>(440u);
+    check_select<std::uint8_t>(441u);
+    check_select<std::int16_t>(442u);
+    check_select<std::int32_t>(443u);
+    check_select<float>(444u);
+    check_select<std::int64_t>(445u);
+    check_select<double>(446u);
+
+    const std::vector<int> v{1, 2, 3, 4, 5};
+    std::uint64_t bits = 0;
+    CHECK(simdtl::select_bitmap(v, [](auto x) { return x % 2 == 0; }, &bits) == 2);
+    CHECK(bits == 0b01010u);
+}
+
+TEST_CASE("bitmap_and / or / andnot / not, tail bits stay zero")
+{
+    std::mt19937_64 gen(447u);
+    for (std::size_t n : kEdgeSizes)
+    {
+        const std::size_t words = simdtl::bitmap_words(n);
+        std::vector<std::uint64_t> a(words), b(words), out(words);
+        for (std::size_t w = 0; w < words; ++w) { a[w] = gen(); b[w] = gen(); }
+        if (words != 0) { a.back() &= simdtl::detail::bitmap_tail_mask(n); b.back() &= simdtl::detail::bitmap_tail_mask(n); }
+        bool ok = true;
+        simdtl::bitmap_and(a.data(), b.data(), n, out.data());
+        for (std::size_t w = 0; w < words; ++w) ok &= out[w] == (a[w] & b[w]);
+        simdtl::bitmap_or(a.data(), b.data(), n, out.data());
+        for (std::size_t w = 0; w < words; ++w) ok &= out[w] == (a[w] | b[w]);
+        simdtl::bitmap_andnot(a.data(), b.data(), n, out.data());
+        for (std::size_t w = 0; w < words; ++w) ok &= out[w] == (a[w] & ~b[w]);
+        simdtl::bitmap_not(a.data(), n, out.data());
+        for (std::size_t w = 0; w + 1 < words; ++w) ok &= out[w] == ~a[w];
+        if (words != 0) ok &= out.back() == (~a.back() & simdtl::detail::bitmap_tail_mask(n));
+        CHECK_MESSAGE(ok, "n=" << n);
+        std::vector<std::uint64_t> c = a;
+        simdtl::bitmap_andnot(c.data(), b.data(), n, c.data());   // in place
+        bool same = true;
+        for (std::size_t w = 0; w < words; ++w) same &= c[w] == (a[w] & ~b[w]);
+        CHECK_MESSAGE(same, "in place, n=" << n);
+    }
+}
+
+TEST_CASE("bitmap_popcount / bitmap_to_indices against a scalar reference")
+{
+    std::mt19937_64 gen(448u);
+    const std::size_t sizes[] = {0, 1, 63, 64, 65, 127, 128, 300, 511, 512, 513, 1000, 4096, 10007};
+    for (std::size_t n : sizes)
+    {
+        for (int density = 0; density < 4; ++density)
+        {
+            // empty, sparse, half, dense; junk past n must be ignored.
+            std::vector<std::uint64_t> bits(simdtl::bitmap_words(n));
+            for (auto& w : bits)
+            {
+                const std::uint64_t r = gen();
+                w = density == 0 ? 0 : density == 1 ? r & gen() & gen() & gen() : density == 2 ? r : r | gen() | gen();
+            }
+            std::vector<std::uint32_t> want;
+            for (std::size_t i = 0; i < n; ++i)
+                if (bits[i / 64] >> (i % 64) & 1u) want.push_back(static_cast<std::uint32_t>(i));
+
+            CHECK_MESSAGE(simdtl::bitmap_popcount(bits.data(), n) == want.size(), "n=" << n << " density=" << density);
+            std::vector<std::uint32_t> out(n + 1, 0xDEADBEEFu);
+            const std::size_t k = simdtl::bitmap_to_indices(bits.data(), n, out.data());
+            CHECK(out[n] == 0xDEADBEEFu);
+            out.resize(k);
+            CHECK_MESSAGE(out == want, "n=" << n << " density=" << density);
+
+            std::vector<std::uint32_t> pout(n + 1);
+            const std::size_t full = n / 64;
+            std::size_t pk = simdtl::detail::bitmap_to_indices_portable(bits.data(), full, 0, pout.data());
+            CHECK(simdtl::detail::bitmap_popcount_portable(bits.data(), full) == pk);
+            pout.resize(pk);
+            out.resize(std::min(out.size(), pk));
+            CHECK(pout == out);
+        }
+    }
+}
+
+TEST_CASE("select_bitmap round-trips through bitmap_to_indices")
+{
+    std::mt19937 gen(449u);
+    std::vector<std::int32_t> v(3001);
+    for (auto& x : v) x = static_cast<std::int32_t>(gen() % 1000);
+    std::vector<std::uint64_t> bits(simdtl::bitmap_words(v.size()));
+    const auto pred = [](auto x) { return x >= decltype(x)(900); };
+    const std::size_t count = simdtl::select_bitmap(v.data(), v.size(), pred, bits.data());
+    CHECK(simdtl::bitmap_popcount(bits.data(), v.size()) == count);
+    std::vector<std::uint32_t> idx(v.size());
+    REQUIRE(simdtl::bitmap_to_indices(bits.data(), v.size(), idx.data()) == count);
+    bool ok = true;
+    for (std::size_t k = 0; k < count; ++k) ok &= v[idx[k]] >= 900 && (k == 0 || idx[k - 1] < idx[k]);
+    CHECK(ok);
+}
+
+TEST_CASE("mask_bits packs lane i into bit i")
+{
+    using V = simdtl::native<std::int32_t>;
+    const V x([](auto i) { return static_cast<std::int32_t>(i); });
+    std::uint64_t want = 0;
+    for (std::size_t i = 0; i < V::size(); ++i)
+        if (i % 3 == 0) want |= std::uint64_t{1} << i;
+    CHECK(simdtl::mask_bits(x % 3 == 0) == want);
+}
+
+TEST_CASE("bitmap kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(bitmap_popcount_lvl() == want);
+        CHECK(bitmap_to_indices_lvl() == want);
+    }
+#else
+    CHECK(bitmap_popcount_slot() == nullptr);
+    CHECK(bitmap_to_indices_slot() == nullptr);
+#endif
+}
@@ -0,0 +1,145 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Bit-by-bit encoder written straight from the layout description in
+// bitpack.hpp (so the format itself is pinned, not just the round trip).
+static std::vector<std::uint32_t> pack_ref(const std::vector<std::uint32_t>& v, unsigned bits)
+{
+    const std::size_t n = v.size(), blocks = n / 512, head = blocks * 16 * bits;
+    std::vector<std::uint32_t> out(simdtl::bitpack_words(n, bits), 0u);
+    for (std::size_t i = 0; i < n; ++i)
+        for (unsigned t = 0; t < bits; ++t)
+        {
+            if (((v[i] >> t) & 1u) == 0) continue;
+            std::size_t word;
+            std::size_t pos;
+            if (i < blocks * 512)
+            {
+                const std::size_t b = i / 512, j = i % 512, lane = j % 16, slot = j / 16;
+                pos = slot * bits + t;
+                word = b * 16 * bits + pos / 32 * 16 + lane;
+            }
+            else
+            {
+                pos = (i - blocks * 512) * bits + t;
+                word = head + pos / 32;
+            }
+            out[word] |= std::uint32_t{1} << (pos % 32);
+        }
+    return out;
+}
+
+static std::vector<std::uint32_t> values(std::size_t n, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::vector<std::uint32_t> v(n);
+    // Full 32-bit noise: the bits above `bits` must be ignored.
+    for (auto& x : v) x = gen();
+    return v;
+}
+
+static const std::size_t kSizes[] = {0, 1, 15, 16, 17, 100, 511, 512, 513, 1024, 1500, 2048 + 7};
+
+TEST_CASE("bitpack writes the documented layout and bitunpack inverts it (all widths)")
+{
+    for (unsigned bits = 0; bits <= 32; ++bits)
+        for (std::size_t n : kSizes)
+        {
+            const auto v = values(n, 410u + bits * 31u + static_cast<unsigned>(n));
+            const std::uint32_t mask = bits == 32 ? 0xFFFFFFFFu : (std::uint32_t{1} << bits) - 1u;
+            const std::size_t words = simdtl::bitpack_words(n, bits);
+
+            std::vector<std::uint32_t> packed(words + 2, 0xDEADBEEFu), port(words + 2, 0xDEADBEEFu);
+            CHECK(simdtl::bitpack(v.data(), n, bits, packed.data()) == words);
+            const auto ref = pack_ref(v, bits);
+            bool same = packed[words] == 0xDEADBEEFu;   // nothing written past the end
+            for (std::size_t i = 0; i < words; ++i) same &= packed[i] == ref[i];
+            CHECK_MESSAGE(same, "bits=" << bits << " n=" << n);
+
+            simdtl::detail::bitpack_blocks_portable(v.data(), n / 512, bits, port.data());
+            for (std::size_t i = 0; i < n / 512 * 16 * bits; ++i) same &= port[i] == ref[i];
+            CHECK(same);
+
+            std::vector<std::uint32_t> back(n + 2, 7u);
+            CHECK(simdtl::bitunpack(packed.data(), n, bits, back.data()) == words);
+            bool ok = back[n] == 7u;
+            for (std::size_t i = 0; i < n; ++i) ok &= back[i] == (v[i] & mask);
+            std::vector<std::uint32_t> back_port(n, 7u);
+            simdtl::detail::bitunpack_blocks_portable(packed.data(), n / 512, bits, back_port.data());
+            for (std::size_t i = 0; i < n / 512 * 512; ++i) ok &= back_port[i] == back[i];
+            CHECK_MESSAGE(ok, "bits=" << bits << " n=" << n);
+        }
+}
+
+TEST_CASE("fused bitunpack_count_if / bitunpack_reduce / bitunpack_sum match unpack-then-scan")
+{
+    for (unsigned bits : {0u, 1u, 3u, 7u, 8u, 13u, 16u, 21u, 27u, 31u, 32u})
+        for (std::size_t n : kSizes)
+        {
+            const auto v = values(n, 420u + bits + static_cast<unsigned>(n));
+            std::vector<std::uint32_t> packed(simdtl::bitpack_words(n, bits) + 1);
+            simdtl::bitpack(v.data(), n, bits, packed.data());
+            std::vector<std::uint32_t> u(n);
+            simdtl::bitunpack(packed.data(), n, bits, u.data());
+
+            const std::uint32_t cut = bits == 0 ? 0u : (bits == 32 ? 0x80000000u : std::uint32_t{1} << (bits - 1));
+            std::size_t want_count = 0;
+            std::uint32_t want_xor = 5u, want_max = 0u;
+            std::uint64_t want_sum = 0;
+            for (std::uint32_t x : u)
+            {
+                want_count += x >= cut;
+                want_xor ^= x;
+                want_max = x > want_max ? x : want_max;
+                want_sum += x;
+            }
+            CHECK(simdtl::bitunpack_count_if(packed.data(), n, bits,
+                                             [cut](auto x) { return x >= decltype(x)(cut); }) == want_count);
+            CHECK(simdtl::bitunpack_reduce(packed.data(), n, bits, 5u, [](auto a, auto b) { return a ^ b; }) == want_xor);
+            CHECK(simdtl::bitunpack_reduce(packed.data(), n, bits, 0u,
+                                           [](auto a, auto b) { return simdtl::elem_max(a, b); }) == want_max);
+            CHECK(simdtl::bitunpack_sum(packed.data(), n, bits) == want_sum);
+        }
+}
+
+TEST_CASE("frame-of-reference column round trip")
+{
+    std::mt19937 gen(430);
+    std::vector<std::int32_t> col(5000);
+    for (auto& x : col) x = 1000000 + static_cast<std::int32_t>(gen() % 3000);
+    const auto [lo, hi] = simdtl::minmax_value(col);
+    std::vector<std::uint32_t> delta(col.size());
+    for (std::size_t i = 0; i < col.size(); ++i) delta[i] = static_cast<std::uint32_t>(col[i] - lo);
+    const unsigned bits = 12;   // 3000 < 2^12
+    std::vector<std::uint32_t> packed(simdtl::bitpack_words(col.size(), bits));
+    CHECK(simdtl::bitpack(delta.data(), delta.size(), bits, packed.data()) == packed.size());
+    CHECK(packed.size() * 32 < col.size() * 13);
+    // rows with value >= lo + 1500, counted on the compressed column
+    std::size_t want = 0;
+    for (auto x : col) want += x >= lo + 1500;
+    CHECK(simdtl::bitunpack_count_if(packed.data(), col.size(), bits,
+                                     [](auto x) { return x >= decltype(x)(1500); }) == want);
+    CHECK(hi - lo < 4096);
+}
+
+TEST_CASE("bitpack kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(bitpack_lvl() == want);
+        CHECK(bitunpack_lvl() == want);
+    }
+#else
+    CHECK(bitpack_slot() == nullptr);
+#endif
+}
@@ -0,0 +1,106 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/differential.hpp"
+#include "support/sizes.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// a > 5 && b < 3 && c == 7 over int8 / float / int64 columns (so the step is
+// the int8 lane count and the float / int64 loads span several registers).
+static const auto mixed_pred = [](auto a, auto b, auto c)
+{
+    using A = decltype(a);
+    using B = decltype(b);
+    using C = decltype(c);
+    return simdtl::mask_and(a > A(5), b < B(3), c == C(7));
+};
+
+static std::vector<std::size_t> test_sizes()
+{
+    std::vector<std::size_t> sizes(kEdgeSizes.begin(), kEdgeSizes.end());
+    sizes.push_back(1025);
+    sizes.push_back(3000);
+    return sizes;
+}
+
+TEST_CASE("count_if / select_bitmap / copy_if_indices over mixed-type columns")
+{
+    for (std::size_t n : test_sizes())
+    {
+        const auto a = make_values<std::int8_t>(n, -10, 20, 470u);
+        const auto b = make_values<float>(n, -2, 8, 471u);
+        const auto c = make_values<std::int64_t>(n, 5, 9, 472u);
+        const auto cols = simdtl::columns(a.data(), b.data(), c.data());
+
+        std::vector<std::uint64_t> want_bits(simdtl::bitmap_words(n), 0);
+        std::vector<std::uint32_t> want_idx;
+        for (std::size_t i = 0; i < n; ++i)
+            if (mixed_pred(a[i], b[i], c[i]))
+            {
+                want_bits[i / 64] |= std::uint64_t{1} << (i % 64);
+                want_idx.push_back(static_cast<std::uint32_t>(i));
+            }
+
+        CHECK_MESSAGE(simdtl::count_if(cols, n, mixed_pred) == want_idx.size(), "n=" << n);
+
+        std::vector<std::uint64_t> bits(want_bits.size() + 1, ~std::uint64_t{0});
+        CHECK_MESSAGE(simdtl::select_bitmap(cols, n, mixed_pred, bits.data()) == want_idx.size(), "n=" << n);
+        bool ok = bits.back() == ~std::uint64_t{0};   // nothing written past the last word
+        for (std::size_t w = 0; w < want_bits.size(); ++w) ok &= bits[w] == want_bits[w];
+        CHECK_MESSAGE(ok, "n=" << n);
+
+        std::vector<std::uint32_t> idx(n);
+        idx.resize(simdtl::copy_if_indices(cols, n, idx.data(), mixed_pred));
+        CHECK_MESSAGE(idx == want_idx, "n=" << n);
+    }
+}
+
+TEST_CASE("same-type columns combine with && and mask_or")
+{
+    for (std::size_t n : test_sizes())
+    {
+        const auto x = make_values<std::int32_t>(n, 0, 99, 473u);
+        const auto y = make_values<std::int32_t>(n, 0, 99, 474u);
+        const auto z = make_values<double>(n, 0, 99, 475u);
+
+        const auto both = [](auto p, auto q) { return p < q && p > decltype(p)(20); };
+        std::size_t want = 0;
+        for (std::size_t i = 0; i < n; ++i) want += both(x[i], y[i]) ? 1u : 0u;
+        CHECK_MESSAGE(simdtl::count_if(simdtl::columns(x.data(), y.data()), n, both) == want, "n=" << n);
+
+        const auto either = [](auto p, auto r)
+        { return simdtl::mask_or(p == decltype(p)(3), r >= decltype(r)(90)); };
+        std::vector<std::uint32_t> want_idx;
+        for (std::size_t i = 0; i < n; ++i)
+            if (either(x[i], z[i])) want_idx.push_back(static_cast<std::uint32_t>(i));
+        std::vector<std::uint32_t> idx(n);
+        idx.resize(simdtl::copy_if_indices(simdtl::columns(x.data(), z.data()), n, idx.data(), either));
+        CHECK_MESSAGE(idx == want_idx, "n=" << n);
+    }
+
+    // One column is the single-range select_bitmap.
+    const std::vector<std::uint16_t> v{1, 2, 3, 4, 5};
+    std::uint64_t bits = 0;
+    CHECK(simdtl::select_bitmap(simdtl::columns(v.data()), v.size(), [](auto x) { return x >= decltype(x)(3); },
+                                &bits) == 3);
+    CHECK(bits == 0b11100u);
+}
+
+TEST_CASE("mask_cast keeps lanes across element types")
+{
+    using V8 = simdtl::native<std::int8_t>;
+    using VD = simdtl::vec<double, V8::size()>;
+    const V8 a([](auto i) { return static_cast<std::int8_t>(i); });
+    const auto m = a > V8(3);
+    const auto md = simdtl::mask_cast<typename VD::mask_type>(m);
+    CHECK(simdtl::mask_bits(md) == simdtl::mask_bits(m));
+    CHECK(simdtl::mask_cast<bool>(true));
+}
@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <random>
+#include <type_traits>
 #include <vector>
 
 using simdtl_test::kEdgeSizes;
@@ -31,6 +33,56 @@ TEST_CASE("copy_if matches std::copy_if")
     }
 }
 
+template <class T>
+static void check_copy_if_indices(unsigned seed)
+{
+    for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{63}, std::size_t{64}, std::size_t{65},
+                          std::size_t{1023}, std::size_t{1024}, std::size_t{1025}, std::size_t{3000}})
+    {
+        auto data = make_values<T>(n, T(0), T(9), seed + (unsigned)n);
+        auto pred_e = [](auto x) { using X = decltype(x); return x < X(3); };
+
+        std::vector<std::uint32_t> expect;
+        for (std::size_t i = 0; i < n; ++i)
+            if (data[i] < T(3)) expect.push_back(static_cast<std::uint32_t>(i));
+        std::vector<std::uint32_t> got(n + 1, 0xDEADBEEFu);
+        const std::size_t k = simdtl::copy_if_indices(data.data(), n, got.data(), pred_e);
+        CHECK(got[n] == 0xDEADBEEFu);
+        got.resize(k);
+        CHECK_MESSAGE(got == expect, "n=" << n);
+
+        // Refine the selection in place: of those, keep the even values.
+        std::vector<std::uint32_t> refined;
+        for (std::uint32_t i : expect)
+            if (data[i] == T(0) || data[i] == T(2)) refined.push_back(i);
+        const std::size_t r = simdtl::copy_if_indices(data.data(), got.data(), k, got.data(),
+                                                      [](auto x) { using X = decltype(x); return x == X(0) || x == X(2); });
+        got.resize(r);
+        CHECK_MESSAGE(got == refined, "refine n=" << n);
+    }
+}
+
+TEST_CASE("copy_if_indices emits and refines selection vectors")
+{
+    check_copy_if_indices<std::int8_t>(111u);
+    check_copy_if_indices<std::int16_t>(112u);
+    check_copy_if_indices<int>(113u);
+    check_copy_if_indices<float>(114u);
+    check_copy_if_indices<double>(115u);
+
+    // A refinement that keeps everything / nothing from a sparse id list.
+    std::vector<int> col(5000);
+    for (std::size_t i = 0; i < col.size(); ++i) col[i] = static_cast<int>(i);
+    std::vector<std::uint32_t> sel;
+    for (std::uint32_t i = 0; i < 5000; i += 3) sel.push_back(i);
+    std::vector<std::uint32_t> out(sel.size());
+    CHECK(simdtl::copy_if_indices(col.data(), sel.data(), sel.size(), out.data(),
+                                  [](auto x) { using X = decltype(x); return x >= X(0); }) == sel.size());
+    CHECK(out == sel);
+    CHECK(simdtl::copy_if_indices(col.data(), sel.data(), sel.size(), out.data(),
+                                  [](auto x) { using X = decltype(x); return x < X(0); }) == 0);
+}
+
 TEST_CASE("remove_if matches std::remove_if")
 {
     for (std::size_t n : kEdgeSizes)
@@ -50,6 +102,78 @@ TEST_CASE("remove_if matches std::remove_if")
     }
 }
 
+// Keys of type K with int32 / float / int64 / double / int16 payloads; rows
+// with key < cut are kept (cut = 10 keeps all, giving all-set bitmap words).
+template <class K>
+static void check_zip(unsigned seed)
+{
+    for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{63}, std::size_t{64}, std::size_t{65},
+                          std::size_t{1000}, std::size_t{1024}, std::size_t{1025}, std::size_t{3000}})
+        for (int cut : {0, 3, 7, 10})
+        {
+            const auto keys = make_values<K>(n, 0, 9, seed + (unsigned)n);
+            const auto p32 = make_values<std::int32_t>(n, -1000, 1000, seed + 1u);
+            const auto pf = make_values<float>(n, -1000, 1000, seed + 2u);
+            const auto p64 = make_values<std::int64_t>(n, -1000, 1000, seed + 3u);
+            const auto pd = make_values<double>(n, -1000, 1000, seed + 4u);
+            const auto p16 = make_values<std::int16_t>(n, -1000, 1000, seed + 5u);
+            const auto pred = [cut](auto x) { using X = decltype(x); return x < X(cut); };
+
+            std::vector<std::size_t> rows;
+            for (std::size_t i = 0; i < n; ++i)
+                if (keys[i] < K(cut)) rows.push_back(i);
+            const auto pick = [&rows](const auto& col, bool keep)
+            {
+                std::remove_cvref_t<decltype(col)> r;
+                for (std::size_t i = 0, j = 0; i < col.size(); ++i)
+                {
+                    const bool in = j < rows.size() && rows[j] == i;
+                    if (in) ++j;
+                    if (in == keep) r.push_back(col[i]);
+                }
+                return r;
+            };
+
+            std::vector<K> ko(n);
+            std::vector<std::int32_t> o32(n);
+            std::vector<float> of(n);
+            std::vector<std::int64_t> o64(n);
+            std::vector<double> od(n);
+            std::vector<std::int16_t> o16(n);
+            const std::size_t k = simdtl::copy_if_zip(keys.data(), n, ko.data(), pred,
+                                                      simdtl::payload(p32.data(), o32.data()),
+                                                      simdtl::payload(pf.data(), of.data()),
+                                                      simdtl::payload(p64.data(), o64.data()),
+                                                      simdtl::payload(pd.data(), od.data()),
+                                                      simdtl::payload(p16.data(), o16.data()));
+            CHECK_MESSAGE(k == rows.size(), "n=" << n << " cut=" << cut);
+            ko.resize(k); o32.resize(k); of.resize(k); o64.resize(k); od.resize(k); o16.resize(k);
+            bool ok = ko == pick(keys, true) && o32 == pick(p32, true) && of == pick(pf, true);
+            ok &= o64 == pick(p64, true) && od == pick(pd, true) && o16 == pick(p16, true);
+            CHECK_MESSAGE(ok, "copy_if_zip n=" << n << " cut=" << cut);
+
+            auto rk = keys;
+            auto r32 = p32;
+            auto rf = pf;
+            auto r64 = p64;
+            auto rd = pd;
+            const std::size_t r = simdtl::remove_if_zip(rk.data(), n, pred, r32.data(), rf.data(), r64.data(), rd.data());
+            CHECK_MESSAGE(r == n - rows.size(), "n=" << n << " cut=" << cut);
+            rk.resize(r); r32.resize(r); rf.resize(r); r64.resize(r); rd.resize(r);
+            ok = rk == pick(keys, false) && r32 == pick(p32, false) && rf == pick(pf, false);
+            ok &= r64 == pick(p64, false) && rd == pick(pd, false);
+            CHECK_MESSAGE(ok, "remove_if_zip n=" << n << " cut=" << cut);
+        }
+}
+
+TEST_CASE("copy_if_zip / remove_if_zip compact payload columns with the keys")
+{
+    check_zip<std::int32_t>(121u);
+    check_zip<std::int64_t>(122u);
+    check_zip<std::int16_t>(123u);   // keys compacted by the portable path
+    check_zip<float>(124u);
+}
+
 template <class T>
 static void check_remove_matches_std()
 {
@@ -92,19 +216,124 @@ TEST_CASE("reverse matches std::reverse (dispatched int32 + portable any-size)")
     check_reverse<float>();
 }
 
-TEST_CASE("unique matches std::unique")
+template <class T>
+static void check_unique()
 {
     for (std::size_t n : kEdgeSizes)
     {
         // small value range -> plenty of consecutive duplicates
-        auto data = make_values<int>(n, 0, 2, 505u + (unsigned)n);
+        auto data = make_values<T>(n, 0, 2, 505u + (unsigned)n);
         auto e = data;
         e.erase(std::unique(e.begin(), e.end()), e.end());
+        auto p = data;
         data.resize(simdtl::unique(data.data(), n));
         CHECK(data == e);
+        p.resize(simdtl::detail::unique_portable(p.data(), n));
+        CHECK(p == e);
+        CHECK(simdtl::count_runs(e.data(), e.size()) == e.size());
+    }
+}
+
+TEST_CASE("unique matches std::unique (dispatched 1/2/4/8-byte + portable)")
+{
+    check_unique<std::int8_t>();
+    check_unique<std::int16_t>();
+    check_unique<std::int32_t>();
+    check_unique<std::int64_t>();
+    check_unique<std::uint32_t>();   // sign-agnostic routing through the int32 kernel
+    check_unique<float>();           // portable
+
+    // long runs straddling whole registers, then all-distinct
+    std::vector<std::int32_t> runs(1000);
+    for (std::size_t i = 0; i < runs.size(); ++i) runs[i] = static_cast<std::int32_t>(i / 37);
+    auto e = runs;
+    e.erase(std::unique(e.begin(), e.end()), e.end());
+    runs.resize(simdtl::unique(runs.data(), runs.size()));
+    CHECK(runs == e);
+}
+
+template <class T>
+static void check_adjacent()
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        // wide range -> equal neighbours are rare, so the hit position varies
+        auto data = make_values<T>(n, 0, 60, 515u + (unsigned)n);
+        const auto off = static_cast<std::size_t>(std::adjacent_find(data.begin(), data.end()) - data.begin());
+        CHECK(static_cast<std::size_t>(simdtl::adjacent_find(data.data(), n) - data.data()) == off);
+
+        auto gt_s = [](T a, T b) { return a > b; };
+        auto gt_e = [](auto a, auto b) { return a > b; };
+        const auto off2 = static_cast<std::size_t>(std::adjacent_find(data.begin(), data.end(), gt_s) - data.begin());
+        CHECK(static_cast<std::size_t>(simdtl::adjacent_find(data.data(), n, gt_e) - data.data()) == off2);
+
+        auto u = data;
+        u.erase(std::unique(u.begin(), u.end()), u.end());
+        CHECK(simdtl::count_runs(data.data(), n) == u.size());
     }
 }
 
+TEST_CASE("adjacent_find / count_runs match the STL")
+{
+    check_adjacent<std::int8_t>();
+    check_adjacent<std::int32_t>();
+    check_adjacent<std::int64_t>();
+    check_adjacent<double>();
+}
+
+template <class T>
+static void check_expand()
+{
+    for (std::size_t n : kEdgeSizes)
+        for (unsigned density : {0u, 3u, 50u, 100u})   // percent of rows selected
+        {
+            std::mt19937 gen(707u + static_cast<unsigned>(n) + density);
+            std::vector<std::uint64_t> bits((n + 63) / 64 + 1, 0);
+            for (std::size_t i = 0; i < n; ++i)
+                if (gen() % 100 < density) bits[i / 64] |= std::uint64_t{1} << (i % 64);
+            const auto first = make_values<T>(n, -50, 50, 717u + static_cast<unsigned>(n));
+            std::size_t selected = 0;
+            for (std::size_t i = 0; i < n; ++i) selected += (bits[i / 64] >> (i % 64)) & 1u;
+            const auto dense = make_values<T>(selected, 60, 120, 727u + static_cast<unsigned>(n));   // exact size
+
+            std::vector<T> e(n);
+            for (std::size_t i = 0, k = 0; i < n; ++i)
+                e[i] = ((bits[i / 64] >> (i % 64)) & 1u) ? dense[k++] : first[i];
+
+            std::vector<T> got(n);
+            CHECK(simdtl::expand(first.data(), n, bits.data(), dense.data(), got.data()) == selected);
+            CHECK(got == e);
+            auto p = first;   // portable, in place (out aliases first)
+            CHECK(simdtl::detail::expand_portable(p.data(), n, bits.data(), dense.data(), p.data()) == selected);
+            CHECK(p == e);
+            auto a = first;   // dispatched, in place
+            simdtl::expand(a.data(), n, bits.data(), dense.data(), a.data());
+            CHECK(a == e);
+        }
+}
+
+TEST_CASE("expand is the inverse of copy_if (dispatched 1/2/4/8-byte + portable)")
+{
+    check_expand<std::int8_t>();
+    check_expand<std::int16_t>();
+    check_expand<std::int32_t>();
+    check_expand<std::int64_t>();
+    check_expand<float>();    // routes through the int32 kernel
+    check_expand<double>();
+}
+
+TEST_CASE("expand_load fills kept lanes in order, passthrough elsewhere")
+{
+    using V = simdtl::native<std::int32_t>;
+    constexpr std::size_t W = V::size();
+    std::vector<std::int32_t> src(W);
+    for (std::size_t j = 0; j < W; ++j) src[j] = static_cast<std::int32_t>(100 + j);
+    const V iota([](auto j) { return static_cast<std::int32_t>(j); });
+    const V r = simdtl::expand_load(src.data(), (iota & 1) == 1, V(-1));
+    for (std::size_t j = 0; j < W; ++j)
+        CHECK(r[j] == ((j & 1) ? static_cast<std::int32_t>(100 + j / 2) : -1));
+}
+
 TEST_CASE("partition matches std::stable_partition (stable + partition point)")
 {
     for (std::size_t n : kEdgeSizes)
@@ -130,6 +359,23 @@ TEST_CASE("M3 kernels installed when the CPU supports AVX2")
         CHECK(remove_i16_slot() != nullptr);
         CHECK(remove_i8_slot()  != nullptr);
         CHECK(reverse_i32_slot() != nullptr);
+        CHECK(unique_i8_slot()  != nullptr);
+        CHECK(unique_i16_slot() != nullptr);
+        CHECK(unique_i32_slot() != nullptr);
+        CHECK(unique_i64_slot() != nullptr);
+        CHECK(expand_i32_slot() != nullptr);
+        CHECK(expand_i64_slot() != nullptr);
+        CHECK(compress_bits_i32_slot() != nullptr);
+        CHECK(compress_bits_i64_slot() != nullptr);
+    }
+    if (best_isa() >= isa_level::avx512)
+    {
+        CHECK(unique_i32_lvl() == isa_level::avx512);
+        CHECK(unique_i64_lvl() == isa_level::avx512);
+        CHECK(expand_i32_lvl() == isa_level::avx512);
+        CHECK(expand_i64_lvl() == isa_level::avx512);
+        CHECK(compress_bits_i32_lvl() == isa_level::avx512);
+        CHECK(compress_bits_i64_lvl() == isa_level::avx512);
     }
 #endif
 }
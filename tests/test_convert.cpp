@@ -0,0 +1,234 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// Saturating reference in long double (exact for every pair tested here).
+template <class Out, class In>
+static Out saturate_ref(In x, bool round)
+{
+    if constexpr (std::is_floating_point_v<In> && std::is_integral_v<Out>)
+    {
+        if (std::isnan(x)) return Out(0);
+        long double t = round ? std::nearbyint(static_cast<long double>(x)) : std::trunc(static_cast<long double>(x));
+        if (t < static_cast<long double>(std::numeric_limits<Out>::min())) return std::numeric_limits<Out>::min();
+        if (t > static_cast<long double>(std::numeric_limits<Out>::max())) return std::numeric_limits<Out>::max();
+        return static_cast<Out>(t);
+    }
+    else if constexpr (std::is_floating_point_v<In> && std::is_floating_point_v<Out> && sizeof(Out) < sizeof(In))
+    {
+        if (std::isnan(x)) return static_cast<Out>(x);
+        const In hi = std::numeric_limits<Out>::max();
+        return static_cast<Out>(x < -hi ? -hi : hi < x ? hi : x);
+    }
+    else if constexpr (std::is_integral_v<In> && std::is_integral_v<Out>)
+    {
+        const long double t = x;
+        if (t < static_cast<long double>(std::numeric_limits<Out>::min())) return std::numeric_limits<Out>::min();
+        if (t > static_cast<long double>(std::numeric_limits<Out>::max())) return std::numeric_limits<Out>::max();
+        return static_cast<Out>(x);
+    }
+    else
+    {
+        return static_cast<Out>(x);
+    }
+}
+
+// Random values over In's range (or +-1e12 for floats) salted with the edges:
+// In's extremes, Out's limits +-1, ties at .5, and NaN / +-inf for floats.
+template <class In, class Out>
+static std::vector<In> edge_mix(std::size_t n, unsigned seed)
+{
+    std::vector<In> v(n);
+    std::mt19937_64 gen(seed);
+    std::vector<In> specials{In(0), std::numeric_limits<In>::min(), std::numeric_limits<In>::max(),
+                             std::numeric_limits<In>::lowest()};
+    for (long double b : {static_cast<long double>(std::numeric_limits<Out>::min()),
+                          static_cast<long double>(std::numeric_limits<Out>::max())})
+        for (long double d : {-1.0L, 0.0L, 1.0L})
+            if (b + d >= static_cast<long double>(std::numeric_limits<In>::lowest()) &&
+                b + d <= static_cast<long double>(std::numeric_limits<In>::max()))
+                specials.push_back(static_cast<In>(b + d));
+    if constexpr (std::is_floating_point_v<In>)
+        for (In s : {In(0.5), In(-0.5), In(1.5), In(2.5), In(-2.5), In(254.5), In(255.5), In(-0.0),
+                     std::numeric_limits<In>::quiet_NaN(), std::numeric_limits<In>::infinity(),
+                     -std::numeric_limits<In>::infinity(), In(2147483520.0), In(2147483648.0), In(-2147483904.0)})
+            specials.push_back(s);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (gen() % 4 == 0) { v[i] = specials[gen() % specials.size()]; continue; }
+        if constexpr (std::is_floating_point_v<In>)
+        {
+            const double mag = std::ldexp(1.0, static_cast<int>(gen() % 41));   // up to ~1e12
+            v[i] = static_cast<In>(std::uniform_real_distribution<double>(-mag, mag)(gen));
+        }
+        else
+        {
+            v[i] = static_cast<In>(gen());
+        }
+    }
+    return v;
+}
+
+template <class In, class Out>
+static void check_saturate()
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = edge_mix<In, Out>(n + 3, 380u + (unsigned)n);
+        std::vector<Out> got(n + 3, Out(7)), port(n + 3, Out(7));
+        simdtl::convert_saturate(v.data(), n, got.data());
+        simdtl::detail::convert_saturate_portable(v.data(), n, port.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const Out want = saturate_ref<Out>(v[i], false);
+            const auto same = [&](Out a) { return a == want || (a != a && want != want); };
+            ok &= same(got[i]) && same(port[i]);
+        }
+        CHECK(ok);
+        CHECK(got[n] == Out(7));   // nothing written past n
+    }
+}
+
+template <class In, class Out>
+static void check_round()
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = edge_mix<In, Out>(n + 3, 390u + (unsigned)n);
+        std::vector<Out> got(n + 3, Out(7)), port(n + 3, Out(7));
+        simdtl::convert_round(v.data(), n, got.data());
+        simdtl::detail::convert_round_portable(v.data(), n, port.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const Out want = saturate_ref<Out>(v[i], true);
+            ok &= got[i] == want && port[i] == want;
+        }
+        CHECK(ok);
+        CHECK(got[n] == Out(7));
+    }
+}
+
+TEST_CASE("convert_saturate clamps to the target range (dispatched and portable)")
+{
+    check_saturate<std::int32_t, std::int16_t>();   // dispatched
+    check_saturate<std::int32_t, std::uint8_t>();
+    check_saturate<std::int16_t, std::int8_t>();
+    check_saturate<std::int16_t, std::uint8_t>();
+    check_saturate<std::int64_t, std::int32_t>();   // portable only
+    check_saturate<std::uint32_t, std::int16_t>();
+    check_saturate<std::int8_t, std::uint16_t>();
+    check_saturate<std::uint16_t, std::uint8_t>();
+    check_saturate<float, std::int32_t>();
+    check_saturate<float, std::uint8_t>();
+    check_saturate<double, std::int16_t>();
+    check_saturate<double, std::uint32_t>();
+    check_saturate<double, float>();
+    check_saturate<std::int32_t, float>();
+    check_saturate<std::int64_t, float>();
+    check_saturate<std::uint64_t, float>();
+}
+
+TEST_CASE("convert_round rounds to nearest-even, saturating, NaN -> 0")
+{
+    check_round<float, std::int32_t>();   // dispatched
+    check_round<float, std::uint8_t>();
+    check_round<float, std::int16_t>();   // portable only
+    check_round<double, std::int64_t>();
+    check_round<double, std::uint8_t>();
+
+    const std::vector<float> f{0.5f, 1.5f, 2.5f, -0.5f, -1.5f, 254.5f, 255.5f, -3.0f};
+    std::vector<std::uint8_t> u(f.size());
+    simdtl::convert_round(f.data(), f.size(), u.data());
+    CHECK(u == std::vector<std::uint8_t>{0, 2, 2, 0, 0, 254, 255, 0});
+}
+
+template <class In, class Out>
+static void check_convert(long long lo, long long hi)
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = make_values<In>(n, lo, hi, 400u + (unsigned)n);
+        std::vector<Out> got(n), port(n);
+        simdtl::convert(v.data(), n, got.data());
+        simdtl::detail::convert_portable(v.data(), n, port.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i) ok &= got[i] == static_cast<Out>(v[i]) && port[i] == got[i];
+        CHECK(ok);
+    }
+}
+
+TEST_CASE("convert is a lane-wise static_cast (widening, narrowing wraps)")
+{
+    check_convert<std::uint8_t, float>(0, 255);   // dispatched
+    check_convert<std::int8_t, double>(-128, 127);
+    check_convert<std::int32_t, std::int16_t>(-1000000, 1000000);   // wraps
+    check_convert<std::uint16_t, std::int64_t>(0, 65535);
+    check_convert<float, std::int32_t>(-100000, 100000);
+    check_convert<double, float>(-100000, 100000);
+    check_convert<std::int32_t, std::int32_t>(-5, 5);
+}
+
+TEST_CASE("transform between element types")
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto px = make_values<std::uint8_t>(n, 0, 255, 410u + (unsigned)n);
+        std::vector<float> norm(n);
+        simdtl::transform(px.data(), n, norm.data(), [](auto x) { return simdtl::lane_cast<float>(x) * (1.0f / 255); });
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i) ok &= norm[i] == float(px[i]) * (1.0f / 255);
+        CHECK(ok);
+
+        // int32 -> int16 after an op done in int32 (the op result is cast, not saturated).
+        const auto a = make_values<std::int32_t>(n, -20000, 20000, 411u + (unsigned)n);
+        std::vector<std::int16_t> half(n);
+        simdtl::transform(a.data(), n, half.data(), [](auto x) { return x / 2; });
+        ok = true;
+        for (std::size_t i = 0; i < n; ++i) ok &= half[i] == std::int16_t(a[i] / 2);
+        CHECK(ok);
+
+        // float -> double widening with a saturating narrow composed in.
+        const auto f = make_values<float>(n, -100000, 100000, 412u + (unsigned)n);
+        std::vector<std::int8_t> s8(n);
+        simdtl::transform(f.data(), n, s8.data(), simdtl::detail::saturate_op<std::int8_t>{});
+        ok = true;
+        for (std::size_t i = 0; i < n; ++i) ok &= s8[i] == saturate_ref<std::int8_t>(f[i], false);
+        CHECK(ok);
+    }
+}
+
+TEST_CASE("conversion kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(convert_sat_i32_i16_lvl() == want);
+        CHECK(convert_sat_i32_u8_lvl() == want);
+        CHECK(convert_sat_i16_i8_lvl() == want);
+        CHECK(convert_sat_i16_u8_lvl() == want);
+        CHECK(convert_u8_f32_lvl() == want);
+        CHECK(convert_round_f32_i32_lvl() == want);
+        CHECK(convert_round_f32_u8_lvl() == want);
+    }
+#else
+    CHECK(convert_sat_i32_i16_slot() == nullptr);
+#endif
+}
@@ -0,0 +1,167 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+TEST_CASE("group_match / group_match_empty / group_match_free match the scalar lane tests")
+{
+    std::mt19937 gen(500u);
+    const std::int8_t pool[] = {0, 1, 5, 127, 42, simdtl::ctrl_empty, simdtl::ctrl_deleted};
+    for (int trial = 0; trial < 2000; ++trial)
+    {
+        alignas(16) std::int8_t ctrl[simdtl::group_width + 1];
+        for (auto& c : ctrl) c = pool[gen() % 7];
+        const std::int8_t* g = ctrl + trial % 2;   // aligned and unaligned groups
+        const std::int8_t h2 = pool[gen() % 5];
+        std::uint32_t want_h2 = 0, want_empty = 0, want_free = 0;
+        for (std::size_t j = 0; j < simdtl::group_width; ++j)
+        {
+            want_h2 |= std::uint32_t{g[j] == h2} << j;
+            want_empty |= std::uint32_t{g[j] == simdtl::ctrl_empty} << j;
+            want_free |= std::uint32_t{g[j] < 0} << j;
+        }
+        CHECK(simdtl::group_match(g, h2).bits() == want_h2);
+        CHECK(simdtl::group_match_empty(g).bits() == want_empty);
+        CHECK(simdtl::group_match_free(g).bits() == want_free);
+
+        std::uint32_t seen = 0;
+        int last = -1;
+        for (int j : simdtl::group_match(g, h2))
+        {
+            CHECK(j > last);
+            last = j;
+            seen |= 1u << j;
+        }
+        CHECK(seen == want_h2);
+        CHECK(simdtl::group_match(g, h2).count() == std::popcount(want_h2));
+    }
+}
+
+template <class K>
+static void check_set(unsigned seed, std::uint64_t key_range)
+{
+    std::mt19937_64 gen(seed);
+    simdtl::flat_hash_set<K> set;
+    std::unordered_set<K> ref;
+    for (int op = 0; op < 60000; ++op)
+    {
+        const K key = static_cast<K>(gen() % key_range);
+        switch (gen() % 4)
+        {
+        case 0:
+        case 1: CHECK(set.insert(key) == ref.insert(key).second); break;
+        case 2: CHECK(set.erase(key) == (ref.erase(key) == 1)); break;
+        default: CHECK(set.contains(key) == (ref.count(key) == 1)); break;
+        }
+    }
+    CHECK(set.size() == ref.size());
+    std::size_t visited = 0;
+    set.for_each([&](K k) { CHECK(ref.count(k) == 1); ++visited; });
+    CHECK(visited == ref.size());
+
+    // Batched forms, with duplicates inside the batch.
+    std::vector<K> batch(5000);
+    for (auto& k : batch) k = static_cast<K>(gen() % key_range);
+    std::size_t want_added = 0;
+    for (K k : batch) want_added += ref.insert(k).second ? 1u : 0u;
+    CHECK(set.insert_many(batch.data(), batch.size()) == want_added);
+    CHECK(set.size() == ref.size());
+    for (auto& k : batch) k = static_cast<K>(gen() % key_range);
+    const std::unique_ptr<bool[]> found(new bool[batch.size()]);
+    std::size_t want_hits = 0;
+    const std::size_t hits = set.contains_many(batch.data(), batch.size(), found.get());
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        CHECK(found[i] == (ref.count(batch[i]) == 1));
+        want_hits += ref.count(batch[i]);
+    }
+    CHECK(hits == want_hits);
+
+    set.clear();
+    CHECK(set.empty());
+    CHECK_FALSE(set.contains(batch[0]));
+}
+
+TEST_CASE("flat_hash_set agrees with std::unordered_set under insert / erase / lookup")
+{
+    check_set<std::uint32_t>(501u, 3000);      // dense: many duplicates and tombstones
+    check_set<std::int64_t>(502u, 1u << 30);   // sparse: growth
+    check_set<std::uint16_t>(503u, 65536);
+    check_set<std::int8_t>(504u, 256);
+}
+
+TEST_CASE("flat_hash_map agrees with std::unordered_map")
+{
+    std::mt19937_64 gen(505u);
+    simdtl::flat_hash_map<std::uint64_t, double> map;
+    std::unordered_map<std::uint64_t, double> ref;
+    for (int op = 0; op < 60000; ++op)
+    {
+        const std::uint64_t key = gen() % 4000;
+        const double v = static_cast<double>(gen() % 1000);
+        switch (gen() % 5)
+        {
+        case 0: CHECK(map.insert(key, v) == ref.insert({key, v}).second); break;
+        case 1: CHECK(map.insert_or_assign(key, v) == ref.insert_or_assign(key, v).second); break;
+        case 2: map[key] += v; ref[key] += v; break;
+        case 3: CHECK(map.erase(key) == (ref.erase(key) == 1)); break;
+        default:
+        {
+            const double* p = map.find(key);
+            const auto it = ref.find(key);
+            REQUIRE((p != nullptr) == (it != ref.end()));
+            if (p) CHECK(*p == it->second);
+        }
+        }
+    }
+    CHECK(map.size() == ref.size());
+    map.for_each([&](std::uint64_t k, double v) { CHECK(ref.at(k) == v); });
+
+    std::vector<std::uint64_t> keys(3000);
+    std::vector<double> vals(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) { keys[i] = gen() % 8000; vals[i] = static_cast<double>(i); }
+    std::size_t want_added = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) want_added += ref.insert({keys[i], vals[i]}).second ? 1u : 0u;
+    CHECK(map.insert_many(keys.data(), vals.data(), keys.size()) == want_added);
+
+    for (auto& k : keys) k = gen() % 10000;
+    std::vector<double> out(keys.size());
+    std::size_t want_hits = 0;
+    const std::size_t hits = map.find_many(keys.data(), keys.size(), out.data(), -1.0);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        const auto it = ref.find(keys[i]);
+        CHECK(out[i] == (it == ref.end() ? -1.0 : it->second));
+        want_hits += it != ref.end() ? 1u : 0u;
+    }
+    CHECK(hits == want_hits);
+}
+
+TEST_CASE("flat_hash_set reserve and tombstone reuse keep the capacity bounded")
+{
+    simdtl::flat_hash_set<std::uint32_t> set(1000);
+    const std::size_t cap = set.capacity();
+    CHECK(cap >= 1000);
+    for (std::uint32_t k = 0; k < 1000; ++k) CHECK(set.insert(k));
+    CHECK(set.capacity() == cap);
+
+    // Churn: a sliding window of live keys never needs more room.
+    for (std::uint32_t k = 1000; k < 200000; ++k)
+    {
+        CHECK(set.erase(k - 1000));
+        CHECK(set.insert(k));
+    }
+    CHECK(set.size() == 1000);
+    CHECK(set.capacity() == cap);
+    for (std::uint32_t k = 199000; k < 200000; ++k) CHECK(set.contains(k));
+    CHECK_FALSE(set.contains(0));
+}
@@ -0,0 +1,156 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// Indices drawn with replacement from a table of 300 rows, so take sees repeats
+// and scatter sees duplicate targets (where the last write must win).
+template <class T, class I>
+static void check_take_scatter()
+{
+    const std::size_t rows = 300;
+    const auto table = make_values<T>(rows, -1000, 1000, 801u);
+    for (std::size_t m : kEdgeSizes)
+    {
+        const auto idx = make_values<I>(m, 0, static_cast<long long>(rows - 1), 811u + (unsigned)m);
+
+        std::vector<T> e(m), got(m, T{});
+        for (std::size_t j = 0; j < m; ++j) e[j] = table[static_cast<std::size_t>(idx[j])];
+        simdtl::take(table.data(), idx.data(), m, got.data());
+        CHECK(got == e);
+        std::vector<T> p(m, T{});
+        simdtl::detail::take_portable(table.data(), idx.data(), m, p.data());
+        CHECK(p == e);
+
+        const auto vals = make_values<T>(m, -50, 50, 821u + (unsigned)m);
+        std::vector<T> de(rows, T(7));
+        for (std::size_t j = 0; j < m; ++j) de[static_cast<std::size_t>(idx[j])] = vals[j];
+        std::vector<T> dg(rows, T(7));
+        simdtl::scatter(vals.data(), idx.data(), m, dg.data());
+        CHECK(dg == de);
+    }
+}
+
+TEST_CASE("take / scatter match the scalar loops (dispatched int32-index take + portable)")
+{
+    check_take_scatter<std::int32_t, std::int32_t>();   // 32-bit gather kernels
+    check_take_scatter<float,        std::int32_t>();
+    check_take_scatter<std::int64_t, std::int32_t>();   // 64-bit values, 32-bit indices
+    check_take_scatter<double,       std::int32_t>();
+    check_take_scatter<std::int32_t, std::uint32_t>();  // selection vectors: same kernels
+    check_take_scatter<double,       std::uint32_t>();
+    check_take_scatter<std::int16_t, std::int32_t>();   // portable
+    check_take_scatter<std::int32_t, std::size_t>();    // portable (64-bit indices)
+}
+
+template <class T>
+static void check_sparse_dot()
+{
+    const auto dense = make_values<T>(500, -20, 20, 831u);
+    for (std::size_t nnz : kEdgeSizes)
+    {
+        const auto idx  = make_values<std::int32_t>(nnz, 0, 499, 841u + (unsigned)nnz);
+        const auto vals = make_values<T>(nnz, -20, 20, 851u + (unsigned)nnz);
+        // Small whole numbers: every partial sum is exact, so any summation order agrees.
+        T e{};
+        for (std::size_t j = 0; j < nnz; ++j) e += vals[j] * dense[static_cast<std::size_t>(idx[j])];
+        CHECK(simdtl::sparse_dot(dense.data(), idx.data(), vals.data(), nnz) == e);
+        CHECK(simdtl::detail::sparse_dot_portable(dense.data(), idx.data(), vals.data(), nnz) == e);
+    }
+}
+
+TEST_CASE("sparse_dot matches the sequential sum (exact on whole-number data)")
+{
+    check_sparse_dot<float>();
+    check_sparse_dot<double>();
+    check_sparse_dot<std::int64_t>();   // portable
+}
+
+TEST_CASE("sparse_dot on fractional data stays within reassociation error")
+{
+    std::vector<float> dense(4096);
+    for (std::size_t i = 0; i < dense.size(); ++i) dense[i] = std::sin(static_cast<float>(i)) * 0.37f;
+    const auto idx = make_values<std::int32_t>(1000, 0, 4095, 861u);
+    std::vector<float> vals(idx.size());
+    for (std::size_t j = 0; j < vals.size(); ++j) vals[j] = 1.0f / static_cast<float>(j + 3);
+    double e = 0, mag = 0;
+    for (std::size_t j = 0; j < vals.size(); ++j)
+    {
+        e += static_cast<double>(vals[j]) * dense[static_cast<std::size_t>(idx[j])];
+        mag += std::fabs(static_cast<double>(vals[j]) * dense[static_cast<std::size_t>(idx[j])]);
+    }
+    const float got = simdtl::sparse_dot(dense.data(), idx.data(), vals.data(), vals.size());
+    CHECK(std::fabs(static_cast<double>(got) - e) <= 1e-5 * mag);
+}
+
+// Counts calls into the take slots, then does the lookup itself.
+static std::size_t g_take_calls = 0;
+static void counting_take_i32(const std::int32_t* v, const std::int32_t* idx, std::size_t m, std::int32_t* out) noexcept
+{
+    ++g_take_calls;
+    simdtl::detail::take_portable(v, idx, m, out);
+}
+static void counting_take_i64(const std::int64_t* v, const std::int32_t* idx, std::size_t m, std::int64_t* out) noexcept
+{
+    ++g_take_calls;
+    simdtl::detail::take_portable(v, idx, m, out);
+}
+
+TEST_CASE("uint32 indices (selection vectors) dispatch to the int32 gather slots")
+{
+    using namespace simdtl::platform;
+    const auto saved32 = take_i32_slot();
+    const auto saved64 = take_i64_slot();
+    take_i32_slot() = &counting_take_i32;
+    take_i64_slot() = &counting_take_i64;
+    g_take_calls = 0;
+
+    const std::vector<float> f{1, 2, 3, 4};
+    const std::vector<double> d{1, 2, 3, 4};
+    const std::vector<std::uint32_t> sel{3, 0, 2};
+    std::vector<float> fo(3);
+    std::vector<double> dout(3);
+    simdtl::take(f.data(), sel.data(), sel.size(), fo.data());
+    simdtl::take(d.data(), sel.data(), sel.size(), dout.data());
+    CHECK(g_take_calls == 2);
+    CHECK(fo == std::vector<float>{4, 1, 3});
+    CHECK(dout == std::vector<double>{4, 1, 3});
+
+    // The refining copy_if_indices fetches its values through take.
+    std::vector<std::uint32_t> out(sel.size());
+    CHECK(simdtl::copy_if_indices(f.data(), sel.data(), sel.size(), out.data(), simdtl::gt(1.5f)) == 2);
+    CHECK(g_take_calls == 3);
+    CHECK(out[0] == 3u);
+    CHECK(out[1] == 2u);
+
+    take_i32_slot() = saved32;
+    take_i64_slot() = saved64;
+}
+
+TEST_CASE("gather kernels installed when the CPU has fast gathers")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2 && !detect_cpu_features().slow_gather)
+    {
+        CHECK(take_i32_slot() != nullptr);
+        CHECK(take_i64_slot() != nullptr);
+        CHECK(sparse_dot_f32_slot() != nullptr);
+        CHECK(sparse_dot_f64_slot() != nullptr);
+    }
+    if (best_isa() >= isa_level::avx512 && !detect_cpu_features().slow_gather)
+        CHECK(take_i32_lvl() == isa_level::avx512);
+#else
+    CHECK(take_i32_slot() == nullptr);
+#endif
+}
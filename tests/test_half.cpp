@@ -0,0 +1,182 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+
+static bool is_nan32(std::uint32_t x) { return (x & 0x7FFFFFFFu) > 0x7F800000u; }
+
+// Every 16-bit pattern, in order.
+static std::vector<std::uint16_t> all_halves()
+{
+    std::vector<std::uint16_t> h(65536);
+    for (std::size_t i = 0; i < h.size(); ++i) h[i] = static_cast<std::uint16_t>(i);
+    return h;
+}
+
+// Random float bit patterns salted with the rounding edges of both formats:
+// signed zeros, infinities, quiet / signalling NaNs with payloads, float
+// subnormals, fp16 subnormal / normal boundaries, ties (even and odd), and the
+// fp16 overflow threshold 65520.
+static std::vector<float> edge_floats(std::size_t n, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    const std::uint32_t specials[] = {
+        0x00000000u, 0x80000000u, 0x7F800000u, 0xFF800000u, 0x7FC00000u, 0xFFC00001u, 0x7F800001u, 0x7FA5A5A5u,
+        0x00000001u, 0x807FFFFFu, 0x00400000u, 0x00018000u,   // float subnormals
+        0x33000000u, 0x33000001u, 0x33800000u, 0x387FE000u, 0x387FF000u, 0x38800000u, 0x38801000u, 0x38803000u,
+        0x477FE000u, 0x477FEFFFu, 0x477FF000u, 0x7F7FFFFFu,   // 65504, just below / at 65520, FLT_MAX
+        0x3F808000u, 0x3F818000u, 0x3F807FFFu, 0x3F808001u,   // bf16 ties (even / odd) and neighbours
+        0x3F801000u, 0x3F803000u, 0x3F800FFFu, 0x7F7F8000u, 0x7F7F7FFFu};
+    std::vector<float> v(n);
+    for (auto& x : v)
+    {
+        std::uint32_t bits = gen();
+        if (gen() % 4 == 0) bits = specials[gen() % std::size(specials)] ^ (gen() % 2 ? 0x80000000u : 0u);
+        else if (gen() % 2) bits = (bits & 0x807FFFFFu) | ((100u + gen() % 50u) << 23);   // fp16-ish exponents
+        x = std::bit_cast<float>(bits);
+    }
+    return v;
+}
+
+// Independent round-half-even reference: pick the nearer of the two
+// representable neighbours of x in double (where x and both neighbours are
+// exact), ties to the even pattern.
+static std::uint16_t bf16_ref(float f)
+{
+    const std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+    const std::uint32_t lo = x & 0xFFFF0000u;
+    if (lo == x || (x & 0x7F800000u) == 0x7F800000u) return static_cast<std::uint16_t>(x >> 16);
+    const std::uint32_t hi = lo + 0x10000u;
+    const double d = std::abs(static_cast<double>(f));
+    const double dl = d - std::abs(static_cast<double>(std::bit_cast<float>(lo)));
+    const double up = (hi & 0x7FFFFFFFu) == 0x7F800000u ? std::ldexp(1.0, 128) : std::abs(static_cast<double>(std::bit_cast<float>(hi)));
+    const double du = up - d;
+    if (dl < du) return static_cast<std::uint16_t>(lo >> 16);
+    if (du < dl) return static_cast<std::uint16_t>(hi >> 16);
+    return static_cast<std::uint16_t>(((lo >> 16) & 1u) ? hi >> 16 : lo >> 16);
+}
+
+TEST_CASE("f16 -> f32 is exact over all 65536 patterns")
+{
+    const auto h = all_halves();
+    std::vector<float> got(h.size()), port(h.size());
+    simdtl::convert_f16_to_f32(h.data(), h.size(), got.data());
+    simdtl::detail::f16_to_f32_portable(h.data(), h.size(), port.data());
+    bool same = true, exact = true;
+    for (std::size_t i = 0; i < h.size(); ++i)
+    {
+        const std::uint32_t g = std::bit_cast<std::uint32_t>(got[i]);
+        same &= g == std::bit_cast<std::uint32_t>(port[i]);
+        const std::uint32_t em = h[i] & 0x7FFFu;
+        if (em > 0x7C00u) { exact &= is_nan32(g) && (g & 0x00400000u) && (g >> 31) == (h[i] >> 15u); continue; }
+        const double want = (em >= 0x7C00u ? INFINITY
+                             : em >= 0x0400u ? std::ldexp(1.0 + (em & 0x3FFu) / 1024.0, static_cast<int>(em >> 10) - 15)
+                                             : std::ldexp(static_cast<double>(em), -24)) * ((h[i] & 0x8000u) ? -1 : 1);
+        exact &= static_cast<double>(got[i]) == want && std::signbit(got[i]) == bool(h[i] & 0x8000u);
+    }
+    CHECK(same);
+    CHECK(exact);
+}
+
+TEST_CASE("bf16 -> f32 is the top half of the float")
+{
+    const auto h = all_halves();
+    std::vector<float> got(h.size()), port(h.size());
+    simdtl::convert_bf16_to_f32(h.data(), h.size(), got.data());
+    simdtl::detail::bf16_to_f32_portable(h.data(), h.size(), port.data());
+    bool ok = true;
+    for (std::size_t i = 0; i < h.size(); ++i)
+        ok &= std::bit_cast<std::uint32_t>(got[i]) == std::uint32_t{h[i]} << 16 &&
+              std::bit_cast<std::uint32_t>(port[i]) == std::uint32_t{h[i]} << 16;
+    CHECK(ok);
+}
+
+TEST_CASE("f32 -> f16 rounds half-even, overflows to inf, quiets NaN")
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = edge_floats(n + 3, 390u + static_cast<unsigned>(n));
+        std::vector<std::uint16_t> got(n + 3, 0xABCDu), port(n + 3);
+        simdtl::convert_f32_to_f16(v.data(), n, got.data());
+        simdtl::detail::f32_to_f16_portable(v.data(), n, port.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ok &= got[i] == port[i];
+            const std::uint32_t x = std::bit_cast<std::uint32_t>(v[i]);
+            if (is_nan32(x)) { ok &= (port[i] & 0x7E00u) == 0x7E00u && (port[i] >> 15) == (x >> 31); continue; }
+#ifdef __FLT16_MAX__
+            ok &= port[i] == std::bit_cast<std::uint16_t>(static_cast<_Float16>(v[i]));
+#endif
+            // Round trip is the identity on every value that is already a half.
+            const float back = simdtl::detail::f16_to_f32_one(port[i]);
+            if (simdtl::detail::f32_to_f16_one(back) != port[i]) ok = false;
+        }
+        CHECK(ok);
+        CHECK(got[n] == 0xABCDu);   // nothing written past n
+    }
+
+    const std::vector<float> f{65504.0f, 65519.0f, 65520.0f, -1e9f, 0x1p-24f, 0x1p-25f, 0x1.8p-25f, 1.0f + 0x1p-11f};
+    std::vector<std::uint16_t> h(f.size());
+    simdtl::convert_f32_to_f16(f.data(), f.size(), h.data());
+    CHECK(h == std::vector<std::uint16_t>{0x7BFFu, 0x7BFFu, 0x7C00u, 0xFC00u, 0x0001u, 0x0000u, 0x0001u, 0x3C00u});
+}
+
+TEST_CASE("f32 -> bf16 rounds half-even, keeps subnormals, quiets NaN")
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = edge_floats(n + 3, 420u + static_cast<unsigned>(n));
+        std::vector<std::uint16_t> got(n + 3, 0xABCDu), port(n + 3);
+        simdtl::convert_f32_to_bf16(v.data(), n, got.data());
+        simdtl::detail::f32_to_bf16_portable(v.data(), n, port.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ok &= got[i] == port[i];
+            const std::uint32_t x = std::bit_cast<std::uint32_t>(v[i]);
+            if (is_nan32(x)) ok &= port[i] == static_cast<std::uint16_t>((x >> 16) | 0x40u);
+            else ok &= port[i] == bf16_ref(v[i]);
+        }
+        CHECK(ok);
+        CHECK(got[n] == 0xABCDu);
+    }
+
+    const std::vector<float> f{1.0f, std::bit_cast<float>(0x3F808000u), std::bit_cast<float>(0x3F818000u),
+                               std::bit_cast<float>(0x00018000u), std::bit_cast<float>(0x7F7FFFFFu)};
+    std::vector<std::uint16_t> h(f.size());
+    simdtl::convert_f32_to_bf16(f.data(), f.size(), h.data());
+    CHECK(h == std::vector<std::uint16_t>{0x3F80u, 0x3F80u, 0x3F82u, 0x0002u, 0x7F80u});
+}
+
+TEST_CASE("half-precision kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(bf16_to_f32_lvl() == want);
+        CHECK(f32_to_bf16_lvl() == want);
+        if (detect_cpu_features().f16c || want == isa_level::avx512)
+        {
+            CHECK(f16_to_f32_lvl() == want);
+            CHECK(f32_to_f16_lvl() == want);
+        }
+    }
+#else
+    CHECK(f16_to_f32_slot() == nullptr);
+    CHECK(f32_to_bf16_slot() == nullptr);
+#endif
+}
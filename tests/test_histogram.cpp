@@ -0,0 +1,93 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+template <class T>
+static std::vector<std::uint32_t> naive_histogram(const std::vector<T>& v, std::size_t bins)
+{
+    std::vector<std::uint32_t> h(bins);
+    for (T x : v) ++h[x];
+    return h;
+}
+
+TEST_CASE("histogram_u8 matches a naive count (uniform, narrow, constant)")
+{
+    std::vector<std::uint32_t> got(256, 0xDEADBEEFu);   // overwritten, not accumulated
+    for (std::size_t n : kEdgeSizes)
+    {
+        for (long long hi : {255LL, 3LL, 0LL})
+        {
+            const auto data = make_values<std::uint8_t>(n, 0, hi, 310u + (unsigned)n);
+            simdtl::histogram_u8(data.data(), n, got.data());
+            CHECK(got == naive_histogram(data, 256));
+        }
+    }
+}
+
+TEST_CASE("histogram_u16 matches a naive count (dispatched + portable, both sides of the split)")
+{
+    std::vector<std::uint32_t> got(65536, 0xDEADBEEFu);
+    std::vector<std::size_t> sizes(kEdgeSizes.begin(), kEdgeSizes.end());
+    sizes.push_back(simdtl::detail::histogram_u16_split + 3);
+    for (std::size_t n : sizes)
+    {
+        for (long long hi : {65535LL, 15LL, 0LL})
+        {
+            const auto data = make_values<std::uint16_t>(n, 0, hi, 320u + (unsigned)n);
+            const auto want = naive_histogram(data, 65536);
+            simdtl::histogram_u16(data.data(), n, got.data());
+            CHECK(got == want);
+            simdtl::detail::histogram_u16_portable(data.data(), n, got.data());
+            CHECK(got == want);
+        }
+    }
+}
+
+template <class T>
+static void check_small_domain()
+{
+    const T domain[6] = {T(0), T(1), T(2), T(7), T(2), T(100)};   // duplicate and absent values
+    std::vector<std::size_t> sizes(kEdgeSizes.begin(), kEdgeSizes.end());
+    sizes.push_back(3 * 16384 + 5);   // several L1 blocks
+    for (std::size_t n : sizes)
+    {
+        const auto data = make_values<T>(n, 0, 8, 330u + (unsigned)n);
+        std::size_t got[6];
+        simdtl::count_values_in_small_domain(data.data(), n, domain, 6, got);
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            std::size_t want = 0;
+            for (T x : data) want += x == domain[j] ? 1u : 0u;
+            CHECK(got[j] == want);
+        }
+    }
+}
+
+TEST_CASE("count_values_in_small_domain matches per-value counts")
+{
+    check_small_domain<std::int8_t>();    // dispatched count kernels
+    check_small_domain<std::int16_t>();
+    check_small_domain<std::int32_t>();
+    check_small_domain<std::uint8_t>();   // portable count
+}
+
+TEST_CASE("conflict-detection histogram_u16 kernel installed at avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx512) CHECK(histogram_u16_lvl() == isa_level::avx512);
+    else                                 CHECK(histogram_u16_slot() == nullptr);
+#else
+    CHECK(histogram_u16_slot() == nullptr);
+#endif
+}
@@ -0,0 +1,157 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// Two-pass reference in long double: mean, then the central sums.
+struct reference
+{
+    long double mean = 0, m2 = 0, m3 = 0, m4 = 0;
+};
+
+template <class T>
+static reference two_pass(const T* p, std::size_t n)
+{
+    reference r;
+    if (n == 0) return r;
+    for (std::size_t i = 0; i < n; ++i) r.mean += p[i];
+    r.mean /= static_cast<long double>(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const long double d = p[i] - r.mean, d2 = d * d;
+        r.m2 += d2;
+        r.m3 += d2 * d;
+        r.m4 += d2 * d2;
+    }
+    return r;
+}
+
+// Relative to the scale of the quantity (M3 can cancel to ~0, so it is
+// compared against M2^1.5 instead of itself).
+static void check_close(double got, long double want, long double scale, double tol)
+{
+    CHECK(std::fabs(got - static_cast<double>(want)) <= tol * static_cast<double>(scale) + 1e-300);
+}
+
+template <int Order, class T>
+static void check_moments(const std::vector<T>& v, double tol)
+{
+    const reference r = two_pass(v.data(), v.size());
+    const std::size_t n = v.size();
+    for (const auto& s : {simdtl::moments<Order>(v.data(), n), simdtl::detail::moments_portable<T, Order>(v.data(), n)})
+    {
+        REQUIRE(s.count == n);
+        const long double sd = std::sqrt(r.m2 / (n ? n : 1));
+        check_close(s.mean, r.mean, std::fabs(r.mean) + sd, tol);
+        check_close(s.m2, r.m2, r.m2, tol);
+        if constexpr (Order == 4)
+        {
+            check_close(s.m3, r.m3, r.m2 * sd, tol);
+            check_close(s.m4, r.m4, r.m4, tol);
+        }
+        else
+        {
+            CHECK(s.m3 == T(0));
+            CHECK(s.m4 == T(0));
+        }
+    }
+}
+
+TEST_CASE("moments match a two-pass reference (float / double, order 2 / 4)")
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto f = make_values<float>(n, -1000, 1000, 370u + (unsigned)n);
+        const auto d = make_values<double>(n, -1000, 1000, 371u + (unsigned)n);
+        check_moments<2>(f, 2e-5);
+        check_moments<4>(f, 2e-4);
+        check_moments<2>(d, 1e-12);
+        check_moments<4>(d, 1e-11);
+    }
+    const auto s = simdtl::moments(std::vector<double>{2, 4, 4, 4, 5, 5, 7, 9});
+    CHECK(s.mean == doctest::Approx(5.0));
+    CHECK(s.variance() == doctest::Approx(4.0));
+    CHECK(s.stddev() == doctest::Approx(2.0));
+    CHECK(s.sample_variance() == doctest::Approx(32.0 / 7.0));
+    CHECK(simdtl::moments(std::vector<float>{}).variance() == 0.0f);
+}
+
+TEST_CASE("moments stay accurate where sum / sum-of-squares cancels")
+{
+    // 1e4 + U(-1, 1) in float: the textbook E[x^2] - E[x]^2 loses every
+    // significant digit (x^2 ~ 1e8, ulp ~ 8); Welford keeps the variance (1/3).
+    std::mt19937 gen(37);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    std::vector<float> f(1 << 20);
+    for (auto& x : f) x = 10000.0f + u(gen);
+    const reference r = two_pass(f.data(), f.size());
+    const long double want = r.m2 / f.size();
+    for (const auto& s : {simdtl::moments<4>(f.data(), f.size()), simdtl::detail::moments_portable<float, 4>(f.data(), f.size())})
+    {
+        CHECK(s.variance() == doctest::Approx(double(want)).epsilon(1e-3));
+        CHECK(std::fabs(s.skewness()) < 0.02f);
+        CHECK(s.kurtosis() == doctest::Approx(-1.2).epsilon(0.02));   // uniform: -6/5
+    }
+    float sum = 0, sumsq = 0;
+    for (float x : f) { sum += x; sumsq += x * x; }
+    const float naive = sumsq / f.size() - (sum / f.size()) * (sum / f.size());
+    CHECK(std::fabs(naive - float(want)) > 0.1f);   // what the one-pass textbook formula gives
+}
+
+TEST_CASE("moment_state: push / append / merge agree with one batch")
+{
+    const auto v = make_values<double>(10007, -300, 500, 372u);
+    const auto whole = simdtl::moments<4>(v.data(), v.size());
+
+    simdtl::moment_state<double, 4> pushed, appended, merged;
+    for (double x : v) pushed.push(x);
+    for (std::size_t at = 0; at < v.size(); at += 999)
+    {
+        const std::size_t len = std::min<std::size_t>(999, v.size() - at);
+        appended.append(v.data() + at, len);
+        simdtl::moment_state<double, 4> part = simdtl::moments<4>(v.data() + at, len);
+        merged.merge(part);
+    }
+    merged.merge(simdtl::moment_state<double, 4>{});   // merging an empty state is a no-op
+    for (const auto* s : {&pushed, &appended, &merged})
+    {
+        CHECK(s->count == whole.count);
+        CHECK(s->mean == doctest::Approx(whole.mean).epsilon(1e-12));
+        CHECK(s->m2 == doctest::Approx(whole.m2).epsilon(1e-12));
+        CHECK(s->m3 == doctest::Approx(whole.m3).epsilon(1e-9));
+        CHECK(s->m4 == doctest::Approx(whole.m4).epsilon(1e-12));
+        CHECK(s->skewness() == doctest::Approx(whole.skewness()).epsilon(1e-9));
+        CHECK(s->kurtosis() == doctest::Approx(whole.kurtosis()).epsilon(1e-9));
+    }
+}
+
+TEST_CASE("moments kernels installed at avx2 (+FMA) / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx512)
+    {
+        CHECK(moments_f32_lvl() == isa_level::avx512);
+        CHECK(moments_f64_lvl() == isa_level::avx512);
+    }
+    else if (best_isa() >= isa_level::avx2 && detect_cpu_features().fma)
+    {
+        CHECK(moments_f32_lvl() == isa_level::avx2);
+        CHECK(moments_f64_lvl() == isa_level::avx2);
+    }
+#else
+    CHECK(moments_f32_slot() == nullptr);
+    CHECK(moments_f64_slot() == nullptr);
+#endif
+}
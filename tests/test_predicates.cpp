@@ -0,0 +1,219 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+
+// Values around the constants below plus each type's extremes (the sign-bit
+// flip of the unsigned compares), NaN / -0 / inf for floats.
+template <class T>
+static std::vector<T> column(std::size_t n, unsigned seed)
+{
+    using L = std::numeric_limits<T>;
+    std::vector<T> pool{T(0), T(1), T(2), T(3), T(5), T(6), T(7), T(9), T(100), L::max(), L::lowest(),
+                        static_cast<T>(L::max() - T(1))};
+    if constexpr (std::is_signed_v<T>) pool.push_back(T(-3));
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        pool.push_back(L::quiet_NaN());
+        pool.push_back(T(-0.0));
+        pool.push_back(L::infinity());
+        pool.push_back(T(2.5));
+    }
+    std::mt19937 gen(seed);
+    std::vector<T> v(n);
+    for (auto& x : v) x = pool[gen() % pool.size()];
+    return v;
+}
+
+// ref(x) is the expected truth; by default the predicate itself on scalars.
+template <class T, class Pred, class Ref>
+static void check_pred(const std::vector<T>& v, Pred pred, Ref ref, const char* what)
+{
+    const std::size_t n = v.size();
+    std::vector<T> want;
+    std::copy_if(v.begin(), v.end(), std::back_inserter(want), [&](T x) { return static_cast<bool>(ref(x)); });
+
+    CHECK_MESSAGE(simdtl::count_if(v.data(), n, pred) == want.size(), what << " n=" << n);
+
+    // Exactly count + 1 slots: the kernels must not write past the kept prefix.
+    std::vector<T> out(want.size() + 1, T(42));
+    const std::size_t k = simdtl::copy_if(v.data(), n, out.data(), pred);
+    bool ok = k == want.size() && out[k] == T(42);
+    for (std::size_t j = 0; ok && j < k; ++j) ok &= std::memcmp(&out[j], &want[j], sizeof(T)) == 0;
+    CHECK_MESSAGE(ok, what << " copy_if n=" << n);
+
+    std::vector<T> rest;
+    std::copy_if(v.begin(), v.end(), std::back_inserter(rest), [&](T x) { return !ref(x); });
+    auto w = v;
+    const std::size_t r = simdtl::remove_if(w.data(), n, pred);
+    ok = r == rest.size();
+    for (std::size_t j = 0; ok && j < r; ++j) ok &= std::memcmp(&w[j], &rest[j], sizeof(T)) == 0;
+    CHECK_MESSAGE(ok, what << " remove_if n=" << n);
+}
+
+template <class T, class Pred>
+static void check_pred(const std::vector<T>& v, Pred pred, const char* what)
+{
+    check_pred(v, pred, pred, what);
+}
+
+template <class T>
+static void check_type(unsigned seed)
+{
+    std::vector<std::size_t> sizes(kEdgeSizes.begin(), kEdgeSizes.end());
+    sizes.push_back(3000);
+    sizes.push_back(5000);
+    for (std::size_t n : sizes)
+    {
+        const auto v = column<T>(n, seed + static_cast<unsigned>(n));
+        check_pred(v, simdtl::eq(5), "eq");
+        check_pred(v, simdtl::ne(5), "ne");
+        check_pred(v, simdtl::lt(5), "lt");
+        check_pred(v, simdtl::le(5), "le");
+        check_pred(v, simdtl::gt(5), "gt");
+        check_pred(v, simdtl::ge(5), "ge");
+        check_pred(v, simdtl::between(2, 7), "between");
+        check_pred(v, simdtl::in_set(1, 3, 7, 100), "in_set");
+        check_pred(v, simdtl::gt(std::numeric_limits<T>::max() - T(1)), "gt max-1");
+        check_pred(v, simdtl::lt(std::numeric_limits<T>::lowest()), "lt lowest");
+        check_pred(v, simdtl::ge(T(0)), "ge 0");
+    }
+}
+
+TEST_CASE("eq / ne / lt / le / gt / ge / between / in_set through copy_if, remove_if, count_if")
+{
+    check_type<std::int8_t>(460u);
+    check_type<std::uint8_t>(461u);
+    check_type<std::int16_t>(462u);
+    check_type<std::uint16_t>(463u);
+    check_type<std::int32_t>(464u);
+    check_type<std::uint32_t>(465u);
+    check_type<std::int64_t>(466u);
+    check_type<std::uint64_t>(467u);
+    check_type<float>(468u);
+    check_type<double>(469u);
+    check_type<char>(470u);
+}
+
+// Constants outside the column's range, or with a fraction, against the exact
+// (long double) comparison: no wrap-around through the cast.
+template <class T>
+static void check_out_of_range(unsigned seed)
+{
+    using L = std::numeric_limits<T>;
+    const long double lo = static_cast<long double>(L::min()), hi = static_cast<long double>(L::max());
+    const long double nan = std::numeric_limits<long double>::quiet_NaN();
+    for (std::size_t n : {std::size_t{7}, std::size_t{64}, std::size_t{300}, std::size_t{3000}})
+    {
+        const auto v = column<T>(n, seed + static_cast<unsigned>(n));
+        auto x_ = [](T x) { return static_cast<long double>(x); };
+        for (long double c : {lo - 1, hi + 1, lo - 1e20L, hi * 4 + 5, 2.5L, -2.5L, hi - 0.5L, lo + 0.5L})
+        {
+            // Integer constants where c is whole (and fits a long long / unsigned long long), double otherwise.
+            const double d = static_cast<double>(c);
+            check_pred(v, simdtl::gt(d), [&](T x) { return x_(x) > (long double)d; }, "gt double");
+            check_pred(v, simdtl::ge(d), [&](T x) { return x_(x) >= (long double)d; }, "ge double");
+            check_pred(v, simdtl::lt(d), [&](T x) { return x_(x) < (long double)d; }, "lt double");
+            check_pred(v, simdtl::le(d), [&](T x) { return x_(x) <= (long double)d; }, "le double");
+            check_pred(v, simdtl::eq(d), [&](T x) { return x_(x) == (long double)d; }, "eq double");
+            check_pred(v, simdtl::ne(d), [&](T x) { return x_(x) != (long double)d; }, "ne double");
+        }
+        check_pred(v, simdtl::gt(nan), [](T) { return false; }, "gt NaN");
+        check_pred(v, simdtl::ne(nan), [](T) { return true; }, "ne NaN");
+
+        // Integer constants one past each end.
+        if constexpr (sizeof(T) < 8)
+        {
+            const long long below = static_cast<long long>(L::min()) - 1, above = static_cast<long long>(L::max()) + 1;
+            for (long long c : {below, above, below - 1000, above + 1000})
+            {
+                check_pred(v, simdtl::gt(c), [&](T x) { return x_(x) > c; }, "gt int");
+                check_pred(v, simdtl::le(c), [&](T x) { return x_(x) <= c; }, "le int");
+                check_pred(v, simdtl::lt(c), [&](T x) { return x_(x) < c; }, "lt int");
+                check_pred(v, simdtl::ge(c), [&](T x) { return x_(x) >= c; }, "ge int");
+                check_pred(v, simdtl::eq(c), [&](T x) { return x_(x) == c; }, "eq int");
+                check_pred(v, simdtl::ne(c), [&](T x) { return x_(x) != c; }, "ne int");
+            }
+            check_pred(v, simdtl::between(below, above), [](T) { return true; }, "between all");
+            check_pred(v, simdtl::between(below - 5, below), [](T) { return false; }, "between none below");
+            check_pred(v, simdtl::between(above, above + 5), [](T) { return false; }, "between none above");
+            check_pred(v, simdtl::between(below, 5LL), [&](T x) { return x_(x) <= 5; }, "between low open");
+            check_pred(v, simdtl::in_set(above, 7LL, below), [&](T x) { return x == T(7); }, "in_set partly out");
+            check_pred(v, simdtl::in_set(above, below), [](T) { return false; }, "in_set all out");
+        }
+        else if constexpr (std::is_unsigned_v<T>)
+        {
+            check_pred(v, simdtl::lt(-1LL), [](T) { return false; }, "lt -1");
+            check_pred(v, simdtl::ge(-1LL), [](T) { return true; }, "ge -1");
+            check_pred(v, simdtl::between(-5LL, 6LL), [&](T x) { return x <= 6; }, "between -5 6");
+        }
+        check_pred(v, simdtl::between(2.5, 6.5), [&](T x) { return x_(x) >= 2.5L && x_(x) <= 6.5L; }, "between frac");
+        check_pred(v, simdtl::in_set(2.5, 3.0, hi * 4.0), [&](T x) { return x == T(3); }, "in_set frac");
+    }
+}
+
+TEST_CASE("out-of-range and fractional constants resolve exactly on integer columns")
+{
+    check_out_of_range<std::int8_t>(480u);
+    check_out_of_range<std::uint8_t>(481u);
+    check_out_of_range<std::int16_t>(482u);
+    check_out_of_range<std::uint16_t>(483u);
+    check_out_of_range<std::int32_t>(484u);
+    check_out_of_range<std::uint32_t>(485u);
+    check_out_of_range<std::int64_t>(486u);
+    check_out_of_range<std::uint64_t>(487u);
+    check_out_of_range<char>(488u);
+
+    // The cases from the report: gt(300) on uint8 is not x > 44, lt(-1) on
+    // uint32 is not x < 4294967295.
+    const std::vector<std::uint8_t> b{0, 44, 45, 200, 255};
+    CHECK(simdtl::count_if(b.data(), b.size(), simdtl::gt(300)) == 0);
+    CHECK(simdtl::count_if(b.data(), b.size(), simdtl::le(300)) == 5);
+    const std::vector<std::uint32_t> u{0, 1, 4294967295u};
+    CHECK(simdtl::count_if(u.data(), u.size(), simdtl::lt(-1)) == 0);
+    CHECK(simdtl::count_if(u.data(), u.size(), simdtl::gt(-1)) == 3);
+    CHECK_FALSE(simdtl::gt(300)(std::uint8_t{45}));
+    CHECK(simdtl::lt(2.5)(2));
+}
+
+TEST_CASE("vocabulary predicates are ordinary elemental predicates")
+{
+    const std::vector<int> v{1, 5, 9, 5, 2};
+    CHECK(simdtl::find_if(v.data(), v.size(), simdtl::gt(4)) == v.data() + 1);
+    CHECK(simdtl::count_if(v, simdtl::between(2, 5)) == 3);
+    CHECK(simdtl::count_if(v, simdtl::in_set(9, 1)) == 2);
+    CHECK(simdtl::eq(5)(5));
+    CHECK_FALSE(simdtl::lt(2.5)(3.0));
+}
+
+TEST_CASE("filter kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(filter_i32_lvl() == want);
+        CHECK(filter_u64_lvl() == want);
+        CHECK(filter_f32_lvl() == want);
+        CHECK(filter_f64_lvl() == want);
+        const bool vbmi2 = want == isa_level::avx512 && detect_cpu_features().avx512vbmi2;
+        CHECK(filter_i8_lvl() == (vbmi2 ? isa_level::avx512 : isa_level::avx2));
+        CHECK(filter_u16_lvl() == (vbmi2 ? isa_level::avx512 : isa_level::avx2));
+    }
+#else
+    CHECK(filter_i32_slot() == nullptr);
+#endif
+}
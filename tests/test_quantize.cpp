@@ -0,0 +1,178 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+
+template <class Out>
+static Out quantize_ref(float x, float scale, std::int32_t zp)
+{
+    const float t = x * (1.0f / scale);
+    if (std::isnan(t)) return static_cast<Out>(zp);
+    const double r = std::nearbyint(static_cast<double>(t)) + zp;
+    if (r < std::numeric_limits<Out>::min()) return std::numeric_limits<Out>::min();
+    if (r > std::numeric_limits<Out>::max()) return std::numeric_limits<Out>::max();
+    return static_cast<Out>(r);
+}
+
+// Values spread over about +-2x the quantized range, salted with ties
+// (k + 0.5 steps), NaN, +-inf and huge magnitudes.
+static std::vector<float> mixed(std::size_t n, float scale, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> d(-600.0f * scale, 600.0f * scale);
+    const float specials[] = {0.0f, -0.0f, 0.5f * scale, 1.5f * scale, -2.5f * scale, 127.5f * scale, -128.5f * scale,
+                              std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+                              -std::numeric_limits<float>::infinity(), 3e38f, -3e38f};
+    std::vector<float> v(n);
+    for (auto& x : v) x = gen() % 5 == 0 ? specials[gen() % std::size(specials)] : d(gen);
+    return v;
+}
+
+template <class Out>
+static void check_quantize(float scale, std::int32_t zp)
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = mixed(n + 3, scale, 400u + static_cast<unsigned>(n));
+        std::vector<Out> got(n + 3, Out(7)), port(n + 3, Out(7));
+        simdtl::quantize(v.data(), n, scale, zp, got.data());
+        simdtl::detail::quantize_portable(v.data(), n, 1.0f / scale, zp, port.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const Out want = quantize_ref<Out>(v[i], scale, zp);
+            ok &= got[i] == want && port[i] == want;
+        }
+        CHECK(ok);
+        CHECK(got[n] == Out(7));   // nothing written past n
+    }
+}
+
+template <class In>
+static void check_dequantize(float scale, std::int32_t zp)
+{
+    std::mt19937 gen(410);
+    for (std::size_t n : kEdgeSizes)
+    {
+        std::vector<In> q(n);
+        for (auto& x : q) x = static_cast<In>(gen());
+        std::vector<float> got(n + 3, 7.0f), port(n + 3, 7.0f);
+        simdtl::dequantize(q.data(), n, scale, zp, got.data());
+        simdtl::detail::dequantize_portable(q.data(), n, scale, zp, port.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const float want = static_cast<float>(static_cast<std::int32_t>(q[i]) - zp) * scale;
+            ok &= got[i] == want && port[i] == want;
+        }
+        CHECK(ok);
+        CHECK(got[n] == 7.0f);
+    }
+}
+
+TEST_CASE("quantize rounds half-even, saturates, maps NaN to zero_point")
+{
+    check_quantize<std::int8_t>(0.05f, 0);        // dispatched
+    check_quantize<std::int8_t>(0.013f, -20);
+    check_quantize<std::uint8_t>(0.1f, 128);
+    check_quantize<std::uint8_t>(1.0f / 255, 0);
+    check_quantize<std::int16_t>(0.001f, 100);    // portable only
+    check_quantize<std::uint16_t>(0.25f, 30000);
+
+    const std::vector<float> f{0.5f, 1.5f, 2.5f, -0.5f, -1.5f, 1000.0f, -1000.0f, std::nanf("")};
+    std::vector<std::int8_t> q(f.size());
+    simdtl::quantize(f.data(), f.size(), 1.0f, 3, q.data());
+    CHECK(q == std::vector<std::int8_t>{3, 5, 5, 3, 1, 127, -128, 3});
+}
+
+TEST_CASE("quantize saturates 32- and 64-bit Outs, whose bounds are not floats")
+{
+    check_quantize<std::int32_t>(0.05f, 7);
+    check_quantize<std::uint32_t>(0.1f, 128);
+    check_quantize<std::int64_t>(0.05f, -3);
+
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    const std::vector<float> f{1e10f, -1e10f, inf, -inf, std::nanf(""), 3e38f, 2147483520.0f, 1.5f, -2.5f};
+    std::vector<std::int32_t> i32(f.size());
+    simdtl::quantize(f.data(), f.size(), 1.0f, 0, i32.data());
+    CHECK(i32 == std::vector<std::int32_t>{INT32_MAX, INT32_MIN, INT32_MAX, INT32_MIN, 0, INT32_MAX, 2147483520, 2, -2});
+
+    const std::vector<float> g{1e10f, -5.0f, 4294967040.0f, std::nanf("")};
+    std::vector<std::uint32_t> u32(g.size());
+    simdtl::quantize(g.data(), g.size(), 1.0f, 0, u32.data());
+    CHECK(u32 == std::vector<std::uint32_t>{UINT32_MAX, 0, 4294967040u, 0});
+
+    const std::vector<float> h{1e30f, -1e30f, 2.5f};
+    std::vector<std::int64_t> i64(h.size());
+    simdtl::quantize(h.data(), h.size(), 1.0f, 0, i64.data());
+    CHECK(i64 == std::vector<std::int64_t>{INT64_MAX, INT64_MIN, 2});
+}
+
+TEST_CASE("dequantize is (q - zero_point) * scale, one rounding")
+{
+    check_dequantize<std::int8_t>(0.05f, 0);      // dispatched
+    check_dequantize<std::int8_t>(0.013f, -20);
+    check_dequantize<std::uint8_t>(0.1f, 128);
+    check_dequantize<std::int16_t>(0.001f, 100);  // portable only
+}
+
+TEST_CASE("calibrate maps the data range onto the type, 0 exactly")
+{
+    std::mt19937 gen(420);
+    std::uniform_real_distribution<float> d(-3.0f, 7.0f);
+    std::vector<float> v(1000);
+    for (auto& x : v) x = d(gen);
+
+    const auto p = simdtl::calibrate<std::uint8_t>(v);
+    const auto [lo, hi] = simdtl::minmax_value(v);
+    CHECK(p.scale == doctest::Approx((hi - lo) / 255.0f));
+    std::vector<std::uint8_t> q(v.size());
+    std::vector<float> back(v.size());
+    simdtl::quantize(v, p, q.data());
+    simdtl::dequantize(q.data(), q.size(), p, back.data());
+    bool ok = true;
+    for (std::size_t i = 0; i < v.size(); ++i) ok &= std::abs(back[i] - v[i]) <= p.scale * 0.5f + 1e-6f;
+    CHECK(ok);
+    const float zero = 0.0f;
+    std::uint8_t qz = 0;
+    simdtl::quantize(&zero, 1, p, &qz);
+    CHECK(qz == p.zero_point);
+
+    const auto s = simdtl::calibrate_symmetric(v);
+    CHECK(s.zero_point == 0);
+    CHECK(s.scale == doctest::Approx(std::max(-lo, hi) / 127.0f));
+
+    // All-positive data still includes 0; an all-zero range gets scale 1.
+    const auto pos = simdtl::choose_quant_params<std::int8_t>(2.0f, 4.0f);
+    CHECK(pos.zero_point == -128);
+    CHECK(pos.scale == doctest::Approx(4.0f / 255.0f));
+    const auto flat = simdtl::choose_quant_params<std::int8_t>(0.0f, 0.0f);
+    CHECK(flat.scale == 1.0f);
+}
+
+TEST_CASE("quantize kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(quantize_i8_lvl() == want);
+        CHECK(quantize_u8_lvl() == want);
+        CHECK(dequantize_i8_lvl() == want);
+        CHECK(dequantize_u8_lvl() == want);
+    }
+#else
+    CHECK(quantize_i8_slot() == nullptr);
+#endif
+}
@@ -0,0 +1,227 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// Sizes up to past one int32 flush of the 16-bit kernels (2^14 steps x 32 lanes).
+static std::vector<std::size_t> wide_sizes()
+{
+    std::vector<std::size_t> s(kEdgeSizes.begin(), kEdgeSizes.end());
+    s.push_back((std::size_t{1} << 19) + 1234);
+    return s;
+}
+
+template <class Acc, class T>
+static void check_reduce_wide()
+{
+    constexpr long long lo = static_cast<long long>(std::numeric_limits<T>::lowest());
+    constexpr long long hi = static_cast<long long>(std::numeric_limits<T>::max());
+    for (std::size_t n : wide_sizes())
+    {
+        for (int mode = 0; mode < 3; ++mode)   // full range, all max, all lowest
+        {
+            auto data = make_values<T>(n, lo, hi, 320u + (unsigned)n);
+            if (mode == 1) data.assign(n, static_cast<T>(hi));
+            if (mode == 2) data.assign(n, static_cast<T>(lo));
+            Acc want = Acc(7);
+            for (T x : data) want += static_cast<Acc>(x);
+            CHECK(simdtl::reduce_wide<Acc>(data.data(), n, Acc(7)) == want);
+            CHECK(Acc(7) + simdtl::detail::reduce_wide_portable<Acc>(data.data(), n) == want);
+        }
+    }
+}
+
+TEST_CASE("reduce_wide sums narrow integers without overflow (dispatched + portable)")
+{
+    check_reduce_wide<std::int64_t, std::int8_t>();
+    check_reduce_wide<std::uint64_t, std::uint8_t>();
+    check_reduce_wide<std::int64_t, std::int16_t>();
+    check_reduce_wide<std::uint64_t, std::uint16_t>();
+    check_reduce_wide<std::int64_t, std::int32_t>();   // portable pair
+}
+
+TEST_CASE("reduce_wide<double> over float is exact for whole numbers")
+{
+    for (std::size_t n : wide_sizes())
+    {
+        const auto data = make_values<float>(n, -1000000, 1000000, 330u + (unsigned)n);
+        double want = 0.5;
+        for (float x : data) want += static_cast<double>(x);
+        CHECK(simdtl::reduce_wide<double>(data.data(), n, 0.5) == want);
+    }
+    // A float accumulator stalls at 2^24; the double one does not.
+    const std::vector<float> ones(std::size_t{1} << 25, 1.0f);
+    CHECK(simdtl::reduce_wide<double>(ones.data(), ones.size()) == double(ones.size()));
+}
+
+TEST_CASE("reduce_wide kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(reduce_wide_i8_lvl() == want);
+        CHECK(reduce_wide_u8_lvl() == want);
+        CHECK(reduce_wide_i16_lvl() == want);
+        CHECK(reduce_wide_u16_lvl() == want);
+        CHECK(reduce_wide_f32_lvl() == want);
+    }
+#else
+    CHECK(reduce_wide_u8_slot() == nullptr);
+#endif
+}
+
+// The documented tree, spelled out in scalar code.
+template <class T>
+static T reference_deterministic(const std::vector<T>& v, T init)
+{
+    const std::size_t B = simdtl::detail::deterministic_block, L = simdtl::detail::deterministic_lanes;
+    T s = init;
+    for (std::size_t b = 0; b < v.size(); b += B)
+    {
+        std::vector<T> lane(L, T{0});
+        for (std::size_t i = b; i < v.size() && i < b + B; ++i) lane[(i - b) % L] += v[i];
+        for (std::size_t w = L / 2; w > 0; w /= 2)
+            for (std::size_t j = 0; j < w; ++j) lane[j] += lane[j + w];
+        s += lane[0];
+    }
+    return s;
+}
+
+template <class T>
+static void check_deterministic()
+{
+    std::vector<std::size_t> sizes(kEdgeSizes.begin(), kEdgeSizes.end());
+    sizes.push_back(300 * simdtl::detail::deterministic_block + 77);   // enough blocks to fork
+    for (std::size_t n : sizes)
+    {
+        std::vector<T> v(n);
+        for (std::size_t i = 0; i < n; ++i) v[i] = T(1) / T(1 + (i * 7919) % 1000) - T(0.3);   // inexact, mixed sign
+        const T want = reference_deterministic(v, T(0.25));
+        CHECK(simdtl::reduce_deterministic(v.data(), n, T(0.25)) == want);
+        for (unsigned threads : {1u, 2u, 3u, 4u})
+            CHECK(simdtl::parallel_reduce_deterministic(v.data(), n, T(0.25), threads) == want);
+    }
+}
+
+TEST_CASE("reduce_deterministic is the documented tree for every thread count")
+{
+    check_deterministic<float>();
+    check_deterministic<double>();
+}
+
+TEST_CASE("reduce_kahan stays within a couple of roundings of the exact sum")
+{
+    // 2^22 copies of 0.1f: a plain float sum drifts by ~1e-4 relative.
+    const std::vector<float> tenths(std::size_t{1} << 22, 0.1f);
+    const double exact = double(0.1f) * double(tenths.size());
+    const float k = simdtl::reduce_kahan(tenths.data(), tenths.size());
+    CHECK(std::abs(double(k) - exact) <= 2 * double(std::numeric_limits<float>::epsilon()) * exact);
+
+    // Neumaier (not plain Kahan) keeps the small terms around a huge cancellation.
+    for (std::size_t pad : {0u, 1u, 5u, 16u})
+    {
+        std::vector<double> v(pad, 0.0);
+        for (double x : {1.0, 1e100, 1.0, -1e100}) v.push_back(x);
+        CHECK(simdtl::reduce_kahan(v.data(), v.size()) == 2.0);
+    }
+
+    // Exact inputs: same answer as the plain sum.
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto d = make_values<double>(n, -1000, 1000, 340u + (unsigned)n);
+        double want = 3.0;
+        for (double x : d) want += x;
+        CHECK(simdtl::reduce_kahan(d.data(), n, 3.0) == want);
+    }
+}
+
+TEST_CASE("reduce with an elemental op: product, bitwise folds, min/max")
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto u = make_values<std::uint32_t>(n, 0, 0xFFFFFFFFLL, 350u + (unsigned)n);
+        std::uint32_t wand = 0xFFFFFFFFu, wor = 1u, wxor = 0x5Au;
+        for (std::uint32_t x : u) { wand &= x; wor |= x; wxor ^= x; }
+        CHECK(simdtl::reduce(u.data(), n, 0xFFFFFFFFu, [](auto a, auto b) { return a & b; }) == wand);
+        CHECK(simdtl::reduce(u.data(), n, 1u, [](auto a, auto b) { return a | b; }) == wor);
+        CHECK(simdtl::reduce(u.data(), n, 0x5Au, [](auto a, auto b) { return a ^ b; }) == wxor);
+
+        const auto d = make_values<double>(n, -3, 3, 360u + (unsigned)n);
+        double lo = 0.5, hi = 0.5;
+        for (double x : d) { lo = x < lo ? x : lo; hi = x > hi ? x : hi; }
+        CHECK(simdtl::reduce(d.data(), n, 0.5, [](auto a, auto b) { return simdtl::elem_min(a, b); }) == lo);
+        CHECK(simdtl::reduce(d.data(), n, 0.5, [](auto a, auto b) { return simdtl::elem_max(a, b); }) == hi);
+
+        // Products of +-1 and +-2 stay exact well past any test size's 2^k.
+        std::vector<double> p(n);
+        for (std::size_t i = 0; i < n; ++i) p[i] = (i % 37 == 0 ? 2.0 : 1.0) * (i % 3 == 0 ? -1.0 : 1.0);
+        double prod = 3.0;
+        for (double x : p) prod *= x;
+        CHECK(simdtl::reduce(p.data(), n, 3.0, [](auto a, auto b) { return a * b; }) == prod);
+    }
+}
+
+TEST_CASE("transform_reduce (one and two ranges) and dot")
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto a = make_values<std::int32_t>(n, -100, 100, 370u + (unsigned)n);
+        const auto b = make_values<std::int32_t>(n, -100, 100, 380u + (unsigned)n);
+        std::int32_t sq = 11, dist = 0, dot = 4;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            sq += a[i] * a[i];
+            dist = a[i] - b[i] > dist ? a[i] - b[i] : dist;
+            dot += a[i] * b[i];
+        }
+        auto plus = [](auto x, auto y) { return x + y; };
+        CHECK(simdtl::transform_reduce(a.data(), n, 11, plus, [](auto x) { return x * x; }) == sq);
+        CHECK(simdtl::transform_reduce(a.data(), n, b.data(), 0, [](auto x, auto y) { return simdtl::elem_max(x, y); },
+                                       [](auto x, auto y) { return x - y; }) == dist);
+        CHECK(simdtl::transform_reduce(a.data(), n, b.data(), 4) == dot);   // portable dot (int)
+
+        // Whole numbers: every partial sum is exact, so FMA kernels must match exactly.
+        const auto fa = make_values<float>(n, -30, 30, 390u + (unsigned)n);
+        const auto fb = make_values<float>(n, -30, 30, 391u + (unsigned)n);
+        const std::vector<double> da(fa.begin(), fa.end()), db(fb.begin(), fb.end());
+        double want = 0;
+        for (std::size_t i = 0; i < n; ++i) want += da[i] * db[i];
+        CHECK(double(simdtl::dot(fa.data(), fb.data(), n)) == want);
+        CHECK(simdtl::dot(da.data(), db.data(), n) == want);
+        CHECK(double(simdtl::detail::dot_portable(fa.data(), fb.data(), n)) == want);
+        CHECK(simdtl::transform_reduce(da.data(), n, db.data(), 0.5) == want + 0.5);
+        CHECK(simdtl::dot(da, db) == want);
+    }
+}
+
+TEST_CASE("dot kernels installed where FMA is available")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx512)
+    {
+        CHECK(dot_f32_lvl() == isa_level::avx512);
+        CHECK(dot_f64_lvl() == isa_level::avx512);
+    }
+    else if (best_isa() >= isa_level::avx2 && detect_cpu_features().fma)
+    {
+        CHECK(dot_f32_lvl() == isa_level::avx2);
+        CHECK(dot_f64_lvl() == isa_level::avx2);
+    }
+#else
+    CHECK(dot_f32_slot() == nullptr);
+#endif
+}
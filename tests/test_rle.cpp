@@ -0,0 +1,129 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+
+// Runs of length 1..max_run whose values step by 1..3 (so neighbouring runs
+// may differ in a single bit).
+template <class T>
+static std::vector<T> runs_of(std::size_t n, std::size_t max_run, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::vector<T> v;
+    v.reserve(n);
+    T x = T(0);
+    while (v.size() < n)
+    {
+        x = static_cast<T>(x + T(1 + gen() % 3));
+        const std::size_t len = 1 + gen() % max_run;
+        for (std::size_t j = 0; j < len && v.size() < n; ++j) v.push_back(x);
+    }
+    return v;
+}
+
+template <class T>
+static void check_rle(const std::vector<T>& v, const char* what)
+{
+    const std::size_t n = v.size();
+    std::vector<T> want_values;
+    std::vector<std::uint32_t> want_lengths;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i == 0 || !(v[i] == v[i - 1])) { want_values.push_back(v[i]); want_lengths.push_back(0); }
+        ++want_lengths.back();
+    }
+    const std::size_t want_runs = want_values.size();
+
+    std::vector<T> values(n + 1, T(9));
+    std::vector<std::uint32_t> lengths(n + 1, 77u);
+    const std::size_t runs = simdtl::rle_encode(v.data(), n, values.data(), lengths.data());
+    CHECK_MESSAGE(runs == want_runs, what << " n=" << n);
+    CHECK(runs == simdtl::count_runs(v.data(), n));
+    bool ok = runs == want_runs && values[n] == T(9) && lengths[n] == 77u;
+    for (std::size_t r = 0; ok && r < runs; ++r) ok &= values[r] == want_values[r] && lengths[r] == want_lengths[r];
+
+    std::vector<T> pvalues(n + 1);
+    std::vector<std::uint32_t> ends(n + 1);
+    ok &= simdtl::detail::rle_ends_portable(v.data(), n, pvalues.data(), ends.data()) == want_runs;
+    for (std::size_t r = 0, e = 0; ok && r < want_runs; ++r)
+        ok &= pvalues[r] == want_values[r] && ends[r] == (e += want_lengths[r]);
+    CHECK_MESSAGE(ok, what << " n=" << n);
+
+    CHECK(simdtl::rle_decoded_size(want_lengths.data(), want_runs) == n);
+    std::vector<T> back(n + 1, T(5)), pback(n, T(5));
+    CHECK(simdtl::rle_decode(want_values.data(), want_lengths.data(), want_runs, back.data()) == n);
+    simdtl::detail::rle_decode_portable(want_values.data(), want_lengths.data(), want_runs, n, pback.data());
+    bool same = back[n] == T(5);   // nothing written past the decoded size
+    for (std::size_t i = 0; i < n; ++i) same &= back[i] == v[i] && pback[i] == v[i];
+    CHECK_MESSAGE(same, what << " n=" << n);
+}
+
+template <class T>
+static void check_all()
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        check_rle(runs_of<T>(n, 1, 500u + static_cast<unsigned>(n)), "distinct");
+        check_rle(runs_of<T>(n, 3, 510u + static_cast<unsigned>(n)), "short runs");
+        check_rle(runs_of<T>(n, 40, 520u + static_cast<unsigned>(n)), "long runs");
+        check_rle(std::vector<T>(n, T(3)), "one run");
+    }
+    check_rle(runs_of<T>(5000, 200, 530u), "very long runs");
+    auto alt = runs_of<T>(3000, 1, 540u);
+    for (std::size_t i = 0; i < alt.size(); ++i) alt[i] = T(i % 2);   // boundary at every lane
+    check_rle(alt, "alternating");
+}
+
+TEST_CASE("rle_encode / rle_decode: int8 .. int64 against a scalar reference")
+{
+    check_all<std::int8_t>();
+    check_all<std::uint8_t>();
+    check_all<std::int16_t>();
+    check_all<std::int32_t>();
+    check_all<std::uint32_t>();
+    check_all<std::int64_t>();
+}
+
+TEST_CASE("rle on floats compares with ==")
+{
+    check_all<float>();
+    check_all<double>();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> v{0.0f, -0.0f, 0.0f, nan, nan, 1.0f, 1.0f};
+    std::vector<float> values(v.size());
+    std::vector<std::uint32_t> lengths(v.size());
+    REQUIRE(simdtl::rle_encode(v.data(), v.size(), values.data(), lengths.data()) == 4);
+    lengths.resize(4);
+    CHECK(lengths == std::vector<std::uint32_t>{3, 1, 1, 2});
+    CHECK(std::isnan(values[1]));
+    CHECK(values[3] == 1.0f);
+}
+
+TEST_CASE("rle kernels installed at avx2 / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(rle_encode_i32_lvl() == want);
+        CHECK(rle_encode_i64_lvl() == want);
+        CHECK(rle_decode_i8_lvl() == want);
+        CHECK(rle_decode_i64_lvl() == want);
+        const bool vbmi2 = want == isa_level::avx512 && detect_cpu_features().avx512vbmi2;
+        CHECK(rle_encode_i8_lvl() == (vbmi2 ? isa_level::avx512 : isa_level::avx2));
+    }
+#else
+    CHECK(rle_encode_i32_slot() == nullptr);
+#endif
+}
@@ -0,0 +1,116 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// Small whole numbers: every prefix is exactly representable even in float, so
+// the reassociating kernels must match std:: bit for bit.
+template <class T>
+static void check_scan()
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto data = make_values<T>(n, -9, 9, 901u + (unsigned)n);
+        const T init = T(5);
+
+        std::vector<T> ei(n), ee(n);
+        std::inclusive_scan(data.begin(), data.end(), ei.begin(), std::plus<>{}, init);
+        std::exclusive_scan(data.begin(), data.end(), ee.begin(), init);
+
+        std::vector<T> got(n);
+        simdtl::inclusive_scan(data.data(), n, got.data(), init);
+        CHECK(got == ei);
+        simdtl::exclusive_scan(data.data(), n, got.data(), init);
+        CHECK(got == ee);
+
+        auto a = data;   // in place
+        simdtl::inclusive_scan(a.data(), n, a.data(), init);
+        CHECK(a == ei);
+        a = data;
+        simdtl::exclusive_scan(a.data(), n, a.data(), init);
+        CHECK(a == ee);
+
+        simdtl::detail::scan_portable(data.data(), n, got.data(), init, false);
+        CHECK(got == ei);
+    }
+}
+
+TEST_CASE("inclusive_scan / exclusive_scan match std:: (dispatched i32/i64/f32/f64 + portable)")
+{
+    check_scan<std::int32_t>();
+    check_scan<std::int64_t>();
+    check_scan<float>();
+    check_scan<double>();
+    check_scan<std::uint32_t>();   // same-width routing through the int32 kernel
+    check_scan<std::int16_t>();    // portable
+}
+
+TEST_CASE("int32 scan wraps like the hardware add (no saturation)")
+{
+    std::vector<std::int32_t> v(37, INT32_MAX / 8);
+    std::vector<std::uint32_t> u(v.begin(), v.end());
+    std::vector<std::int32_t> got(v.size());
+    std::vector<std::uint32_t> e(u.size());
+    std::inclusive_scan(u.begin(), u.end(), e.begin());
+    simdtl::inclusive_scan(v.data(), v.size(), got.data());
+    for (std::size_t i = 0; i < v.size(); ++i) CHECK(static_cast<std::uint32_t>(got[i]) == e[i]);
+}
+
+template <class T>
+static void check_parallel_scan()
+{
+    // Three grains with 4 threads requested -> three parts, uneven last chunk.
+    const std::size_t n = 3 * simdtl::detail::parallel_scan_grain + 17;
+    const auto data = make_values<T>(n, 0, 3, 911u);
+    std::vector<T> ei(n), ee(n);
+    std::inclusive_scan(data.begin(), data.end(), ei.begin(), std::plus<>{}, T(1));
+    std::exclusive_scan(data.begin(), data.end(), ee.begin(), T(1));
+
+    std::vector<T> got(n);
+    simdtl::parallel_inclusive_scan(data.data(), n, got.data(), T(1), 4);
+    CHECK(got == ei);
+    simdtl::parallel_exclusive_scan(data.data(), n, got.data(), T(1), 4);
+    CHECK(got == ee);
+    auto a = data;
+    simdtl::parallel_inclusive_scan(a.data(), n, a.data(), T(1), 4);
+    CHECK(a == ei);
+    simdtl::parallel_inclusive_scan(data.data(), 1000, got.data(), T(1), 4);   // below the grain: serial
+    CHECK(std::equal(got.begin(), got.begin() + 1000, ei.begin()));
+}
+
+TEST_CASE("parallel scans match the serial result")
+{
+    check_parallel_scan<std::int32_t>();
+    check_parallel_scan<std::int64_t>();
+    check_parallel_scan<double>();   // whole numbers < 2^53: exact in any order
+}
+
+TEST_CASE("scan kernels installed at every x86 tier")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::sse2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512
+                             : best_isa() >= isa_level::avx2   ? isa_level::avx2
+                                                               : isa_level::sse2;
+        CHECK(scan_i32_lvl() == want);
+        CHECK(scan_i64_lvl() == want);
+        CHECK(scan_f32_lvl() == want);
+        CHECK(scan_f64_lvl() == want);
+    }
+#else
+    CHECK(scan_i32_slot() == nullptr);
+#endif
+}
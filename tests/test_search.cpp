@@ -0,0 +1,117 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// Sorted data with runs of duplicates; keys cover below-min, above-max, present
+// and absent values so every lower_bound outcome (0, n, inside a run) is hit.
+template <class T>
+static void check_lower_bound()
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        auto data = make_values<T>(n, -40, 40, 707u + (unsigned)n);
+        std::sort(data.begin(), data.end());
+        const auto keys = make_values<T>(n + 37, -45, 45, 708u + (unsigned)n);
+
+        std::vector<std::size_t> expect(keys.size());
+        for (std::size_t j = 0; j < keys.size(); ++j)
+            expect[j] = static_cast<std::size_t>(std::lower_bound(data.begin(), data.end(), keys[j]) - data.begin());
+
+        std::vector<std::size_t> got(keys.size());
+        for (std::size_t j = 0; j < keys.size(); ++j)
+        {
+            CHECK(simdtl::lower_bound_linear(data.data(), n, keys[j]) == expect[j]);
+            CHECK(simdtl::lower_bound(data.data(), n, keys[j]) == expect[j]);
+        }
+        simdtl::lower_bound_many(data.data(), n, keys.data(), keys.size(), got.data());
+        CHECK(got == expect);
+
+        std::fill(got.begin(), got.end(), std::size_t{0});
+        simdtl::detail::lower_bound_many_portable(data.data(), n, keys.data(), keys.size(), got.data());
+        CHECK(got == expect);
+
+        const simdtl::btree_index<T> index(data);
+        CHECK(index.size() == n);
+        std::fill(got.begin(), got.end(), std::size_t{0});
+        index.lower_bound_many(keys.data(), keys.size(), got.data());
+        CHECK(got == expect);
+    }
+}
+
+TEST_CASE("lower_bound / lower_bound_many / btree_index match std::lower_bound")
+{
+    check_lower_bound<std::int32_t>();   // dispatched AVX2 gather kernel (+ portable)
+    check_lower_bound<std::int8_t>();
+    check_lower_bound<std::int16_t>();
+    check_lower_bound<std::int64_t>();
+    check_lower_bound<float>();
+    check_lower_bound<double>();
+}
+
+TEST_CASE("btree_index spans several levels and keeps numeric_limits::max() keys distinct from padding")
+{
+    // 5000 int32 -> 313 nodes of 16 -> three levels, last node partially padded.
+    std::vector<std::int32_t> data(5000);
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<std::int32_t>(i * 3);
+    data.back() = std::numeric_limits<std::int32_t>::max();
+    const simdtl::btree_index<std::int32_t> index(data);
+    for (std::int32_t key : {-1, 0, 1, 2, 3, 7499, 7500, 14994, 14995, std::numeric_limits<std::int32_t>::max()})
+    {
+        const auto e = static_cast<std::size_t>(std::lower_bound(data.begin(), data.end(), key) - data.begin());
+        CHECK(index.lower_bound(key) == e);
+        CHECK(simdtl::lower_bound(data.data(), data.size(), key) == e);
+    }
+}
+
+// +inf keys must sort before the padding, which is +inf too but never below a key.
+template <class T>
+static void check_infinity()
+{
+    constexpr T inf = std::numeric_limits<T>::infinity();
+    for (std::size_t n : {std::size_t{1}, std::size_t{5}, std::size_t{17}, std::size_t{100}, std::size_t{5000}})
+    {
+        std::vector<T> data(n);
+        for (std::size_t i = 0; i < n; ++i) data[i] = static_cast<T>(i);
+        data.back() = inf;
+        if (n > 2) data[n - 2] = std::numeric_limits<T>::max();
+        const simdtl::btree_index<T> index(data);
+        const std::vector<T> keys{-inf, T(0), T(1), T(n / 2), std::numeric_limits<T>::max(), inf};
+        std::vector<std::size_t> got(keys.size());
+        index.lower_bound_many(keys.data(), keys.size(), got.data());
+        for (std::size_t j = 0; j < keys.size(); ++j)
+        {
+            const auto e = static_cast<std::size_t>(std::lower_bound(data.begin(), data.end(), keys[j]) - data.begin());
+            CHECK(index.lower_bound(keys[j]) == e);
+            CHECK(got[j] == e);
+        }
+    }
+}
+
+TEST_CASE("btree_index keeps +inf keys distinct from padding")
+{
+    check_infinity<float>();
+    check_infinity<double>();
+}
+
+TEST_CASE("search kernels installed when the CPU supports AVX2")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+        CHECK(lower_bound_many_i32_slot() != nullptr);
+#else
+    CHECK(lower_bound_many_i32_slot() == nullptr);
+#endif
+}
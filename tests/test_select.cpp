@@ -0,0 +1,140 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+#include "support/differential.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+using simdtl_test::make_values;
+
+// The k best by (value, then lower position), via a full stable sort; NaNs dropped.
+template <bool Largest, class T>
+static void check_select(const std::vector<T>& v, std::size_t k)
+{
+    std::vector<std::size_t> order;
+    for (std::size_t i = 0; i < v.size(); ++i)
+        if (v[i] == v[i]) order.push_back(i);
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return Largest ? v[b] < v[a] : v[a] < v[b];
+    });
+    const std::size_t want = std::min(k, order.size());
+
+    std::vector<T> out(k + 1, T(-7)), out2(k + 1, T(-7));
+    std::vector<std::size_t> idx(k + 1, 12345);
+    const std::size_t got = Largest ? simdtl::top_k(v.data(), v.size(), k, out.data(), idx.data())
+                                    : simdtl::bottom_k(v.data(), v.size(), k, out.data(), idx.data());
+    const std::size_t got2 = Largest ? simdtl::top_k(v.data(), v.size(), k, out2.data())
+                                     : simdtl::bottom_k(v.data(), v.size(), k, out2.data());
+    REQUIRE(got == want);
+    REQUIRE(got2 == want);
+    for (std::size_t j = 0; j < want; ++j)
+    {
+        CHECK(out[j] == v[order[j]]);
+        CHECK(idx[j] == order[j]);
+        CHECK(out2[j] == v[order[j]]);
+    }
+    CHECK(idx[want] == 12345u);   // nothing written past the count
+}
+
+template <class T>
+static void check_select_sizes(long long lo, long long hi)
+{
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = make_values<T>(n, lo, hi, 360u + (unsigned)n);
+        for (std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{17}, n / 2, n, n + 5})
+        {
+            check_select<true>(v, k);
+            check_select<false>(v, k);
+        }
+    }
+}
+
+TEST_CASE("top_k / bottom_k match a stable sort (values, positions, ties)")
+{
+    check_select_sizes<std::int32_t>(-1000000, 1000000);
+    check_select_sizes<std::int32_t>(0, 5);                 // heavy ties: lower position wins
+    check_select_sizes<std::uint8_t>(0, 255);
+    check_select_sizes<std::int64_t>(-3, 3);
+    check_select_sizes<float>(-1000, 1000);
+    check_select_sizes<double>(-20, 20);
+}
+
+TEST_CASE("top_k on inputs that keep raising the threshold, and with NaNs")
+{
+    // Ascending input: every vector beats the running threshold, so the
+    // candidate buffer fills and is cut again and again.
+    std::vector<std::int32_t> up(50000);
+    std::iota(up.begin(), up.end(), -25000);
+    std::vector<std::int32_t> down(up.rbegin(), up.rend());
+    for (std::size_t k : {std::size_t{1}, std::size_t{10}, std::size_t{1000}})
+    {
+        check_select<true>(up, k);
+        check_select<false>(up, k);
+        check_select<true>(down, k);
+        check_select<false>(down, k);
+    }
+    check_select<true>(std::vector<std::int32_t>(10000, 4), 100);   // all equal
+
+    std::vector<float> f = make_values<float>(3000, -100, 100, 371u);
+    for (std::size_t i = 0; i < f.size(); i += 7) f[i] = std::numeric_limits<float>::quiet_NaN();
+    f[0] = std::numeric_limits<float>::infinity();
+    check_select<true>(f, 50);
+    check_select<false>(f, 50);
+    check_select<true>(f, 3000);   // fewer non-NaN values than k
+    const std::vector<float> nans(40, std::numeric_limits<float>::quiet_NaN());
+    check_select<true>(nans, 5);
+}
+
+template <class T>
+static void check_nth(std::vector<T> v, std::size_t nth)
+{
+    std::vector<T> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    simdtl::nth_element(v.data(), v.size(), nth);
+    if (nth >= v.size()) return;
+    REQUIRE(v[nth] == sorted[nth]);
+    bool partitioned = true;
+    for (std::size_t i = 0; i < nth; ++i) partitioned &= !(v[nth] < v[i]);
+    for (std::size_t i = nth + 1; i < v.size(); ++i) partitioned &= !(v[i] < v[nth]);
+    CHECK(partitioned);
+    std::sort(v.begin(), v.end());
+    CHECK(v == sorted);   // a permutation of the input
+}
+
+TEST_CASE("nth_element: std::nth_element's contract, small and sampled paths")
+{
+    for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{100}, std::size_t{4095},
+                          std::size_t{4096}, std::size_t{20011}, std::size_t{300000}})
+    {
+        const auto v = make_values<std::int32_t>(n, -1000000, 1000000, 380u + (unsigned)n);
+        for (std::size_t nth : {std::size_t{0}, std::size_t{1}, n / 3, n / 2, n - n / 50, n - 1, n})
+            check_nth(v, nth);
+    }
+    const std::size_t n = 100000;
+    for (std::size_t nth : {std::size_t{0}, n / 2, n - 1})
+    {
+        check_nth(make_values<std::int32_t>(n, 0, 9, 390u), nth);      // few distinct values
+        check_nth(make_values<float>(n, -50000, 50000, 391u), nth);
+        check_nth(make_values<double>(n, -5, 5, 392u), nth);
+        std::vector<std::int64_t> up(n);
+        std::iota(up.begin(), up.end(), std::int64_t{-7});
+        check_nth(up, nth);
+        check_nth(std::vector<std::int64_t>(up.rbegin(), up.rend()), nth);
+        check_nth(std::vector<std::int16_t>(n, 3), nth);
+
+        // Every sampled position holds 0, so the pivot bracket misses: fallback path.
+        const std::size_t stride = n / simdtl::detail::nth_sample_size(n);
+        std::vector<std::int32_t> fool(n);
+        for (std::size_t i = 0; i < n; ++i) fool[i] = i % stride == stride / 2 ? 0 : std::int32_t(i) + 1;
+        check_nth(fool, nth);
+    }
+}
@@ -0,0 +1,181 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/differential.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+using simdtl_test::make_values;
+using simdtl::metric;
+
+// Row counts around the four-row block, dims around every kernel step (8/16/32/64).
+static const std::size_t kRows[] = {0, 1, 3, 4, 5, 7, 8, 9, 261};
+static const std::size_t kDims[] = {1, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 300};
+
+template <metric M, class T>
+static double reference(const T* q, const T* row, std::size_t dim)
+{
+    double acc = 0, qq = 0, rr = 0;
+    for (std::size_t i = 0; i < dim; ++i)
+    {
+        const double a = q[i], b = row[i];
+        acc += M == metric::l2sq ? (b - a) * (b - a) : a * b;
+        qq += a * a;
+        rr += b * b;
+    }
+    if (M != metric::cosine) return acc;
+    return qq > 0 && rr > 0 ? acc / std::sqrt(qq * rr) : 0.0;
+}
+
+// Whole-number inputs keep float dot / L2² exact, so those must match exactly;
+// cosine takes a square root and gets a relative tolerance (exact for int8).
+template <metric M, class T>
+static void check_many(long long lo, long long hi)
+{
+    using S = simdtl::score_t<M, T>;
+    for (std::size_t dim : kDims)
+        for (std::size_t rows : kRows)
+        {
+            const auto q = make_values<T>(dim, lo, hi, 901u + (unsigned)dim);
+            auto base = make_values<T>(rows * dim, lo, hi, 911u + (unsigned)(rows * dim));
+            if (rows > 2) std::fill(base.begin() + 2 * dim, base.begin() + 3 * dim, T(0));   // zero row
+            std::vector<S> got(rows), port(rows);
+            simdtl::score_many<M>(q.data(), base.data(), rows, dim, got.data());
+            simdtl::detail::score_many_portable<M>(q.data(), base.data(), rows, dim, port.data());
+            for (std::size_t r = 0; r < rows; ++r)
+            {
+                const double want = reference<M>(q.data(), base.data() + r * dim, dim);
+                if constexpr (M == metric::cosine && std::is_same_v<T, float>)
+                {
+                    CHECK(double(got[r]) == doctest::Approx(want).epsilon(1e-5));
+                    CHECK(double(port[r]) == doctest::Approx(want).epsilon(1e-5));
+                }
+                else if constexpr (M == metric::cosine)
+                {
+                    CHECK(got[r] == float(want));
+                    CHECK(port[r] == got[r]);
+                }
+                else
+                {
+                    CHECK(double(got[r]) == want);
+                    CHECK(double(port[r]) == want);
+                }
+            }
+        }
+}
+
+TEST_CASE("dot_many / l2sq_many / cosine_many (float) match a scalar reference")
+{
+    check_many<metric::dot, float>(-8, 8);
+    check_many<metric::l2sq, float>(-8, 8);
+    check_many<metric::cosine, float>(-8, 8);
+
+    const std::vector<float> q{1, 2, 3}, base{1, 2, 3, -2, -4, -6, 0, 0, 0};
+    std::vector<float> out(3);
+    simdtl::cosine_many(q.data(), base.data(), 3, 3, out.data());
+    CHECK(out[0] == doctest::Approx(1.0));
+    CHECK(out[1] == doctest::Approx(-1.0));
+    CHECK(out[2] == 0.0f);
+}
+
+TEST_CASE("dot_many / l2sq_many / cosine_many (int8) are exact over the full range")
+{
+    check_many<metric::dot, std::int8_t>(-128, 127);
+    check_many<metric::l2sq, std::int8_t>(-128, 127);
+    check_many<metric::cosine, std::int8_t>(-128, 127);
+
+    // Worst cases past int32: every difference is 255 (L2² wraps an int32 past
+    // dim 33025), every product is 128² (dot wraps past dim 131071). Five rows
+    // cover the four-row block and the single-row remainder.
+    const std::size_t dim = 140001, rows = 5;
+    const std::vector<std::int8_t> q(dim, -128), hi(rows * dim, 127), lo(rows * dim, -128);
+    std::vector<std::int64_t> got(rows), port(rows);
+    simdtl::l2sq_many(q.data(), hi.data(), rows, dim, got.data());
+    simdtl::detail::score_many_portable<metric::l2sq>(q.data(), hi.data(), rows, dim, port.data());
+    for (std::size_t r = 0; r < rows; ++r)
+    {
+        CHECK(got[r] == std::int64_t(dim) * 255 * 255);
+        CHECK(port[r] == got[r]);
+    }
+    simdtl::dot_many(q.data(), lo.data(), rows, dim, got.data());
+    simdtl::detail::score_many_portable<metric::dot>(q.data(), lo.data(), rows, dim, port.data());
+    for (std::size_t r = 0; r < rows; ++r)
+    {
+        CHECK(got[r] == std::int64_t(dim) * 128 * 128);
+        CHECK(port[r] == got[r]);
+    }
+    std::vector<float> cos(rows);
+    simdtl::cosine_many(q.data(), lo.data(), rows, dim, cos.data());
+    for (float c : cos) CHECK(c == 1.0f);
+}
+
+// The k best by (score, then lower index), via a full stable sort.
+template <metric M, class T>
+static void check_nearest(std::size_t rows, std::size_t dim, long long lo, long long hi)
+{
+    using S = simdtl::score_t<M, T>;
+    const auto q = make_values<T>(dim, lo, hi, 921u + (unsigned)rows);
+    const auto base = make_values<T>(rows * dim, lo, hi, 931u + (unsigned)rows);
+    std::vector<S> all(rows);
+    simdtl::score_many<M>(q.data(), base.data(), rows, dim, all.data());
+    std::vector<std::size_t> order(rows);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return M == metric::l2sq ? all[a] < all[b] : all[a] > all[b];
+    });
+    for (std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{5}, std::size_t{64}, rows, rows + 3})
+    {
+        std::vector<std::size_t> idx(k);
+        std::vector<S> scores(k);
+        const std::size_t got = simdtl::nearest_k<M>(q.data(), base.data(), rows, dim, k, idx.data(), scores.data());
+        REQUIRE(got == std::min(k, rows));
+        for (std::size_t j = 0; j < got; ++j)
+        {
+            CHECK(idx[j] == order[j]);
+            CHECK(scores[j] == all[order[j]]);
+        }
+    }
+}
+
+TEST_CASE("nearest_k keeps the k best rows, best first, ties by lower index")
+{
+    for (std::size_t rows : {std::size_t{1}, std::size_t{7}, std::size_t{300}, std::size_t{1000}})
+    {
+        check_nearest<metric::dot, float>(rows, 24, -3, 3);      // small range: many ties
+        check_nearest<metric::l2sq, float>(rows, 24, -3, 3);
+        check_nearest<metric::cosine, float>(rows, 33, -50, 50);
+        check_nearest<metric::dot, std::int8_t>(rows, 40, -2, 2);
+        check_nearest<metric::l2sq, std::int8_t>(rows, 40, -128, 127);
+        check_nearest<metric::cosine, std::int8_t>(rows, 40, -128, 127);
+    }
+}
+
+TEST_CASE("similarity kernels installed at avx2 (+FMA) / avx512")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(dot_many_i8_lvl() == want);
+        CHECK(l2sq_many_i8_lvl() == want);
+        CHECK(cosine_many_i8_lvl() == want);
+        if (want == isa_level::avx512 || detect_cpu_features().fma)
+        {
+            CHECK(dot_many_f32_lvl() == want);
+            CHECK(l2sq_many_f32_lvl() == want);
+        }
+        if (detect_cpu_features().fma)
+            CHECK(cosine_many_f32_lvl() == isa_level::avx2);   // the AVX-512 one lost; not registered
+    }
+#else
+    CHECK(dot_many_f32_slot() == nullptr);
+#endif
+}
@@ -0,0 +1,181 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+
+template <class T>
+static std::vector<T> noise(std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::vector<T> v(n);
+    for (auto& x : v) x = static_cast<T>(gen());
+    return v;
+}
+
+template <class T>
+static void check_delta()
+{
+    using U = std::make_unsigned_t<T>;
+    for (std::size_t n : kEdgeSizes)
+    {
+        const auto v = noise<T>(n + 1, 420u + static_cast<unsigned>(n));   // full range: differences wrap
+        const T init = static_cast<T>(7);
+        std::vector<T> d(n + 1, T(3)), back(n + 1, T(3));
+        simdtl::delta_encode(v.data(), n, d.data(), init);
+        bool ok = d[n] == T(3);
+        for (std::size_t i = 0; i < n; ++i)
+            ok &= d[i] == static_cast<T>(static_cast<U>(v[i]) - static_cast<U>(i == 0 ? init : v[i - 1]));
+        simdtl::delta_decode(d.data(), n, back.data(), init);
+        for (std::size_t i = 0; i < n; ++i) ok &= back[i] == v[i];
+
+        std::vector<T> w(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(n));   // in place, both ways
+        simdtl::delta_encode(w.data(), n, w.data(), init);
+        for (std::size_t i = 0; i < n; ++i) ok &= w[i] == d[i];
+        simdtl::delta_decode(w.data(), n, w.data(), init);
+        for (std::size_t i = 0; i < n; ++i) ok &= w[i] == v[i];
+        CHECK_MESSAGE(ok, "n=" << n);
+    }
+}
+
+TEST_CASE("delta_encode / delta_decode invert each other, in place too")
+{
+    check_delta<std::int32_t>();
+    check_delta<std::uint32_t>();
+    check_delta<std::int64_t>();
+    check_delta<std::int16_t>();
+    check_delta<std::uint8_t>();
+}
+
+template <class T>
+static void check_zigzag()
+{
+    using U = std::make_unsigned_t<T>;
+    for (std::size_t n : kEdgeSizes)
+    {
+        auto v = noise<T>(n, 430u + static_cast<unsigned>(n));
+        for (std::size_t i = 0; i < n; i += 5) v[i] = static_cast<T>(static_cast<int>(i % 7) - 3);
+        if (n > 2) { v[0] = std::numeric_limits<T>::min(); v[1] = std::numeric_limits<T>::max(); }
+        std::vector<U> z(n);
+        std::vector<T> back(n);
+        simdtl::zigzag_encode(v.data(), n, z.data());
+        simdtl::zigzag_decode(z.data(), n, back.data());
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+            const U want = v[i] < 0 ? static_cast<U>(U(~static_cast<U>(v[i])) * U(2) + U(1))
+                                    : static_cast<U>(static_cast<U>(v[i]) * U(2));
+            ok &= z[i] == want && back[i] == v[i];
+        }
+        CHECK_MESSAGE(ok, "n=" << n);
+    }
+}
+
+TEST_CASE("zigzag maps small magnitudes to small codes and back")
+{
+    check_zigzag<std::int8_t>();
+    check_zigzag<std::int16_t>();
+    check_zigzag<std::int32_t>();
+    check_zigzag<std::int64_t>();
+}
+
+// Byte-by-byte encoder written from the layout description in streamvbyte.hpp.
+static std::vector<std::uint8_t> svb_ref(const std::vector<std::uint32_t>& v)
+{
+    std::vector<std::uint8_t> out((v.size() + 3) / 4, 0);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        std::size_t bytes = 1;
+        while (bytes < 4 && (v[i] >> (8 * bytes)) != 0) ++bytes;
+        out[i / 4] = static_cast<std::uint8_t>(out[i / 4] | ((bytes - 1) << (2 * (i % 4))));
+        for (std::size_t b = 0; b < bytes; ++b) out.push_back(static_cast<std::uint8_t>(v[i] >> (8 * b)));
+    }
+    return out;
+}
+
+// Every byte length, with runs of one length and random mixes.
+static std::vector<std::uint32_t> varied(std::size_t n, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::vector<std::uint32_t> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const unsigned bytes = (i / 64) % 5 == 4 ? gen() % 4 + 1 : static_cast<unsigned>((i / 64) % 5) + 1;
+        v[i] = bytes == 4 ? gen() | 0x1000000u : gen() % (std::uint32_t{1} << (8 * bytes));
+    }
+    return v;
+}
+
+static const std::size_t kSizes[] = {0, 1, 3, 4, 5, 7, 8, 12, 15, 16, 17, 31, 32, 33, 100, 1023, 1024, 1025, 5000};
+
+TEST_CASE("streamvbyte writes the documented layout and decodes from an exact-size buffer")
+{
+    for (std::size_t n : kSizes)
+    {
+        const auto v = varied(n, 440u + static_cast<unsigned>(n));
+        const auto ref = svb_ref(v);
+        const std::size_t cap = simdtl::streamvbyte_max_bytes(n);
+        std::vector<std::uint8_t> enc(cap + 1, 0xA5), port(cap, 0xA5);
+        CHECK(simdtl::streamvbyte_encode(v.data(), n, enc.data()) == ref.size());
+        bool same = enc[cap] == 0xA5;   // nothing written past the bound
+        for (std::size_t i = 0; i < ref.size(); ++i) same &= enc[i] == ref[i];
+        const std::size_t head = (n + 3) / 4;
+        simdtl::detail::svb_encode_portable(v.data(), n, port.data(), port.data() + head);
+        for (std::size_t i = 0; i < ref.size(); ++i) same &= port[i] == ref[i];
+        CHECK_MESSAGE(same, "n=" << n);
+
+        const std::vector<std::uint8_t> exact(ref);
+        std::vector<std::uint32_t> back(n + 1, 7u);
+        CHECK(simdtl::streamvbyte_decode(exact.data(), n, back.data()) == exact.size());
+        bool ok = back[n] == 7u;
+        for (std::size_t i = 0; i < n; ++i) ok &= back[i] == v[i];
+        CHECK_MESSAGE(ok, "n=" << n);
+    }
+}
+
+TEST_CASE("streamvbyte_encode_delta / decode_delta: sorted ids across chunk boundaries")
+{
+    for (std::size_t n : kSizes)
+    {
+        std::mt19937 gen(450u + static_cast<unsigned>(n));
+        std::vector<std::uint32_t> ids(n);
+        std::uint32_t x = 1000000u;
+        for (auto& id : ids) id = x += gen() % (n % 2 ? 300u : 70000u);
+        std::vector<std::uint32_t> d(n);
+        simdtl::delta_encode(ids.data(), n, d.data(), 999u);
+        const auto ref = svb_ref(d);
+
+        std::vector<std::uint8_t> enc(simdtl::streamvbyte_max_bytes(n));
+        const std::size_t bytes = simdtl::streamvbyte_encode_delta(ids.data(), n, enc.data(), 999u);
+        CHECK(bytes == ref.size());
+        bool ok = true;
+        for (std::size_t i = 0; i < bytes; ++i) ok &= enc[i] == ref[i];
+        std::vector<std::uint32_t> back(n);
+        CHECK(simdtl::streamvbyte_decode_delta(ref.data(), n, back.data(), 999u) == bytes);
+        ok &= back == ids;
+        CHECK_MESSAGE(ok, "n=" << n);
+    }
+}
+
+TEST_CASE("streamvbyte kernels installed at avx2")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        CHECK(svb_encode_lvl() == isa_level::avx2);
+        CHECK(svb_decode_lvl() == isa_level::avx2);
+    }
+#else
+    CHECK(svb_encode_slot() == nullptr);
+#endif
+}
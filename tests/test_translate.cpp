@@ -0,0 +1,103 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <simdtl/simdtl.hpp>
+#include "support/sizes.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using simdtl_test::kEdgeSizes;
+
+static std::vector<std::size_t> test_sizes()
+{
+    std::vector<std::size_t> sizes(kEdgeSizes.begin(), kEdgeSizes.end());
+    sizes.push_back(4099);
+    return sizes;
+}
+
+TEST_CASE("translate_bytes matches the table lookup for every byte value")
+{
+    std::mt19937 gen(490u);
+    std::vector<std::uint8_t> table(256);
+    for (auto& t : table) t = static_cast<std::uint8_t>(gen());
+    for (std::size_t n : test_sizes())
+    {
+        std::vector<std::uint8_t> in(n);
+        for (std::size_t i = 0; i < n; ++i) in[i] = static_cast<std::uint8_t>(i < 256 ? i : gen());
+        std::vector<std::uint8_t> want(n);
+        for (std::size_t i = 0; i < n; ++i) want[i] = table[in[i]];
+
+        std::vector<std::uint8_t> out(n + 1, 0xA5);
+        simdtl::translate_bytes(in.data(), n, table.data(), out.data());
+        CHECK_MESSAGE(out[n] == 0xA5, "n=" << n);
+        out.resize(n);
+        CHECK_MESSAGE(out == want, "n=" << n);
+
+        auto inplace = in;   // out aliases first
+        simdtl::translate_bytes(inplace.data(), n, table.data(), inplace.data());
+        CHECK_MESSAGE(inplace == want, "in place n=" << n);
+    }
+
+    // char: ASCII upper-casing as a tr table.
+    std::vector<char> upper(256);
+    for (int c = 0; c < 256; ++c)
+        upper[static_cast<std::size_t>(c)] = static_cast<char>(c >= 'a' && c <= 'z' ? c - 32 : c);
+    std::string s = "Hello, simd world! Translate me, and this tail too.";
+    simdtl::translate_bytes(s.data(), s.size(), upper.data(), s.data());
+    CHECK(s == "HELLO, SIMD WORLD! TRANSLATE ME, AND THIS TAIL TOO.");
+}
+
+template <class V>
+static void check_dict(unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    for (std::size_t dict_n : {1u, 3u, 4u, 5u, 8u, 9u, 15u, 16u, 17u, 32u, 33u, 200u, 256u})
+    {
+        std::vector<V> dict(dict_n);
+        for (auto& d : dict) d = static_cast<V>(gen());
+        for (std::size_t n : test_sizes())
+        {
+            std::vector<std::uint8_t> codes(n);
+            for (auto& c : codes) c = static_cast<std::uint8_t>(gen() % dict_n);
+            std::vector<V> want(n);
+            for (std::size_t i = 0; i < n; ++i) want[i] = dict[codes[i]];
+            std::vector<V> out(n + 1, V(7));
+            simdtl::dict_decode(codes.data(), n, dict.data(), dict_n, out.data());
+            CHECK_MESSAGE(out[n] == V(7), "dict " << dict_n << " n=" << n);
+            out.resize(n);
+            CHECK_MESSAGE(out == want, "dict " << dict_n << " n=" << n);
+        }
+    }
+}
+
+TEST_CASE("dict_decode matches the scalar lookup (1/2/4/8-byte values, 1..256 entries)")
+{
+    check_dict<std::uint8_t>(491u);
+    check_dict<std::int16_t>(492u);   // portable
+    check_dict<std::uint32_t>(493u);
+    check_dict<float>(494u);
+    check_dict<std::int64_t>(495u);
+    check_dict<double>(496u);
+}
+
+TEST_CASE("translate / dict_decode kernels installed when the CPU supports AVX2")
+{
+    using namespace simdtl::platform;
+#ifdef SIMDTL_HAVE_FAST_KERNELS
+    if (best_isa() >= isa_level::avx2)
+    {
+        const isa_level want = best_isa() >= isa_level::avx512 ? isa_level::avx512 : isa_level::avx2;
+        CHECK(translate_u8_lvl() == want);
+        CHECK(dict_decode_u32_lvl() == want);
+        CHECK(dict_decode_u64_lvl() == want);
+    }
+#else
+    CHECK(translate_u8_slot() == nullptr);
+    CHECK(dict_decode_u32_slot() == nullptr);
+    CHECK(dict_decode_u64_slot() == nullptr);
+#endif
+}